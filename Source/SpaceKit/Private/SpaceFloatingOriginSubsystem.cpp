@@ -0,0 +1,131 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "SpaceKit/Public/SpaceFloatingOriginSubsystem.h"
+
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+#include "SpaceKit/Public/SpaceTransformComponent.h"
+
+
+USpaceFloatingOriginSubsystem::USpaceFloatingOriginSubsystem()
+	: OriginComponent(nullptr)
+{
+}
+
+void USpaceFloatingOriginSubsystem::Register(USpaceTransformComponent* Component)
+{
+	if (Component == nullptr || Component->FloatingOriginIndex != INDEX_NONE) return;
+
+	Component->FloatingOriginIndex = Components.Add(Component);
+	States.AddDefaulted();
+}
+
+void USpaceFloatingOriginSubsystem::Unregister(USpaceTransformComponent* Component)
+{
+	if (Component == nullptr || !Components.IsValidIndex(Component->FloatingOriginIndex) || Components[Component->FloatingOriginIndex] != Component) return;
+
+	const int32 Index = Component->FloatingOriginIndex;
+	Components.RemoveAtSwap(Index, 1, false);
+	States.RemoveAtSwap(Index, 1, false);
+	if (Components.IsValidIndex(Index))
+	{
+		Components[Index]->FloatingOriginIndex = Index;
+	}
+	Component->FloatingOriginIndex = INDEX_NONE;
+
+	if (OriginComponent == Component)
+	{
+		OriginComponent = nullptr;
+	}
+}
+
+void USpaceFloatingOriginSubsystem::SetOrigin(const FVectorFloat& NewOrigin)
+{
+	if (NewOrigin != Origin)
+	{
+		Origin = NewOrigin;
+		bOriginChanged = true;
+	}
+}
+
+FVector USpaceFloatingOriginSubsystem::ToRenderSpace(const FVectorFloat& Location) const
+{
+	return (Location - Origin).ToFVector();
+}
+
+FVectorFloat USpaceFloatingOriginSubsystem::FromRenderSpace(const FVector& RenderLocation) const
+{
+	return Origin + FVectorFloat(RenderLocation);
+}
+
+USpaceTransformComponent* USpaceFloatingOriginSubsystem::GetFollowedComponent() const
+{
+	if (OriginComponent != nullptr)
+	{
+		return OriginComponent;
+	}
+
+	auto* World = GetWorld(); if (!World) return nullptr;
+	auto* PlayerController = World->GetFirstPlayerController(); if (!PlayerController) return nullptr;
+	auto* ViewTarget = PlayerController->GetViewTarget(); if (!ViewTarget) return nullptr;
+	return ViewTarget->FindComponentByClass<USpaceTransformComponent>();
+}
+
+void USpaceFloatingOriginSubsystem::UpdateRenderTransforms()
+{
+	// Rebase onto the followed component once it's far enough. The distance is measured in render space, where it's small while rebasing isn't needed
+	if (auto* FollowedComponent = GetFollowedComponent())
+	{
+		if (ToRenderSpace(FollowedComponent->Location).SizeSquared() > FMath::Square(RebaseDistance))
+		{
+			SetOrigin(FollowedComponent->Location);
+		}
+	}
+
+	// Find what changed, and convert it, in parallel. The components' transforms are only read
+	const bool bConvertAll = bOriginChanged;
+	const int32 NumChunks = FMath::DivideAndRoundUp(Components.Num(), ChunkSize);
+	ParallelFor(NumChunks, [this, bConvertAll](int32 Chunk)
+	{
+		const int32 End = FMath::Min((Chunk + 1) * ChunkSize, Components.Num());
+		for (int32 Index = Chunk * ChunkSize; Index < End; Index++)
+		{
+			const USpaceTransformComponent* Component = Components[Index];
+			FSyncState& State = States[Index];
+			State.bDirty = false;
+
+			const bool bLocationChanged = !State.bSynced || State.Location != Component->Location;
+			const bool bRotationChanged = !State.bSynced || State.Rotation != Component->Rotation;
+			if (bLocationChanged || bConvertAll)
+			{
+				State.Location = Component->Location;
+				const FVector RenderLocation = (State.Location - Origin).ToFVector();
+				State.bDirty |= RenderLocation != State.RenderLocation || !State.bSynced;
+				State.RenderLocation = RenderLocation;
+			}
+			if (bRotationChanged)
+			{
+				State.Rotation = Component->Rotation;
+				const FRotator RenderRotation = State.Rotation.ToFRotator();
+				State.bDirty |= RenderRotation != State.RenderRotation || !State.bSynced;
+				State.RenderRotation = RenderRotation;
+			}
+			State.bSynced = true;
+		}
+	});
+	bOriginChanged = false;
+
+	// Engine transforms can only be set on the game thread, so only the changed ones are
+	for (int32 Index = 0; Index < Components.Num(); Index++)
+	{
+		const FSyncState& State = States[Index];
+		if (!State.bDirty) continue;
+
+		if (auto* Actor = Components[Index]->GetOwner())
+		{
+			Actor->SetActorLocationAndRotation(State.RenderLocation, State.RenderRotation, false, nullptr, ETeleportType::TeleportPhysics);
+		}
+	}
+}
@@ -0,0 +1,75 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "SpaceKit/Public/SpaceGravitySubsystem.h"
+
+#include "Subsystems/SubsystemCollection.h"
+
+#include "SpaceKit/Public/SpaceKitSubsystem.h"
+#include "SpaceKit/Public/SpaceTransformComponent.h"
+
+
+void USpaceGravitySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SpaceKit = Cast<USpaceKitSubsystem>(Collection.InitializeDependency(USpaceKitSubsystem::StaticClass()));
+	if (SpaceKit)
+	{
+		SpaceKit->SetAccelerationFunction([this](const FSpaceBodyStates& States, int32 First, int32 Num, TArrayView<FVectorHybrid> OutAccelerations)
+		{
+			ComputeAccelerations(States, First, Num, OutAccelerations);
+		});
+	}
+}
+
+void USpaceGravitySubsystem::Deinitialize()
+{
+	if (SpaceKit)
+	{
+		SpaceKit->SetAccelerationFunction(nullptr);
+	}
+
+	Super::Deinitialize();
+}
+
+void USpaceGravitySubsystem::GatherStaticSources()
+{
+	SourceLocations.Reset();
+	SourceMasses.Reset();
+	for (int32 Index = 0; Index < SpaceKit->GetNumBodyIndices(); Index++)
+	{
+		const FSpaceKitBody& Body = SpaceKit->GetBody(Index);
+		if (Body.Transform == nullptr || Body.Movement != nullptr) continue;
+
+		const double Mass = Body.Transform->Mass.ToDouble();
+		if (Mass <= 0) continue;
+
+		SourceLocations.Add(Body.Transform->Location);
+		SourceMasses.Add(Mass);
+	}
+	NumStaticSources = SourceLocations.Num();
+}
+
+void USpaceGravitySubsystem::ComputeAccelerations(const FSpaceBodyStates& States, int32 First, int32 Num, TArrayView<FVectorHybrid> OutAccelerations)
+{
+	if (SpaceKit == nullptr) return;
+
+	if (StaticSourcesFrame != GFrameCounter)
+	{
+		GatherStaticSources();
+		StaticSourcesFrame = GFrameCounter;
+	}
+
+	// The simulated bodies, where they are at this point of the step
+	const int32 NumSources = NumStaticSources + States.Num();
+	SourceLocations.SetNum(NumSources, false);
+	SourceMasses.SetNum(NumSources, false);
+	for (int32 Index = 0; Index < States.Num(); Index++)
+	{
+		SourceLocations[NumStaticSources + Index] = States.Locations[Index];
+		SourceMasses[NumStaticSources + Index] = States.Masses[Index].ToDouble();
+	}
+
+	Tree.Build(SourceLocations, SourceMasses);
+	Tree.ComputeAccelerations(TArrayView<const FVectorFloat>(States.Locations.GetData() + First, Num), GravitationalConstant, OpeningAngle, Softening, OutAccelerations);
+}
@@ -0,0 +1,483 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "SpaceKit/Public/SpaceGravityTree.h"
+
+#include "Async/ParallelFor.h"
+
+#include <cmath>
+
+
+namespace SpaceGravityTree
+{
+	// Bodies, or evaluated locations, per parallel task
+	constexpr int32 ChunkSize = 1024;
+
+	// Levels of the Morton codes, of 3 bits each. Nodes at the last level are leaves, whatever their number of bodies
+	constexpr int32 NumLevels = 21;
+
+	// Level whose nodes' subtrees are built in parallel, so up to 8^2 tasks. Smaller trees are built in one task
+	constexpr int32 ParallelLevel = 2;
+	constexpr int32 MinParallelBodies = 4 * ChunkSize;
+
+	// Each node visited pushes at most 8 children, and is at most NumLevels deep
+	constexpr int32 StackSize = 8 * (NumLevels + 1);
+
+	// Locations that walk the tree together, and groups per parallel task
+	constexpr int32 GroupSize = 16;
+	constexpr int32 GroupsPerTask = 16;
+
+	// Sources summed at once, in independent lanes the compiler can vectorize
+	constexpr int32 NumLanes = 4;
+
+	// Spreads the 21 lowest bits of a value to every third bit
+	uint64 SpreadBits(uint64 Value)
+	{
+		Value &= 0x1fffff;
+		Value = (Value | Value << 32) & 0x1f00000000ffffull;
+		Value = (Value | Value << 16) & 0x1f0000ff0000ffull;
+		Value = (Value | Value << 8) & 0x100f00f00f00f00full;
+		Value = (Value | Value << 4) & 0x10c30c30c30c30c3ull;
+		Value = (Value | Value << 2) & 0x1249249249249249ull;
+		return Value;
+	}
+
+	// Sorts keys of 63 bits, and their values along, in 4 passes of 16 bits
+	void RadixSort(TArray<uint64>& Keys, TArray<int32>& Values)
+	{
+		constexpr int32 DigitBits = 16;
+		constexpr int32 NumDigits = 1 << DigitBits;
+
+		const int32 Num = Keys.Num();
+		TArray<uint64> SortedKeys;
+		TArray<int32> SortedValues;
+		SortedKeys.SetNumUninitialized(Num);
+		SortedValues.SetNumUninitialized(Num);
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(NumDigits);
+
+		for (int32 Shift = 0; Shift < 64; Shift += DigitBits)
+		{
+			FMemory::Memzero(Offsets.GetData(), NumDigits * sizeof(int32));
+			for (int32 Index = 0; Index < Num; Index++)
+			{
+				Offsets[(Keys[Index] >> Shift) & (NumDigits - 1)]++;
+			}
+
+			int32 Offset = 0;
+			for (int32 Digit = 0; Digit < NumDigits; Digit++)
+			{
+				const int32 Count = Offsets[Digit];
+				Offsets[Digit] = Offset;
+				Offset += Count;
+			}
+
+			for (int32 Index = 0; Index < Num; Index++)
+			{
+				const int32 Destination = Offsets[(Keys[Index] >> Shift) & (NumDigits - 1)]++;
+				SortedKeys[Destination] = Keys[Index];
+				SortedValues[Destination] = Values[Index];
+			}
+
+			Swap(Keys, SortedKeys);
+			Swap(Values, SortedValues);
+		}
+	}
+}
+
+void FSpaceGravityTree::Build(TArrayView<const FVectorFloat> Locations, TArrayView<const double> Masses)
+{
+	using namespace SpaceGravityTree;
+
+	const int32 Num = FMath::Min(Locations.Num(), Masses.Num());
+	Bodies.SetNumUninitialized(Num);
+	Codes.SetNumUninitialized(Num);
+	Nodes.Reset();
+	if (Num == 0) return;
+
+	// Only the offsets to the origin are converted from high precision, so the tree runs in double near the bodies
+	Origin = Locations[0];
+	const int32 NumChunks = FMath::DivideAndRoundUp(Num, ChunkSize);
+	TArray<FBody> Unsorted;
+	Unsorted.SetNumUninitialized(Num);
+	TArray<double> ChunkBounds;
+	ChunkBounds.SetNumUninitialized(NumChunks * 6);
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		double* Bounds = &ChunkBounds[Chunk * 6];
+		Bounds[0] = Bounds[1] = Bounds[2] = MAX_dbl;
+		Bounds[3] = Bounds[4] = Bounds[5] = -MAX_dbl;
+
+		const int32 End = FMath::Min((Chunk + 1) * ChunkSize, Num);
+		for (int32 Index = Chunk * ChunkSize; Index < End; Index++)
+		{
+			const FVectorFloat Offset = Locations[Index] - Origin;
+			FBody& Body = Unsorted[Index];
+			Body.X = Offset.X.ToDouble();
+			Body.Y = Offset.Y.ToDouble();
+			Body.Z = Offset.Z.ToDouble();
+			Body.Mass = FMath::Max(Masses[Index], 0.0);
+
+			const double Coordinates[3] = { Body.X, Body.Y, Body.Z };
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				Bounds[Axis] = FMath::Min(Bounds[Axis], Coordinates[Axis]);
+				Bounds[Axis + 3] = FMath::Max(Bounds[Axis + 3], Coordinates[Axis]);
+			}
+		}
+	});
+
+	// The root is the bounding cube, slightly enlarged so the farthest bodies stay in it once quantized
+	double RootMax[3];
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		RootMin[Axis] = MAX_dbl;
+		RootMax[Axis] = -MAX_dbl;
+		for (int32 Chunk = 0; Chunk < NumChunks; Chunk++)
+		{
+			RootMin[Axis] = FMath::Min(RootMin[Axis], ChunkBounds[Chunk * 6 + Axis]);
+			RootMax[Axis] = FMath::Max(RootMax[Axis], ChunkBounds[Chunk * 6 + Axis + 3]);
+		}
+	}
+	RootSize = FMath::Max3(RootMax[0] - RootMin[0], RootMax[1] - RootMin[1], RootMax[2] - RootMin[2]);
+	RootSize = RootSize > 0 ? RootSize * (1 + 1e-9) : 1;
+
+	// Morton codes, sorting the bodies so that each node's bodies are contiguous
+	TArray<int32> Order;
+	Order.SetNumUninitialized(Num);
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		const int32 End = FMath::Min((Chunk + 1) * ChunkSize, Num);
+		for (int32 Index = Chunk * ChunkSize; Index < End; Index++)
+		{
+			Codes[Index] = GetCode(Unsorted[Index]);
+			Order[Index] = Index;
+		}
+	});
+	RadixSort(Codes, Order);
+	ParallelFor(NumChunks, [&](int32 Chunk)
+	{
+		const int32 End = FMath::Min((Chunk + 1) * ChunkSize, Num);
+		for (int32 Index = Chunk * ChunkSize; Index < End; Index++)
+		{
+			Bodies[Index] = Unsorted[Order[Index]];
+		}
+	});
+
+	// The top levels are built here, and the subtrees below them in parallel, each in its own array
+	TArray<FSubtree> Subtrees;
+	Nodes.AddUninitialized();
+	BuildNode(Nodes, 0, 0, Num, 0, Num >= MinParallelBodies ? &Subtrees : nullptr);
+	if (Subtrees.Num() == 0) return;
+
+	const int32 NumTopNodes = Nodes.Num();
+	TArray<TArray<FNode>> SubtreeNodes;
+	SubtreeNodes.SetNum(Subtrees.Num());
+	ParallelFor(Subtrees.Num(), [&](int32 Subtree)
+	{
+		TArray<FNode>& LocalNodes = SubtreeNodes[Subtree];
+		LocalNodes.AddUninitialized();
+		BuildNode(LocalNodes, 0, Subtrees[Subtree].Begin, Subtrees[Subtree].End, ParallelLevel, nullptr);
+	});
+
+	// Each subtree's root replaces its node, and its other nodes are appended, their children moved along
+	for (int32 Subtree = 0; Subtree < Subtrees.Num(); Subtree++)
+	{
+		const TArray<FNode>& LocalNodes = SubtreeNodes[Subtree];
+		const int32 Offset = Nodes.Num() - 1;
+		for (int32 Local = 0; Local < LocalNodes.Num(); Local++)
+		{
+			FNode Node = LocalNodes[Local];
+			if (Node.NumChildren > 0)
+			{
+				Node.FirstChild += Offset;
+			}
+
+			if (Local == 0)
+			{
+				Nodes[Subtrees[Subtree].Node] = Node;
+			}
+			else
+			{
+				Nodes.Add(Node);
+			}
+		}
+	}
+
+	// The top nodes were summed up without the subtrees. Children are added after their parents, so they're summed up again from the last one
+	for (int32 NodeIndex = NumTopNodes - 1; NodeIndex >= 0; NodeIndex--)
+	{
+		ComputeCenterOfMass(Nodes, NodeIndex);
+	}
+}
+
+uint64 FSpaceGravityTree::GetCode(const FBody& Body) const
+{
+	using namespace SpaceGravityTree;
+
+	// Clamped, as evaluated locations can be out of the root
+	const double Scale = double(1 << NumLevels) / RootSize;
+	const double MaxCell = double((1 << NumLevels) - 1);
+	const uint64 CellX = uint64(FMath::Clamp((Body.X - RootMin[0]) * Scale, 0.0, MaxCell));
+	const uint64 CellY = uint64(FMath::Clamp((Body.Y - RootMin[1]) * Scale, 0.0, MaxCell));
+	const uint64 CellZ = uint64(FMath::Clamp((Body.Z - RootMin[2]) * Scale, 0.0, MaxCell));
+	return SpreadBits(CellX) << 2 | SpreadBits(CellY) << 1 | SpreadBits(CellZ);
+}
+
+void FSpaceGravityTree::BuildNode(TArray<FNode>& OutNodes, int32 NodeIndex, int32 Begin, int32 End, int32 Level, TArray<FSubtree>* OutSubtrees) const
+{
+	using namespace SpaceGravityTree;
+
+	{
+		FNode& Node = OutNodes[NodeIndex];
+		Node.Size = RootSize / double(1 << Level);
+		Node.FirstChild = 0;
+		Node.NumChildren = 0;
+		Node.FirstBody = Begin;
+		Node.NumBodies = End - Begin;
+	}
+
+	if (End - Begin > MaxLeafBodies && Level < NumLevels)
+	{
+		if (OutSubtrees != nullptr && Level == ParallelLevel)
+		{
+			OutSubtrees->Add({ NodeIndex, Begin, End });
+			return;
+		}
+
+		// The node's bodies share the digits of the levels above, so they're sorted by their digit at this level
+		const int32 Shift = 3 * (NumLevels - 1 - Level);
+		int32 ChildBegins[9];
+		ChildBegins[8] = End;
+		int32 Low = Begin;
+		for (int32 Digit = 0; Digit < 8; Digit++)
+		{
+			// First body whose digit is at least this one
+			int32 High = End;
+			while (Low < High)
+			{
+				const int32 Middle = (Low + High) / 2;
+				if (int32((Codes[Middle] >> Shift) & 7) < Digit)
+				{
+					Low = Middle + 1;
+				}
+				else
+				{
+					High = Middle;
+				}
+			}
+			ChildBegins[Digit] = Low;
+		}
+
+		int32 NumChildren = 0;
+		for (int32 Digit = 0; Digit < 8; Digit++)
+		{
+			NumChildren += ChildBegins[Digit + 1] > ChildBegins[Digit];
+		}
+
+		const int32 FirstChild = OutNodes.AddUninitialized(NumChildren);
+		OutNodes[NodeIndex].FirstChild = FirstChild;
+		OutNodes[NodeIndex].NumChildren = NumChildren;
+
+		int32 Child = FirstChild;
+		for (int32 Digit = 0; Digit < 8; Digit++)
+		{
+			if (ChildBegins[Digit + 1] > ChildBegins[Digit])
+			{
+				BuildNode(OutNodes, Child++, ChildBegins[Digit], ChildBegins[Digit + 1], Level + 1, OutSubtrees);
+			}
+		}
+	}
+
+	ComputeCenterOfMass(OutNodes, NodeIndex);
+}
+
+void FSpaceGravityTree::ComputeCenterOfMass(TArray<FNode>& OutNodes, int32 NodeIndex) const
+{
+	FNode& Node = OutNodes[NodeIndex];
+	double X = 0, Y = 0, Z = 0, Mass = 0;
+	if (Node.NumChildren == 0)
+	{
+		for (int32 Index = Node.FirstBody; Index < Node.FirstBody + Node.NumBodies; Index++)
+		{
+			const FBody& Body = Bodies[Index];
+			X += Body.X * Body.Mass;
+			Y += Body.Y * Body.Mass;
+			Z += Body.Z * Body.Mass;
+			Mass += Body.Mass;
+		}
+	}
+	else
+	{
+		for (int32 Index = Node.FirstChild; Index < Node.FirstChild + Node.NumChildren; Index++)
+		{
+			const FNode& Child = OutNodes[Index];
+			X += Child.X * Child.Mass;
+			Y += Child.Y * Child.Mass;
+			Z += Child.Z * Child.Mass;
+			Mass += Child.Mass;
+		}
+	}
+
+	Node.Mass = Mass;
+	if (Mass > 0)
+	{
+		Node.X = X / Mass;
+		Node.Y = Y / Mass;
+		Node.Z = Z / Mass;
+	}
+	else
+	{
+		Node.X = Node.Y = Node.Z = 0;
+	}
+}
+
+void FSpaceGravityTree::ComputeAccelerations(TArrayView<const FVectorFloat> Locations, double GravitationalConstant, double OpeningAngle, double Softening, TArrayView<FVectorHybrid> OutAccelerations) const
+{
+	using namespace SpaceGravityTree;
+
+	const int32 Num = FMath::Min(Locations.Num(), OutAccelerations.Num());
+	if (Nodes.Num() == 0)
+	{
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			OutAccelerations[Index] = FVectorHybrid();
+		}
+		return;
+	}
+
+	// Locations relative to the origin, sorted along the bodies' curve, so that close locations are grouped together
+	TArray<FBody> Targets;
+	TArray<uint64> TargetCodes;
+	TArray<int32> Order;
+	Targets.SetNumUninitialized(Num);
+	TargetCodes.SetNumUninitialized(Num);
+	Order.SetNumUninitialized(Num);
+	ParallelFor(FMath::DivideAndRoundUp(Num, ChunkSize), [&](int32 Chunk)
+	{
+		const int32 End = FMath::Min((Chunk + 1) * ChunkSize, Num);
+		for (int32 Index = Chunk * ChunkSize; Index < End; Index++)
+		{
+			const FVectorFloat Offset = Locations[Index] - Origin;
+			FBody& Target = Targets[Index];
+			Target.X = Offset.X.ToDouble();
+			Target.Y = Offset.Y.ToDouble();
+			Target.Z = Offset.Z.ToDouble();
+			Target.Mass = 0;
+			TargetCodes[Index] = GetCode(Target);
+			Order[Index] = Index;
+		}
+	});
+	RadixSort(TargetCodes, Order);
+
+	// Each group of locations walks the tree once, opening the nodes too close to any of its locations.
+	// The nodes it keeps and the bodies of the leaves it reaches are the same sources for all its locations, summed in a flat loop
+	const double OpeningAngleSquared = OpeningAngle * OpeningAngle;
+	const double SofteningSquared = Softening * Softening;
+	const int32 NumGroups = FMath::DivideAndRoundUp(Num, GroupSize);
+	ParallelFor(FMath::DivideAndRoundUp(NumGroups, GroupsPerTask), [&](int32 Task)
+	{
+		TArray<double> SourceX, SourceY, SourceZ, SourceMass;
+		const auto AddSource = [&](double X, double Y, double Z, double Mass)
+		{
+			SourceX.Add(X);
+			SourceY.Add(Y);
+			SourceZ.Add(Z);
+			SourceMass.Add(Mass);
+		};
+
+		const int32 EndGroup = FMath::Min((Task + 1) * GroupsPerTask, NumGroups);
+		for (int32 Group = Task * GroupsPerTask; Group < EndGroup; Group++)
+		{
+			const int32 Begin = Group * GroupSize;
+			const int32 End = FMath::Min(Begin + GroupSize, Num);
+
+			double Min[3] = { MAX_dbl, MAX_dbl, MAX_dbl };
+			double Max[3] = { -MAX_dbl, -MAX_dbl, -MAX_dbl };
+			for (int32 Index = Begin; Index < End; Index++)
+			{
+				const FBody& Target = Targets[Order[Index]];
+				const double Coordinates[3] = { Target.X, Target.Y, Target.Z };
+				for (int32 Axis = 0; Axis < 3; Axis++)
+				{
+					Min[Axis] = FMath::Min(Min[Axis], Coordinates[Axis]);
+					Max[Axis] = FMath::Max(Max[Axis], Coordinates[Axis]);
+				}
+			}
+
+			SourceX.Reset();
+			SourceY.Reset();
+			SourceZ.Reset();
+			SourceMass.Reset();
+
+			int32 Stack[StackSize];
+			int32 StackNum = 0;
+			Stack[StackNum++] = 0;
+			while (StackNum > 0)
+			{
+				const FNode& Node = Nodes[Stack[--StackNum]];
+				if (Node.Mass <= 0) continue;
+
+				if (Node.NumChildren == 0)
+				{
+					for (int32 BodyIndex = Node.FirstBody; BodyIndex < Node.FirstBody + Node.NumBodies; BodyIndex++)
+					{
+						const FBody& Body = Bodies[BodyIndex];
+						AddSource(Body.X, Body.Y, Body.Z, Body.Mass);
+					}
+					continue;
+				}
+
+				// Distance from the center of mass to the group's box
+				const double Dx = FMath::Max3(Min[0] - Node.X, 0.0, Node.X - Max[0]);
+				const double Dy = FMath::Max3(Min[1] - Node.Y, 0.0, Node.Y - Max[1]);
+				const double Dz = FMath::Max3(Min[2] - Node.Z, 0.0, Node.Z - Max[2]);
+				if (Node.Size * Node.Size < OpeningAngleSquared * (Dx * Dx + Dy * Dy + Dz * Dz))
+				{
+					AddSource(Node.X, Node.Y, Node.Z, Node.Mass);
+				}
+				else
+				{
+					for (int32 Child = Node.FirstChild; Child < Node.FirstChild + Node.NumChildren; Child++)
+					{
+						Stack[StackNum++] = Child;
+					}
+				}
+			}
+
+			// Padded with massless sources, so the sum runs in blocks of independent lanes
+			while (SourceMass.Num() % NumLanes != 0)
+			{
+				AddSource(0, 0, 0, 0);
+			}
+
+			for (int32 Index = Begin; Index < End; Index++)
+			{
+				const FBody& Target = Targets[Order[Index]];
+				double Ax[NumLanes] = { }, Ay[NumLanes] = { }, Az[NumLanes] = { };
+				for (int32 Source = 0; Source < SourceMass.Num(); Source += NumLanes)
+				{
+					for (int32 Lane = 0; Lane < NumLanes; Lane++)
+					{
+						const double Dx = SourceX[Source + Lane] - Target.X;
+						const double Dy = SourceY[Source + Lane] - Target.Y;
+						const double Dz = SourceZ[Source + Lane] - Target.Z;
+						const double DistanceSquared = Dx * Dx + Dy * Dy + Dz * Dz + SofteningSquared;
+						const double Factor = DistanceSquared > 0 ? SourceMass[Source + Lane] / (DistanceSquared * std::sqrt(DistanceSquared)) : 0;
+						Ax[Lane] += Dx * Factor;
+						Ay[Lane] += Dy * Factor;
+						Az[Lane] += Dz * Factor;
+					}
+				}
+
+				double SumX = 0, SumY = 0, SumZ = 0;
+				for (int32 Lane = 0; Lane < NumLanes; Lane++)
+				{
+					SumX += Ax[Lane];
+					SumY += Ay[Lane];
+					SumZ += Az[Lane];
+				}
+				OutAccelerations[Order[Index]] = FVectorHybrid(SumX * GravitationalConstant, SumY * GravitationalConstant, SumZ * GravitationalConstant);
+			}
+		}
+	});
+}
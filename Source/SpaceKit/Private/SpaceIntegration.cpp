@@ -0,0 +1,203 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "SpaceKit/Public/SpaceIntegration.h"
+
+#include <cmath>
+
+
+namespace SpaceIntegration
+{
+	// Dormand-Prince tableau. The last stage is evaluated at the fifth order solution, so it's the next substep's first stage
+	constexpr int32 NumStages = 7;
+
+	constexpr double StageWeights[NumStages][NumStages - 1] =
+	{
+		{ },
+		{ 1.0 / 5.0 },
+		{ 3.0 / 40.0, 9.0 / 40.0 },
+		{ 44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0 },
+		{ 19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0 },
+		{ 9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0 },
+		{ 35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0 },
+	};
+
+	// Differences between the fifth and the fourth order weights, giving the error estimate
+	constexpr double ErrorWeights[NumStages] =
+	{
+		71.0 / 57600.0, 0.0, -71.0 / 16695.0, 71.0 / 1920.0, -17253.0 / 339200.0, 22.0 / 525.0, -1.0 / 40.0,
+	};
+
+	// Bounds of the substep's change after each attempt, and the safety factor applied to the predicted substep
+	constexpr double MinSubstepScale = 0.2;
+	constexpr double MaxSubstepScale = 5.0;
+	constexpr double SubstepSafety = 0.9;
+
+	// Smallest substep, relative to the step. Substeps reaching it are accepted whatever their error, so the step always ends
+	constexpr double MinSubstepRatio = 1.0 / 4096.0;
+
+	double GetLength(const FVectorHybrid& Vector)
+	{
+		return std::sqrt(FMath::Square(Vector.X.ToDouble()) + FMath::Square(Vector.Y.ToDouble()) + FMath::Square(Vector.Z.ToDouble()));
+	}
+
+	// States at the start of the substep, and the derivatives at each stage, for each body of the batch
+	struct FDormandPrinceStages
+	{
+		TArray<FVectorFloat> StartLocations;
+		TArray<FVectorHybrid> StartVelocities;
+		TArray<FVectorHybrid> Velocities[NumStages];
+		TArray<FVectorHybrid> Accelerations[NumStages];
+
+		void SetNum(int32 Num)
+		{
+			StartLocations.SetNum(Num, false);
+			StartVelocities.SetNum(Num, false);
+			for (int32 Stage = 0; Stage < NumStages; Stage++)
+			{
+				Velocities[Stage].SetNum(Num, false);
+				Accelerations[Stage].SetNum(Num, false);
+			}
+		}
+	};
+}
+
+void FSpaceIntegrators::EvaluateAccelerations(FSpaceBodyStates& States, int32 First, int32 Num, const FSpaceAccelerationFunction& Accelerations)
+{
+	TArrayView<FVectorHybrid> OutAccelerations(States.Accelerations.GetData() + First, Num);
+	if (Accelerations)
+	{
+		Accelerations(States, First, Num, OutAccelerations);
+	}
+	else
+	{
+		for (FVectorHybrid& Acceleration : OutAccelerations)
+		{
+			Acceleration = FVectorHybrid();
+		}
+	}
+}
+
+void FSpaceIntegrators::StepSemiImplicitEuler(FSpaceBodyStates& States, int32 First, int32 Num, double Step, const FSpaceAccelerationFunction& Accelerations)
+{
+	const FRealHybrid H(Step);
+	for (int32 Index = First; Index < First + Num; Index++)
+	{
+		States.Velocities[Index] += States.Accelerations[Index] * H;
+		States.Locations[Index] += States.Velocities[Index] * H;
+	}
+	EvaluateAccelerations(States, First, Num, Accelerations);
+}
+
+void FSpaceIntegrators::StepVelocityVerlet(FSpaceBodyStates& States, int32 First, int32 Num, double Step, const FSpaceAccelerationFunction& Accelerations)
+{
+	const FRealHybrid H(Step);
+	const FRealHybrid HalfH(0.5 * Step);
+	for (int32 Index = First; Index < First + Num; Index++)
+	{
+		States.Velocities[Index] += States.Accelerations[Index] * HalfH;
+		States.Locations[Index] += States.Velocities[Index] * H;
+	}
+	EvaluateAccelerations(States, First, Num, Accelerations);
+	for (int32 Index = First; Index < First + Num; Index++)
+	{
+		States.Velocities[Index] += States.Accelerations[Index] * HalfH;
+	}
+}
+
+int32 FSpaceIntegrators::StepDormandPrince(FSpaceBodyStates& States, int32 First, int32 Num, double Step, double Tolerance, double& InOutSubstep, const FSpaceAccelerationFunction& Accelerations)
+{
+	using namespace SpaceIntegration;
+
+	if (Num <= 0) return 0;
+
+	FDormandPrinceStages Stages;
+	Stages.SetNum(Num);
+
+	// The first stage is the current state. Stages are stored relative to First
+	for (int32 Body = 0; Body < Num; Body++)
+	{
+		Stages.StartLocations[Body] = States.Locations[First + Body];
+		Stages.StartVelocities[Body] = States.Velocities[First + Body];
+		Stages.Velocities[0][Body] = States.Velocities[First + Body];
+		Stages.Accelerations[0][Body] = States.Accelerations[First + Body];
+	}
+
+	const double MinSubstep = Step * MinSubstepRatio;
+	double Substep = FMath::Clamp(InOutSubstep, MinSubstep, Step);
+	double Time = 0;
+	int32 NumSubsteps = 0;
+	while (Time < Step)
+	{
+		// Don't step past the end, but keep the predicted substep for the next one
+		const bool bLast = Time + Substep >= Step;
+		const double H = bLast ? Step - Time : Substep;
+
+		// Stages 2 to 7. Each stage's state is written to the states, where the acceleration function reads it
+		for (int32 Stage = 1; Stage < NumStages; Stage++)
+		{
+			for (int32 Body = 0; Body < Num; Body++)
+			{
+				FVectorHybrid Displacement, VelocityChange;
+				for (int32 Previous = 0; Previous < Stage; Previous++)
+				{
+					const double Weight = StageWeights[Stage][Previous];
+					if (Weight == 0) continue;
+
+					const FRealHybrid WeightH(Weight * H);
+					Displacement += Stages.Velocities[Previous][Body] * WeightH;
+					VelocityChange += Stages.Accelerations[Previous][Body] * WeightH;
+				}
+				States.Locations[First + Body] = Stages.StartLocations[Body] + FVectorFloat(Displacement);
+				States.Velocities[First + Body] = Stages.StartVelocities[Body] + VelocityChange;
+				Stages.Velocities[Stage][Body] = States.Velocities[First + Body];
+			}
+			EvaluateAccelerations(States, First, Num, Accelerations);
+			for (int32 Body = 0; Body < Num; Body++)
+			{
+				Stages.Accelerations[Stage][Body] = States.Accelerations[First + Body];
+			}
+		}
+
+		// Largest error of the batch, relative to the tolerance. Velocity errors count for the distance they make the body drift over the substep
+		double Error = 0;
+		for (int32 Body = 0; Body < Num; Body++)
+		{
+			FVectorHybrid LocationError, VelocityError;
+			for (int32 Stage = 0; Stage < NumStages; Stage++)
+			{
+				if (ErrorWeights[Stage] == 0) continue;
+
+				const FRealHybrid WeightH(ErrorWeights[Stage] * H);
+				LocationError += Stages.Velocities[Stage][Body] * WeightH;
+				VelocityError += Stages.Accelerations[Stage][Body] * WeightH;
+			}
+			Error = FMath::Max(Error, (GetLength(LocationError) + GetLength(VelocityError) * H) / Tolerance);
+		}
+
+		const double Scale = Error > 0 ? SubstepSafety * FMath::Pow(Error, -0.2) : MaxSubstepScale;
+		if (Error <= 1 || H <= MinSubstep)
+		{
+			// The last stage is the new state: start the next substep from it
+			Time = bLast ? Step : Time + H;
+			NumSubsteps++;
+			for (int32 Body = 0; Body < Num; Body++)
+			{
+				Stages.StartLocations[Body] = States.Locations[First + Body];
+				Stages.StartVelocities[Body] = States.Velocities[First + Body];
+				Stages.Velocities[0][Body] = Stages.Velocities[NumStages - 1][Body];
+				Stages.Accelerations[0][Body] = Stages.Accelerations[NumStages - 1][Body];
+			}
+			// The last substep may have been shortened to end the step: then only keep the predicted substep if the error allows it
+			const double NextSubstep = FMath::Max(H * FMath::Clamp(Scale, MinSubstepScale, MaxSubstepScale), MinSubstep);
+			Substep = bLast && H < Substep ? FMath::Min(Substep, FMath::Max(NextSubstep, H * Scale)) : NextSubstep;
+		}
+		else
+		{
+			Substep = FMath::Max(H * FMath::Clamp(Scale, MinSubstepScale, 1.0), MinSubstep);
+		}
+	}
+
+	// The loop only ends on an accepted substep, so the states are the ones it ended on
+	InOutSubstep = Substep;
+	return NumSubsteps;
+}
@@ -0,0 +1,262 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "SpaceKit/Public/SpaceKitSubsystem.h"
+
+#include "Engine/World.h"
+#include "Subsystems/SubsystemCollection.h"
+
+#include "SpaceKit/Public/SpaceFloatingOriginSubsystem.h"
+#include "SpaceKit/Public/SpaceMovementComponent.h"
+#include "SpaceKit/Public/SpaceTransformComponent.h"
+#include "SpaceKitPrecision/Public/QuatFloat.h"
+
+
+void USpaceKitSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	FloatingOrigin = Cast<USpaceFloatingOriginSubsystem>(Collection.InitializeDependency(USpaceFloatingOriginSubsystem::StaticClass()));
+}
+
+void USpaceKitSubsystem::SetAccelerationFunction(FSpaceAccelerationFunction Function)
+{
+	AccelerationFunction = MoveTemp(Function);
+	bAccelerationsValid = false;
+}
+
+int32 USpaceKitSubsystem::FindOrAddBody(AActor* Owner)
+{
+	if (const int32* ExistingIndex = BodyIndices.Find(Owner))
+	{
+		return *ExistingIndex;
+	}
+
+	const int32 Index = FreeIndices.Num() > 0 ? FreeIndices.Pop(false) : Bodies.AddDefaulted();
+	Bodies[Index].Owner = Owner;
+	BodyIndices.Add(Owner, Index);
+	return Index;
+}
+
+void USpaceKitSubsystem::ReleaseBody(int32 Index)
+{
+	FSpaceKitBody& Body = Bodies[Index];
+	if (Body.Transform != nullptr || Body.Movement != nullptr) return;
+
+	BodyIndices.Remove(Body.Owner);
+	Body = FSpaceKitBody();
+	FreeIndices.Add(Index);
+}
+
+void USpaceKitSubsystem::RegisterTransform(USpaceTransformComponent* Component)
+{
+	if (Component == nullptr || Component->SpaceKitBodyIndex != INDEX_NONE || Component->GetOwner() == nullptr) return;
+
+	const int32 Index = FindOrAddBody(Component->GetOwner());
+	Bodies[Index].Transform = Component;
+	Component->SpaceKitBodyIndex = Index;
+	NumComponents++;
+	bAccelerationsValid = false;
+
+	if (FloatingOrigin)
+	{
+		FloatingOrigin->Register(Component);
+	}
+}
+
+void USpaceKitSubsystem::UnregisterTransform(USpaceTransformComponent* Component)
+{
+	if (Component == nullptr || !Bodies.IsValidIndex(Component->SpaceKitBodyIndex) || Bodies[Component->SpaceKitBodyIndex].Transform != Component) return;
+
+	if (FloatingOrigin)
+	{
+		FloatingOrigin->Unregister(Component);
+	}
+
+	const int32 Index = Component->SpaceKitBodyIndex;
+	Bodies[Index].Transform = nullptr;
+	Component->SpaceKitBodyIndex = INDEX_NONE;
+	NumComponents--;
+	bAccelerationsValid = false;
+	ReleaseBody(Index);
+}
+
+void USpaceKitSubsystem::RegisterMovement(USpaceMovementComponent* Component)
+{
+	if (Component == nullptr || Component->SpaceKitBodyIndex != INDEX_NONE || Component->GetOwner() == nullptr) return;
+
+	const int32 Index = FindOrAddBody(Component->GetOwner());
+	Bodies[Index].Movement = Component;
+	Component->SpaceKitBodyIndex = Index;
+	NumComponents++;
+	bAccelerationsValid = false;
+}
+
+void USpaceKitSubsystem::UnregisterMovement(USpaceMovementComponent* Component)
+{
+	if (Component == nullptr || !Bodies.IsValidIndex(Component->SpaceKitBodyIndex) || Bodies[Component->SpaceKitBodyIndex].Movement != Component) return;
+
+	const int32 Index = Component->SpaceKitBodyIndex;
+	Bodies[Index].Movement = nullptr;
+	Component->SpaceKitBodyIndex = INDEX_NONE;
+	NumComponents--;
+	bAccelerationsValid = false;
+	ReleaseBody(Index);
+}
+
+void USpaceKitSubsystem::GatherStates()
+{
+	// Counting sort of the moving bodies by integrator, so each batch is contiguous
+	int32 Counts[int32(ESpaceIntegrator::Num)] = { };
+	ForEachMovingBody([&Counts](const USpaceTransformComponent& Transform, const USpaceMovementComponent& Movement)
+	{
+		Counts[FMath::Clamp(int32(Movement.Integrator), 0, int32(ESpaceIntegrator::Num) - 1)]++;
+	});
+
+	BatchStarts[0] = 0;
+	for (int32 Integrator = 0; Integrator < int32(ESpaceIntegrator::Num); Integrator++)
+	{
+		BatchStarts[Integrator + 1] = BatchStarts[Integrator] + Counts[Integrator];
+	}
+
+	const int32 NumStates = BatchStarts[int32(ESpaceIntegrator::Num)];
+	bool bKeepAccelerations = bAccelerationsValid && States.Num() == NumStates;
+	States.SetNum(NumStates);
+	StateBodies.SetNum(NumStates, false);
+
+	int32 NumStaticBodies = 0;
+	int32 Next[int32(ESpaceIntegrator::Num)];
+	FMemory::Memcpy(Next, BatchStarts, sizeof(Next));
+	for (int32 BodyIndex = 0; BodyIndex < Bodies.Num(); BodyIndex++)
+	{
+		const FSpaceKitBody& Body = Bodies[BodyIndex];
+		if (Body.Transform == nullptr) continue;
+
+		if (Body.Movement == nullptr)
+		{
+			if (NumStaticBodies == StaticBodies.Num())
+			{
+				StaticBodies.AddUninitialized();
+				bKeepAccelerations = false;
+			}
+			FStaticBody& StaticBody = StaticBodies[NumStaticBodies++];
+			bKeepAccelerations = bKeepAccelerations && StaticBody.BodyIndex == BodyIndex && StaticBody.Location == Body.Transform->Location && StaticBody.Mass == Body.Transform->Mass;
+			StaticBody.BodyIndex = BodyIndex;
+			StaticBody.Location = Body.Transform->Location;
+			StaticBody.Mass = Body.Transform->Mass;
+			continue;
+		}
+
+		// Bodies the simulation left alone are in the same order, where it moved them
+		const int32 Index = Next[FMath::Clamp(int32(Body.Movement->Integrator), 0, int32(ESpaceIntegrator::Num) - 1)]++;
+		const FVectorHybrid Velocity(Body.Movement->SpaceVelocity);
+		const FRealHybrid Mass(Body.Transform->Mass);
+		bKeepAccelerations = bKeepAccelerations && StateBodies[Index] == BodyIndex && States.Locations[Index] == Body.Transform->Location && States.Velocities[Index] == Velocity && States.Masses[Index] == Mass;
+		States.Locations[Index] = Body.Transform->Location;
+		States.Velocities[Index] = Velocity;
+		States.Masses[Index] = Mass;
+		StateBodies[Index] = BodyIndex;
+	}
+	bKeepAccelerations = bKeepAccelerations && NumStaticBodies == StaticBodies.Num();
+	StaticBodies.SetNum(NumStaticBodies, false);
+
+	// Integrators expect the accelerations at the current locations
+	if (!bKeepAccelerations)
+	{
+		FSpaceIntegrators::EvaluateAccelerations(States, 0, NumStates, AccelerationFunction);
+	}
+	bAccelerationsValid = true;
+}
+
+void USpaceKitSubsystem::Simulate(int32 NumSteps)
+{
+	const int32 EulerFirst = BatchStarts[int32(ESpaceIntegrator::SemiImplicitEuler)];
+	const int32 VerletFirst = BatchStarts[int32(ESpaceIntegrator::VelocityVerlet)];
+	const int32 DormandPrinceFirst = BatchStarts[int32(ESpaceIntegrator::DormandPrince)];
+	const int32 End = BatchStarts[int32(ESpaceIntegrator::Num)];
+
+	if (DormandPrinceSubstep <= 0)
+	{
+		DormandPrinceSubstep = FixedTimeStep;
+	}
+
+	for (int32 Step = 0; Step < NumSteps; Step++)
+	{
+		FSpaceIntegrators::StepSemiImplicitEuler(States, EulerFirst, VerletFirst - EulerFirst, FixedTimeStep, AccelerationFunction);
+		FSpaceIntegrators::StepVelocityVerlet(States, VerletFirst, DormandPrinceFirst - VerletFirst, FixedTimeStep, AccelerationFunction);
+		FSpaceIntegrators::StepDormandPrince(States, DormandPrinceFirst, End - DormandPrinceFirst, FixedTimeStep, IntegrationTolerance, DormandPrinceSubstep, AccelerationFunction);
+	}
+}
+
+void USpaceKitSubsystem::ScatterStates(double SimulatedTime)
+{
+	for (int32 Index = 0; Index < States.Num(); Index++)
+	{
+		const FSpaceKitBody& Body = Bodies[StateBodies[Index]];
+		Body.Transform->Location = States.Locations[Index];
+		Body.Movement->SpaceVelocity = States.Velocities[Index];
+
+		// Angular velocities don't change during the steps, so the rotation is turned once, by the whole time
+		const FRealFloat AngularSpeed = Body.Movement->SpaceAngularVelocity.Size();
+		if (AngularSpeed > 0_fl)
+		{
+			const FQuatFloat Turn(Body.Movement->SpaceAngularVelocity / AngularSpeed, AngularSpeed * FRealFloat(SimulatedTime));
+			Body.Transform->Rotation = FRotatorFloat(Turn * FQuatFloat(Body.Transform->Rotation));
+		}
+	}
+}
+
+void USpaceKitSubsystem::UpdateBodies(float DeltaTime)
+{
+	// Run the steps the accumulated time holds
+	if (FixedTimeStep > 0)
+	{
+		TimeAccumulator += DeltaTime;
+		int32 NumSteps = int32(FMath::FloorToDouble(TimeAccumulator / FixedTimeStep));
+		if (NumSteps > MaxStepsPerFrame)
+		{
+			NumSteps = FMath::Max(MaxStepsPerFrame, 0);
+			TimeAccumulator = 0;
+		}
+		else
+		{
+			TimeAccumulator -= NumSteps * double(FixedTimeStep);
+		}
+
+		if (NumSteps > 0)
+		{
+			GatherStates();
+			Simulate(NumSteps);
+			ScatterStates(NumSteps * double(FixedTimeStep));
+		}
+	}
+
+	// Place the actors, once all the bodies have moved
+	if (FloatingOrigin)
+	{
+		FloatingOrigin->UpdateRenderTransforms();
+	}
+}
+
+void USpaceKitSubsystem::Tick(float DeltaTime)
+{
+	UpdateBodies(DeltaTime);
+}
+
+ETickableTickType USpaceKitSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool USpaceKitSubsystem::IsTickable() const
+{
+	return NumComponents > 0;
+}
+
+TStatId USpaceKitSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USpaceKitSubsystem, STATGROUP_Tickables);
+}
+
+UWorld* USpaceKitSubsystem::GetTickableGameObjectWorld() const
+{
+	return GetWorld();
+}
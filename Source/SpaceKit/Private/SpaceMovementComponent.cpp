@@ -4,13 +4,16 @@
 #include "SpaceMovementComponent.h"
 
 
+#include "Engine/World.h"
+
 #include "QuatFloat.h"
-#include "SpaceGameState.h"
+#include "SpaceKitSubsystem.h"
 #include "SpaceTransformComponent.h"
 
 
 USpaceMovementComponent::USpaceMovementComponent()
 {
+	PrimaryComponentTick.bCanEverTick = false;
 	bWantsInitializeComponent = true;
 	SpaceMass = 500.0_fl;
 }
@@ -23,16 +26,43 @@ void USpaceMovementComponent::InitializeComponent()
 }
 
 
-// Called every frame
-void USpaceMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void USpaceMovementComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	auto* World = GetWorld();
+	auto* SpaceKit = World ? World->GetSubsystem<USpaceKitSubsystem>() : nullptr;
+	if (SpaceKit)
+	{
+		SpaceKit->RegisterMovement(this);
+	}
+}
+
+void USpaceMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	auto* World = GetWorld();
+	auto* SpaceKit = World ? World->GetSubsystem<USpaceKitSubsystem>() : nullptr;
+	if (SpaceKit)
+	{
+		SpaceKit->UnregisterMovement(this);
+	}
 
-	;
+	Super::EndPlay(EndPlayReason);
 }
 
 USpaceTransformComponent* USpaceMovementComponent::GetSpaceUpdatedComponent()
 {
+	if (SpaceKitBodyIndex != INDEX_NONE)
+	{
+		auto* World = GetWorld();
+		auto* SpaceKit = World ? World->GetSubsystem<USpaceKitSubsystem>() : nullptr;
+		auto* Transform = SpaceKit ? SpaceKit->GetBody(SpaceKitBodyIndex).Transform : nullptr;
+		if (Transform)
+		{
+			return Transform;
+		}
+	}
+
 	auto* Owner = GetOwner(); if (Owner == nullptr) return nullptr;
-	return Cast<USpaceTransformComponent>(Owner->GetComponentByClass(USpaceTransformComponent::StaticClass()));
+	return Owner->FindComponentByClass<USpaceTransformComponent>();
 }
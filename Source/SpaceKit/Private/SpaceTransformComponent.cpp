@@ -3,6 +3,10 @@
 
 #include "SpaceTransformComponent.h"
 
+#include "Engine/World.h"
+
+#include "SpaceKit/Public/SpaceKitSubsystem.h"
+
 USpaceTransformComponent::USpaceTransformComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -24,10 +28,31 @@ void USpaceTransformComponent::BeginPlay()
 	CachedLocation = Location.ToFVector();
 	CachedRotation = Rotation.ToFRotator();
 #endif
+
+	// The SpaceKit subsystem updates the actor from now on, along with all the others, and the floating origin places it
+	auto* World = GetWorld();
+	auto* SpaceKit = World ? World->GetSubsystem<USpaceKitSubsystem>() : nullptr;
+	if (SpaceKit)
+	{
+		SpaceKit->RegisterTransform(this);
+		SetComponentTickEnabled(false);
+	}
+}
+
+void USpaceTransformComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	auto* World = GetWorld();
+	auto* SpaceKit = World ? World->GetSubsystem<USpaceKitSubsystem>() : nullptr;
+	if (SpaceKit)
+	{
+		SpaceKit->UnregisterTransform(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 
-// Called every frame
+// Called every frame, while not placed by the floating origin, e.g. in the editor
 void USpaceTransformComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
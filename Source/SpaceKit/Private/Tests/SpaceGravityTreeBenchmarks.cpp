@@ -0,0 +1,51 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Containers/UnrealString.h"
+#include "Core/Public/Misc/AutomationTest.h"
+#include "Core/Public/HAL/PlatformTime.h"
+
+#include "SpaceKit/Public/SpaceGravityTree.h"
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpaceKitGravityTreeBenchmark, "SpaceKit.Benchmarks.GravityTree", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpaceKitGravityTreeBenchmark::RunTest(const FString& Parameters)
+{
+	// A system an astronomical unit wide, in centimeters, far from the world's origin: a hundred massive bodies among small ones
+	const FVectorFloat Center(FRealFloat(3e16), FRealFloat(-1e15), FRealFloat(2e14));
+	const double GravitationalConstant = 6.674e-5;
+	const double OpeningAngle = 0.5;
+	const double Softening = 1e5;
+
+	FRandomStream Random(5);
+	TArray<FVectorFloat> Locations;
+	TArray<double> Masses;
+	TArray<FVectorHybrid> Accelerations;
+	FSpaceGravityTree Tree;
+	for (const int32 NumBodies : { 1000, 10000, 100000, 1000000 })
+	{
+		while (Locations.Num() < NumBodies)
+		{
+			const FVector Offset = Random.GetUnitVector() * float(1.5e13 * FMath::Pow(Random.GetFraction(), 1.0 / 3.0));
+			Locations.Add(Center + FVectorFloat(Offset));
+			Masses.Add(Locations.Num() <= 100 ? 1e27 : 1e20);
+		}
+		Accelerations.SetNum(NumBodies);
+
+		const double BuildStart = FPlatformTime::Seconds();
+		Tree.Build(Locations, Masses);
+		const double EvaluateStart = FPlatformTime::Seconds();
+		Tree.ComputeAccelerations(Locations, GravitationalConstant, OpeningAngle, Softening, Accelerations);
+		const double End = FPlatformTime::Seconds();
+
+		AddInfo(FString::Printf(TEXT("%d bodies: build %.1f ms, accelerations %.1f ms (%.0f ns per body), %d nodes. Checksum: %s"),
+			NumBodies, (EvaluateStart - BuildStart) * 1e3, (End - EvaluateStart) * 1e3, (End - EvaluateStart) * 1e9 / NumBodies, Tree.GetNumNodes(), *Accelerations[NumBodies / 2].ToString()));
+	}
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
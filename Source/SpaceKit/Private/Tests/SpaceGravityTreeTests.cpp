@@ -0,0 +1,150 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Containers/UnrealString.h"
+#include "Core/Public/Misc/AutomationTest.h"
+
+#include "SpaceKit/Public/SpaceGravityTree.h"
+
+#include <cmath>
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SpaceKitGravityTreeTest
+{
+	const double GravitationalConstant = 6.674e-5;
+
+	struct FDoubleVector
+	{
+		double X, Y, Z;
+
+		FDoubleVector operator+(const FDoubleVector& Other) const { return { X + Other.X, Y + Other.Y, Z + Other.Z }; }
+		FDoubleVector operator-(const FDoubleVector& Other) const { return { X - Other.X, Y - Other.Y, Z - Other.Z }; }
+		FDoubleVector operator*(double Scale) const { return { X * Scale, Y * Scale, Z * Scale }; }
+		double SizeSquared() const { return X * X + Y * Y + Z * Z; }
+		double Size() const { return std::sqrt(SizeSquared()); }
+	};
+
+	// A cluster far from the world's origin, with a few massive bodies among light ones, and a massless one
+	void MakeCluster(int32 Num, FRandomStream& Random, TArray<FVectorFloat>& OutLocations, TArray<double>& OutMasses)
+	{
+		const FVectorFloat Center(FRealFloat(3e16), FRealFloat(-1e15), FRealFloat(2e14));
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			const FVector Offset = Random.GetUnitVector() * float(1e12 * FMath::Square(Random.GetFraction()));
+			OutLocations.Add(Center + FVectorFloat(Offset));
+			OutMasses.Add(Index < 8 ? 1e26 : Index == 8 ? 0 : 1e20 * (1 + Random.GetFraction()));
+		}
+	}
+
+	// Direct sum, in double relative to the first body
+	FDoubleVector DirectAcceleration(const TArray<FVectorFloat>& Locations, const TArray<double>& Masses, int32 Target, double Softening)
+	{
+		const auto GetOffset = [&](int32 Index)
+		{
+			const FVectorFloat Offset = Locations[Index] - Locations[0];
+			return FDoubleVector{ Offset.X.ToDouble(), Offset.Y.ToDouble(), Offset.Z.ToDouble() };
+		};
+
+		const FDoubleVector TargetLocation = GetOffset(Target);
+		FDoubleVector Acceleration{ 0, 0, 0 };
+		for (int32 Index = 0; Index < Locations.Num(); Index++)
+		{
+			const FDoubleVector Offset = GetOffset(Index) - TargetLocation;
+			const double DistanceSquared = Offset.SizeSquared() + Softening * Softening;
+			if (DistanceSquared > 0)
+			{
+				Acceleration = Acceleration + Offset * (Masses[Index] / (DistanceSquared * std::sqrt(DistanceSquared)));
+			}
+		}
+		return Acceleration * GravitationalConstant;
+	}
+
+	FDoubleVector ToDouble(const FVectorHybrid& Vector)
+	{
+		return FDoubleVector{ Vector.X.ToDouble(), Vector.Y.ToDouble(), Vector.Z.ToDouble() };
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpaceKitGravityTreeTest, "SpaceKit.Gravity.BarnesHut", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpaceKitGravityTreeTest::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitGravityTreeTest;
+
+	FSpaceGravityTree Tree;
+	TArray<FVectorHybrid> Accelerations;
+
+	// Two bodies a kilometer apart, farther from the world's origin than doubles can place them to the centimeter
+	{
+		const FVectorFloat Far(FRealFloat(1e18), FRealFloat(1e18), FRealFloat(-1e18));
+		const TArray<FVectorFloat> Locations = { Far + FVectorFloat(FRealFloat(0.5), FRealFloat(0), FRealFloat(0)), Far + FVectorFloat(FRealFloat(100000.5), FRealFloat(0), FRealFloat(0)) };
+		const TArray<double> Masses = { 1e20, 1e22 };
+		Tree.Build(Locations, Masses);
+		Accelerations.SetNum(2);
+		Tree.ComputeAccelerations(Locations, GravitationalConstant, 0.5, 0, Accelerations);
+		TestEqual(TEXT("Far pair, attracted"), Accelerations[0].X.ToDouble(), GravitationalConstant * 1e22 / 1e10, 1e-12 * GravitationalConstant * 1e22 / 1e10);
+		TestEqual(TEXT("Far pair, attracting"), Accelerations[1].X.ToDouble(), -GravitationalConstant * 1e20 / 1e10, 1e-12 * GravitationalConstant * 1e20 / 1e10);
+		TestTrue(TEXT("Far pair, no sideways acceleration"), Accelerations[0].Y.ToDouble() == 0 && Accelerations[0].Z.ToDouble() == 0);
+	}
+
+	// Enough bodies for the subtrees to be built in parallel
+	FRandomStream Random(11);
+	TArray<FVectorFloat> Locations;
+	TArray<double> Masses;
+	MakeCluster(5000, Random, Locations, Masses);
+	Tree.Build(Locations, Masses);
+	TestEqual(TEXT("Bodies count"), Tree.GetNumBodies(), Locations.Num());
+	Accelerations.SetNum(Locations.Num());
+
+	// Without approximation, the tree sums every body
+	const double Softening = 1e6;
+	Tree.ComputeAccelerations(Locations, GravitationalConstant, 0, Softening, Accelerations);
+	for (int32 Index = 0; Index < Locations.Num(); Index += 97)
+	{
+		const FDoubleVector Expected = DirectAcceleration(Locations, Masses, Index, Softening);
+		const double Error = (ToDouble(Accelerations[Index]) - Expected).Size() / Expected.Size();
+		TestTrue(FString::Printf(TEXT("Direct sum of body %d: relative error %g"), Index, Error), Error < 1e-9);
+	}
+
+	// The approximation's error shrinks with the opening angle
+	double PreviousError = MAX_dbl;
+	for (const double OpeningAngle : { 1.0, 0.5, 0.25 })
+	{
+		Tree.ComputeAccelerations(Locations, GravitationalConstant, OpeningAngle, Softening, Accelerations);
+		double ErrorSquaredSum = 0;
+		int32 NumSamples = 0;
+		for (int32 Index = 0; Index < Locations.Num(); Index += 97)
+		{
+			const FDoubleVector Expected = DirectAcceleration(Locations, Masses, Index, Softening);
+			ErrorSquaredSum += (ToDouble(Accelerations[Index]) - Expected).SizeSquared() / Expected.SizeSquared();
+			NumSamples++;
+		}
+		const double Error = std::sqrt(ErrorSquaredSum / NumSamples);
+		TestTrue(FString::Printf(TEXT("Opening angle %g: RMS relative error %g"), OpeningAngle, Error), Error < 0.02 * OpeningAngle && Error < PreviousError);
+		PreviousError = Error;
+	}
+
+	// Locations that aren't bodies, even out of the tree, get the same acceleration as from a body there
+	TArray<FVectorFloat> Probes = { Locations[0] + FVectorFloat(FRealFloat(0), FRealFloat(0), FRealFloat(1e14)) };
+	Accelerations.SetNum(1);
+	Tree.ComputeAccelerations(Probes, GravitationalConstant, 0, Softening, Accelerations);
+	Locations.Add(Probes[0]);
+	Masses.Add(0);
+	const FDoubleVector Expected = DirectAcceleration(Locations, Masses, Locations.Num() - 1, Softening);
+	TestTrue(TEXT("Location out of the tree"), (ToDouble(Accelerations[0]) - Expected).Size() < 1e-9 * Expected.Size());
+
+	// No body, no acceleration
+	Tree.Build(TArray<FVectorFloat>(), TArray<double>());
+	Tree.ComputeAccelerations(Probes, GravitationalConstant, 0.5, Softening, Accelerations);
+	TestTrue(TEXT("Empty tree"), Accelerations[0] == FVectorHybrid());
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+#endif //WITH_DEV_AUTOMATION_TESTS
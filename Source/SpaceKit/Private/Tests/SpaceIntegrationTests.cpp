@@ -0,0 +1,241 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Containers/UnrealString.h"
+#include "Core/Public/Misc/AutomationTest.h"
+
+#include "SpaceKit/Public/SpaceIntegration.h"
+
+#include <cmath>
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SpaceKitIntegrationTest
+{
+	// A star far from the world's origin, and the speed and period of a circular orbit around it. Lengths are in centimeters
+	const FVectorFloat Center(FRealFloat(1e16), FRealFloat(-3e15), FRealFloat(0));
+	const double Mu = 4e24;
+	const double Radius = 1e9;
+	const double Speed = std::sqrt(Mu / Radius);
+	const double Period = 2 * PI * Radius / Speed;
+
+	FSpaceAccelerationFunction MakeCentralGravity()
+	{
+		return [](const FSpaceBodyStates& States, int32 First, int32 Num, TArrayView<FVectorHybrid> OutAccelerations)
+		{
+			for (int32 Index = 0; Index < Num; Index++)
+			{
+				const FVectorFloat Offset = States.Locations[First + Index] - Center;
+				const double X = Offset.X.ToDouble(), Y = Offset.Y.ToDouble(), Z = Offset.Z.ToDouble();
+				const double Distance = std::sqrt(X * X + Y * Y + Z * Z);
+				const double Scale = -Mu / (Distance * Distance * Distance);
+				OutAccelerations[Index] = FVectorHybrid(X * Scale, Y * Scale, Z * Scale);
+			}
+		};
+	}
+
+	FSpaceAccelerationFunction MakeConstantAcceleration(const FVectorHybrid& Acceleration)
+	{
+		return [Acceleration](const FSpaceBodyStates& States, int32 First, int32 Num, TArrayView<FVectorHybrid> OutAccelerations)
+		{
+			for (FVectorHybrid& OutAcceleration : OutAccelerations)
+			{
+				OutAcceleration = Acceleration;
+			}
+		};
+	}
+
+	// One body on a circular orbit, in the XY plane, with its acceleration
+	void MakeOrbit(FSpaceBodyStates& States, const FSpaceAccelerationFunction& Gravity)
+	{
+		States.SetNum(1);
+		States.Locations[0] = Center + FVectorFloat(FRealFloat(Radius), FRealFloat(0), FRealFloat(0));
+		States.Velocities[0] = FVectorHybrid(0.0, Speed, 0.0);
+		FSpaceIntegrators::EvaluateAccelerations(States, 0, 1, Gravity);
+	}
+
+	// Specific orbital energy, relative to the circular orbit's
+	double GetEnergyError(const FSpaceBodyStates& States)
+	{
+		const FVectorFloat Offset = States.Locations[0] - Center;
+		const double Distance = std::sqrt(FMath::Square(Offset.X.ToDouble()) + FMath::Square(Offset.Y.ToDouble()) + FMath::Square(Offset.Z.ToDouble()));
+		const FVectorHybrid& Velocity = States.Velocities[0];
+		const double SpeedSquared = FMath::Square(Velocity.X.ToDouble()) + FMath::Square(Velocity.Y.ToDouble()) + FMath::Square(Velocity.Z.ToDouble());
+		const double Energy = SpeedSquared / 2 - Mu / Distance;
+		const double Expected = -Mu / (2 * Radius);
+		return FMath::Abs(Energy / Expected - 1);
+	}
+
+	// Distance to where the body is on the exact orbit, after Time
+	double GetLocationError(const FSpaceBodyStates& States, double Time)
+	{
+		const double Angle = Time * Speed / Radius;
+		const FVectorFloat Offset = States.Locations[0] - Center;
+		return std::sqrt(FMath::Square(Offset.X.ToDouble() - Radius * std::cos(Angle)) + FMath::Square(Offset.Y.ToDouble() - Radius * std::sin(Angle)) + FMath::Square(Offset.Z.ToDouble()));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpaceKitIntegrationConstantAccelerationTest, "SpaceKit.Integration.ConstantAcceleration", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpaceKitIntegrationConstantAccelerationTest::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitIntegrationTest;
+
+	// Binary fractions, so every sum and product the integrators make is exact, even far from the world's origin
+	const FVectorFloat StartLocation = Center + FVectorFloat(FRealFloat(3.0), FRealFloat(-0.5), FRealFloat(2e12));
+	const FVectorHybrid StartVelocity(8.0, 0.0, -16.0);
+	const FVectorHybrid Acceleration(2.0, -0.5, 4.0);
+	const FSpaceAccelerationFunction Constant = MakeConstantAcceleration(Acceleration);
+	const int32 NumSteps = 64;
+	const double Step = 1.0 / NumSteps;
+
+	const auto MakeStates = [&](FSpaceBodyStates& States)
+	{
+		States.SetNum(1);
+		States.Locations[0] = StartLocation;
+		States.Velocities[0] = StartVelocity;
+		FSpaceIntegrators::EvaluateAccelerations(States, 0, 1, Constant);
+	};
+
+	// The semi-implicit Euler's drifts use the kicked velocities: after n steps, the displacement is v t + a h^2 n (n + 1) / 2
+	FSpaceBodyStates Euler;
+	MakeStates(Euler);
+	for (int32 Index = 0; Index < NumSteps; Index++)
+	{
+		FSpaceIntegrators::StepSemiImplicitEuler(Euler, 0, 1, Step, Constant);
+	}
+	const double EulerFactor = Step * Step * NumSteps * (NumSteps + 1) / 2;
+	TestTrue(TEXT("Euler location"), Euler.Locations[0] == StartLocation + FVectorFloat(StartVelocity) + FVectorFloat(Acceleration * FRealHybrid(EulerFactor)));
+	TestTrue(TEXT("Euler velocity"), Euler.Velocities[0] == StartVelocity + Acceleration);
+
+	// The velocity Verlet is exact for constant accelerations: the displacement is v t + a t^2 / 2
+	FSpaceBodyStates Verlet;
+	MakeStates(Verlet);
+	for (int32 Index = 0; Index < NumSteps; Index++)
+	{
+		FSpaceIntegrators::StepVelocityVerlet(Verlet, 0, 1, Step, Constant);
+	}
+	TestTrue(TEXT("Verlet location"), Verlet.Locations[0] == StartLocation + FVectorFloat(StartVelocity) + FVectorFloat(Acceleration * FRealHybrid(0.5)));
+	TestTrue(TEXT("Verlet velocity"), Verlet.Velocities[0] == StartVelocity + Acceleration);
+	TestTrue(TEXT("Verlet acceleration"), Verlet.Accelerations[0] == Acceleration);
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpaceKitIntegrationOrbitEnergyTest, "SpaceKit.Integration.OrbitEnergy", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpaceKitIntegrationOrbitEnergyTest::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitIntegrationTest;
+
+	const FSpaceAccelerationFunction Gravity = MakeCentralGravity();
+
+	// 20 orbits of 64 steps. The symplectic integrators' energy error oscillates without drifting, so check its largest value over all the steps
+	const int32 StepsPerOrbit = 64;
+	const int32 NumSteps = 20 * StepsPerOrbit;
+	const double Step = Period / StepsPerOrbit;
+	const double Tolerance = 1;
+
+	double MaxErrors[int32(ESpaceIntegrator::Num)] = { };
+	double LocationErrors[int32(ESpaceIntegrator::Num)] = { };
+	for (int32 Integrator = 0; Integrator < int32(ESpaceIntegrator::Num); Integrator++)
+	{
+		FSpaceBodyStates States;
+		MakeOrbit(States, Gravity);
+		double Substep = Step;
+		for (int32 Index = 0; Index < NumSteps; Index++)
+		{
+			switch (ESpaceIntegrator(Integrator))
+			{
+			case ESpaceIntegrator::SemiImplicitEuler:
+				FSpaceIntegrators::StepSemiImplicitEuler(States, 0, 1, Step, Gravity);
+				break;
+			case ESpaceIntegrator::VelocityVerlet:
+				FSpaceIntegrators::StepVelocityVerlet(States, 0, 1, Step, Gravity);
+				break;
+			default:
+				FSpaceIntegrators::StepDormandPrince(States, 0, 1, Step, Tolerance, Substep, Gravity);
+				break;
+			}
+			MaxErrors[Integrator] = FMath::Max(MaxErrors[Integrator], GetEnergyError(States));
+		}
+		LocationErrors[Integrator] = GetLocationError(States, NumSteps * Step);
+		AddInfo(FString::Printf(TEXT("Integrator %d: largest energy error %g, location error after 20 orbits %g cm"), Integrator, MaxErrors[Integrator], LocationErrors[Integrator]));
+	}
+
+	TestTrue(TEXT("Euler energy"), MaxErrors[int32(ESpaceIntegrator::SemiImplicitEuler)] < 0.02);
+	TestTrue(TEXT("Verlet energy"), MaxErrors[int32(ESpaceIntegrator::VelocityVerlet)] < 1e-4);
+	TestTrue(TEXT("Verlet is more accurate than Euler"), MaxErrors[int32(ESpaceIntegrator::VelocityVerlet)] < MaxErrors[int32(ESpaceIntegrator::SemiImplicitEuler)] / 4);
+
+	// Each step's error is bounded by the tolerance, a centimeter on an orbit of ten thousand kilometers. The errors carry over to the next steps and grow along the orbit, so the global one is a few times their sum
+	TestTrue(TEXT("Dormand-Prince energy"), MaxErrors[int32(ESpaceIntegrator::DormandPrince)] < 1e-7);
+	TestTrue(TEXT("Dormand-Prince location"), LocationErrors[int32(ESpaceIntegrator::DormandPrince)] < 10 * NumSteps * Tolerance);
+	TestTrue(TEXT("Dormand-Prince is more accurate than Verlet"), LocationErrors[int32(ESpaceIntegrator::DormandPrince)] < LocationErrors[int32(ESpaceIntegrator::VelocityVerlet)] / 1000);
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpaceKitIntegrationDormandPrinceSubstepsTest, "SpaceKit.Integration.DormandPrinceSubsteps", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpaceKitIntegrationDormandPrinceSubstepsTest::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitIntegrationTest;
+
+	const FSpaceAccelerationFunction Gravity = MakeCentralGravity();
+	const double Step = Period / 4;
+
+	// A quarter of an orbit in one substep is far beyond a centimeter of error: it's rejected, and smaller ones are taken
+	{
+		FSpaceBodyStates States;
+		MakeOrbit(States, Gravity);
+		double Substep = Step;
+		const double Tolerance = 1;
+		const int32 NumSubsteps = FSpaceIntegrators::StepDormandPrince(States, 0, 1, Step, Tolerance, Substep, Gravity);
+		TestTrue(FString::Printf(TEXT("Rejected substep, %d substeps"), NumSubsteps), NumSubsteps > 1 && Substep < Step);
+		TestTrue(TEXT("Rejected substep, location"), GetLocationError(States, Step) < NumSubsteps * Tolerance);
+	}
+
+	// Constant accelerations have no error: the substeps are accepted, and grow
+	{
+		FSpaceBodyStates States;
+		States.SetNum(1);
+		States.Locations[0] = Center;
+		States.Velocities[0] = FVectorHybrid(8.0, 0.0, -16.0);
+		const FVectorHybrid Acceleration(2.0, -0.5, 4.0);
+		const FSpaceAccelerationFunction Constant = MakeConstantAcceleration(Acceleration);
+		FSpaceIntegrators::EvaluateAccelerations(States, 0, 1, Constant);
+
+		double Substep = 1.0 / 8;
+		const int32 NumSubsteps = FSpaceIntegrators::StepDormandPrince(States, 0, 1, 1.0, 1e-6, Substep, Constant);
+		TestTrue(FString::Printf(TEXT("Accepted substeps, %d substeps"), NumSubsteps), NumSubsteps <= 3 && Substep > 1.0 / 8);
+		const FVectorFloat Error = States.Locations[0] - (Center + FVectorFloat(FVectorHybrid(8.0, 0.0, -16.0) + Acceleration * FRealHybrid(0.5)));
+		TestTrue(TEXT("Accepted substeps, location"), FMath::Abs(Error.X.ToDouble()) + FMath::Abs(Error.Y.ToDouble()) + FMath::Abs(Error.Z.ToDouble()) < 1e-9);
+	}
+
+	// A tolerance that can't be reached: the substeps stop shrinking at 1/4096 of the step, and are accepted so the step ends
+	{
+		FSpaceBodyStates States;
+		MakeOrbit(States, Gravity);
+		double Substep = Step;
+		const int32 NumSubsteps = FSpaceIntegrators::StepDormandPrince(States, 0, 1, Step, 1e-30, Substep, Gravity);
+		TestTrue(FString::Printf(TEXT("Smallest substep, %d substeps"), NumSubsteps), NumSubsteps >= 4096 && NumSubsteps <= 4097);
+		TestEqual(TEXT("Smallest substep, next substep"), Substep, Step / 4096);
+	}
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+#endif //WITH_DEV_AUTOMATION_TESTS
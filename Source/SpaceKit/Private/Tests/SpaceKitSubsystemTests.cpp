@@ -0,0 +1,204 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Containers/UnrealString.h"
+#include "Core/Public/Misc/AutomationTest.h"
+
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#include "SpaceKit/Public/SpaceFloatingOriginSubsystem.h"
+#include "SpaceKit/Public/SpaceKitSubsystem.h"
+#include "SpaceKit/Public/SpaceMovementComponent.h"
+#include "SpaceKit/Public/SpaceTransformComponent.h"
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SpaceKitSubsystemTest
+{
+	// A game world, with its subsystems, destroyed at the end of the scope. It never begins play, so the tests register the components themselves
+	struct FTestWorld
+	{
+		UWorld* World;
+
+		FTestWorld()
+			: World(UWorld::CreateWorld(EWorldType::Game, false))
+		{
+			GEngine->CreateNewWorldContext(EWorldType::Game).SetCurrentWorld(World);
+		}
+
+		~FTestWorld()
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+	};
+
+	FVectorFloat MakeLocation(double X, double Y, double Z)
+	{
+		return FVectorFloat(FRealFloat(X), FRealFloat(Y), FRealFloat(Z));
+	}
+
+	// An actor with a scene root, so the floating origin can place it, and a transform component at Location
+	USpaceTransformComponent* SpawnBody(UWorld* World, const FVectorFloat& Location)
+	{
+		AActor* Actor = World->SpawnActor<AActor>();
+		USceneComponent* Root = NewObject<USceneComponent>(Actor);
+		Actor->SetRootComponent(Root);
+		Root->RegisterComponent();
+
+		USpaceTransformComponent* Transform = NewObject<USpaceTransformComponent>(Actor);
+		Transform->Location = Location;
+		return Transform;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpaceKitSubsystemRegistryTest, "SpaceKit.Subsystem.Registry", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+#pragma optimize("", off)
+
+bool FSpaceKitSubsystemRegistryTest::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitSubsystemTest;
+
+	FTestWorld TestWorld;
+	USpaceKitSubsystem* SpaceKit = TestWorld.World->GetSubsystem<USpaceKitSubsystem>();
+	if (!TestNotNull(TEXT("SpaceKit subsystem"), SpaceKit)) return false;
+
+	USpaceTransformComponent* First = SpawnBody(TestWorld.World, FVectorFloat());
+	USpaceTransformComponent* Second = SpawnBody(TestWorld.World, FVectorFloat());
+	USpaceMovementComponent* SecondMovement = NewObject<USpaceMovementComponent>(Second->GetOwner());
+
+	// The components of an actor share its body, whatever order they register in
+	SpaceKit->RegisterTransform(First);
+	SpaceKit->RegisterMovement(SecondMovement);
+	SpaceKit->RegisterTransform(Second);
+	TestEqual(TEXT("Bodies"), SpaceKit->GetNumBodyIndices(), 2);
+	TestTrue(TEXT("First body"), SpaceKit->GetBody(0).Owner == First->GetOwner() && SpaceKit->GetBody(0).Transform == First && SpaceKit->GetBody(0).Movement == nullptr);
+	TestTrue(TEXT("Second body"), SpaceKit->GetBody(1).Owner == Second->GetOwner() && SpaceKit->GetBody(1).Transform == Second && SpaceKit->GetBody(1).Movement == SecondMovement);
+
+	// Registering twice, or unregistering a component that isn't registered, changes nothing
+	SpaceKit->RegisterTransform(First);
+	SpaceKit->UnregisterMovement(NewObject<USpaceMovementComponent>(First->GetOwner()));
+	TestEqual(TEXT("Bodies after unmatched calls"), SpaceKit->GetNumBodyIndices(), 2);
+	TestTrue(TEXT("First body after unmatched calls"), SpaceKit->GetBody(0).Transform == First);
+
+	// A body is freed with its last component, and its index goes to the next actor
+	SpaceKit->UnregisterTransform(First);
+	TestTrue(TEXT("Freed body"), SpaceKit->GetBody(0).Owner == nullptr && SpaceKit->GetBody(0).Transform == nullptr);
+	SpaceKit->UnregisterTransform(First);
+	USpaceTransformComponent* Third = SpawnBody(TestWorld.World, FVectorFloat());
+	SpaceKit->RegisterTransform(Third);
+	TestEqual(TEXT("Bodies after reuse"), SpaceKit->GetNumBodyIndices(), 2);
+	TestTrue(TEXT("Reused body"), SpaceKit->GetBody(0).Owner == Third->GetOwner() && SpaceKit->GetBody(0).Transform == Third);
+
+	// A body stays while one of its components is registered
+	SpaceKit->UnregisterTransform(Second);
+	TestTrue(TEXT("Body kept by its movement"), SpaceKit->GetBody(1).Owner == Second->GetOwner() && SpaceKit->GetBody(1).Transform == nullptr && SpaceKit->GetBody(1).Movement == SecondMovement);
+	SpaceKit->UnregisterMovement(SecondMovement);
+	TestTrue(TEXT("Body freed with its movement"), SpaceKit->GetBody(1).Owner == nullptr);
+
+	// Once every registration is matched, nothing is left to update
+	TestTrue(TEXT("Ticking while registered"), SpaceKit->IsTickable());
+	SpaceKit->UnregisterTransform(Third);
+	TestFalse(TEXT("Ticking once all unregistered"), SpaceKit->IsTickable());
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpaceKitSubsystemRenderSpaceTest, "SpaceKit.Subsystem.RenderSpace", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+#pragma optimize("", off)
+
+bool FSpaceKitSubsystemRenderSpaceTest::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitSubsystemTest;
+
+	FTestWorld TestWorld;
+	USpaceKitSubsystem* SpaceKit = TestWorld.World->GetSubsystem<USpaceKitSubsystem>();
+	USpaceFloatingOriginSubsystem* FloatingOrigin = TestWorld.World->GetSubsystem<USpaceFloatingOriginSubsystem>();
+	if (!TestNotNull(TEXT("SpaceKit subsystem"), SpaceKit) || !TestNotNull(TEXT("Floating origin subsystem"), FloatingOrigin)) return false;
+
+	// Far from the world's origin, where a float is a kilometer wide, offsets from the floating origin keep their centimeters
+	const FVectorFloat Origin = MakeLocation(1e16, -3e15, 2e12);
+	const FVectorFloat Offset = MakeLocation(1.5, -2.0, 0.25);
+	const FVector RenderOffset(1.5f, -2.f, 0.25f);
+	FloatingOrigin->SetOrigin(Origin);
+	TestEqual(TEXT("To render space"), FloatingOrigin->ToRenderSpace(Origin + Offset), RenderOffset);
+	TestTrue(TEXT("From render space"), FloatingOrigin->FromRenderSpace(RenderOffset) == Origin + Offset);
+
+	// Registered transforms are placed in render space at the next update
+	USpaceTransformComponent* Body = SpawnBody(TestWorld.World, Origin + Offset);
+	SpaceKit->RegisterTransform(Body);
+	SpaceKit->UpdateBodies(0.f);
+	TestEqual(TEXT("Actor in render space"), Body->GetOwner()->GetActorLocation(), RenderOffset);
+
+	// Unregistered ones are left where they are
+	SpaceKit->UnregisterTransform(Body);
+	Body->Location = Origin;
+	SpaceKit->UpdateBodies(0.f);
+	TestEqual(TEXT("Unregistered actor"), Body->GetOwner()->GetActorLocation(), RenderOffset);
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpaceKitFloatingOriginRebaseTest, "SpaceKit.Subsystem.FloatingOriginRebase", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+#pragma optimize("", off)
+
+bool FSpaceKitFloatingOriginRebaseTest::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitSubsystemTest;
+
+	FTestWorld TestWorld;
+	USpaceKitSubsystem* SpaceKit = TestWorld.World->GetSubsystem<USpaceKitSubsystem>();
+	USpaceFloatingOriginSubsystem* FloatingOrigin = TestWorld.World->GetSubsystem<USpaceFloatingOriginSubsystem>();
+	if (!TestNotNull(TEXT("SpaceKit subsystem"), SpaceKit) || !TestNotNull(TEXT("Floating origin subsystem"), FloatingOrigin)) return false;
+
+	const FVectorFloat Start = MakeLocation(1e16, -3e15, 2e12);
+	USpaceTransformComponent* Followed = SpawnBody(TestWorld.World, Start);
+	USpaceTransformComponent* Other = SpawnBody(TestWorld.World, Start + MakeLocation(1000.0, 0.0, 0.0));
+	SpaceKit->RegisterTransform(Followed);
+	SpaceKit->RegisterTransform(Other);
+	FloatingOrigin->OriginComponent = Followed;
+	FloatingOrigin->RebaseDistance = 100000.f;
+
+	// The followed component starts far beyond the rebase distance, so the origin moves onto it, and every actor is placed relative to it
+	SpaceKit->UpdateBodies(0.f);
+	TestTrue(TEXT("First rebase"), FloatingOrigin->GetOrigin() == Start);
+	TestEqual(TEXT("First rebase, followed actor"), Followed->GetOwner()->GetActorLocation(), FVector::ZeroVector);
+	TestEqual(TEXT("First rebase, other actor"), Other->GetOwner()->GetActorLocation(), FVector(1000.f, 0.f, 0.f));
+
+	// Within the rebase distance the origin stays, and only the followed actor moves
+	Followed->Location = Start + MakeLocation(50000.0, 0.0, 0.0);
+	SpaceKit->UpdateBodies(0.f);
+	TestTrue(TEXT("Within the distance"), FloatingOrigin->GetOrigin() == Start);
+	TestEqual(TEXT("Within the distance, followed actor"), Followed->GetOwner()->GetActorLocation(), FVector(50000.f, 0.f, 0.f));
+	TestEqual(TEXT("Within the distance, other actor"), Other->GetOwner()->GetActorLocation(), FVector(1000.f, 0.f, 0.f));
+
+	// Beyond it the origin moves again, and the actors that didn't move in space move in render space
+	const FVectorFloat Moved = Start + MakeLocation(200000.0, 0.0, 0.0);
+	Followed->Location = Moved;
+	SpaceKit->UpdateBodies(0.f);
+	TestTrue(TEXT("Second rebase"), FloatingOrigin->GetOrigin() == Moved);
+	TestEqual(TEXT("Second rebase, followed actor"), Followed->GetOwner()->GetActorLocation(), FVector::ZeroVector);
+	TestEqual(TEXT("Second rebase, other actor"), Other->GetOwner()->GetActorLocation(), FVector(-199000.f, 0.f, 0.f));
+
+	// The followed component is forgotten when it unregisters
+	SpaceKit->UnregisterTransform(Followed);
+	TestNull(TEXT("Followed component unregistered"), FloatingOrigin->OriginComponent);
+	SpaceKit->UnregisterTransform(Other);
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+#endif //WITH_DEV_AUTOMATION_TESTS
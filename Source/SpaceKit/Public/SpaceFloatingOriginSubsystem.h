@@ -0,0 +1,92 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "SpaceKitPrecision/Public/RotatorFloat.h"
+
+#include "SpaceFloatingOriginSubsystem.generated.h"
+
+
+class USpaceTransformComponent;
+
+/**
+ * Floating origin of a world: UE4 actors are placed relative to it, so they keep a float precision near it, however far it is from the world's origin.
+ * Once per frame, after the bodies moved, USpaceKitSubsystem has it convert the locations of all the registered USpaceTransformComponent, relative to the origin, in parallel.
+ * The subtraction is done in high precision, and only its result, which is small near the origin, is converted to float.
+ * Only the actors whose render-space transform changed are moved, so the cost of the engine calls scales with the number of moving actors.
+ */
+UCLASS()
+class SPACEKIT_API USpaceFloatingOriginSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// The component the origin follows, e.g. the player's or the camera's. If null, it follows the view target of the first player controller
+	UPROPERTY(BlueprintReadWrite, category = "SpaceFloatingOrigin")
+	USpaceTransformComponent* OriginComponent;
+
+	// Distance, in render space, the followed component can move away from the origin before the origin is moved onto it.
+	// Moving the origin moves every actor, so this avoids doing it every frame. Zero moves it every frame
+	UPROPERTY(BlueprintReadWrite, category = "SpaceFloatingOrigin")
+	float RebaseDistance = 100000.f;
+
+	// Number of components converted by each task of the parallel sweep
+	static constexpr int32 ChunkSize = 256;
+
+	USpaceFloatingOriginSubsystem();
+
+	// Components are registered by USpaceKitSubsystem, when they begin play, and unregistered when they end play
+	void Register(USpaceTransformComponent* Component);
+	void Unregister(USpaceTransformComponent* Component);
+
+	UFUNCTION(BlueprintPure, category = "SpaceFloatingOrigin")
+	const FVectorFloat& GetOrigin() const
+	{
+		return Origin;
+	}
+
+	// Moves the origin. Every registered actor is moved on the next update
+	UFUNCTION(BlueprintCallable, category = "SpaceFloatingOrigin")
+	void SetOrigin(const FVectorFloat& NewOrigin);
+
+	// Converts a location to render space, i.e. relative to the origin
+	UFUNCTION(BlueprintPure, category = "SpaceFloatingOrigin")
+	FVector ToRenderSpace(const FVectorFloat& Location) const;
+
+	// Converts a location in render space, e.g. a hit location, to an absolute location
+	UFUNCTION(BlueprintPure, category = "SpaceFloatingOrigin")
+	FVectorFloat FromRenderSpace(const FVector& RenderLocation) const;
+
+	// Moves the origin if needed, then converts the registered transforms and moves the actors whose transform changed
+	void UpdateRenderTransforms();
+
+private:
+
+	// What was last pushed to the engine for a component, to only push what changed
+	struct FSyncState
+	{
+		FVectorFloat Location;
+		FRotatorFloat Rotation;
+		FVector RenderLocation;
+		FRotator RenderRotation;
+		bool bSynced = false;
+		bool bDirty = false;
+	};
+
+	// Registered components, and their states at the same indices. Removals swap the last ones in
+	UPROPERTY()
+	TArray<USpaceTransformComponent*> Components;
+
+	TArray<FSyncState> States;
+
+	FVectorFloat Origin;
+
+	bool bOriginChanged = false;
+
+	// The component the origin follows this frame
+	USpaceTransformComponent* GetFollowedComponent() const;
+};
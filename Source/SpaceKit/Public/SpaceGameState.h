@@ -9,7 +9,7 @@
 #include "SpaceGameState.generated.h"
 
 /**
- *
+ * SpaceKit actors are updated by USpaceKitSubsystem, in a single tick over its registry, so this component doesn't tick
  */
 UCLASS()
 class SPACEKIT_API USpaceGameStateComponent : public UActorComponent
@@ -20,8 +20,6 @@ public:
 
 	USpaceGameStateComponent();
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
 	virtual void InitializeComponent() override;
 	
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
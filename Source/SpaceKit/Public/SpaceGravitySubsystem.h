@@ -0,0 +1,62 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "SpaceKit/Public/SpaceGravityTree.h"
+#include "SpaceKit/Public/SpaceIntegration.h"
+
+#include "SpaceGravitySubsystem.generated.h"
+
+
+class USpaceKitSubsystem;
+
+/**
+ * Gravity between the bodies registered to USpaceKitSubsystem, computed with a Barnes-Hut tree, see FSpaceGravityTree.
+ * Every body whose USpaceTransformComponent has a mass attracts, and the simulated ones, those with a USpaceMovementComponent, are attracted.
+ * The tree is rebuilt for each evaluation of the accelerations, over where the simulated bodies are at that point of the step.
+ */
+UCLASS()
+class SPACEKIT_API USpaceGravitySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// In cm³/(kg s²), as SpaceKit's lengths are in centimeters
+	UPROPERTY(BlueprintReadWrite, category = "SpaceGravity")
+	float GravitationalConstant = 6.674e-5f;
+
+	// Angle, in radians, under which a group of bodies is attracting as a single body. Smaller is more accurate and slower, zero sums all the bodies directly
+	UPROPERTY(BlueprintReadWrite, category = "SpaceGravity")
+	float OpeningAngle = 0.5f;
+
+	// Distance, in centimeters, that bounds the accelerations of close bodies
+	UPROPERTY(BlueprintReadWrite, category = "SpaceGravity")
+	float Softening = 100.f;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// Accelerations of a batch of simulated bodies, see FSpaceAccelerationFunction
+	void ComputeAccelerations(const FSpaceBodyStates& States, int32 First, int32 Num, TArrayView<FVectorHybrid> OutAccelerations);
+
+private:
+
+	UPROPERTY()
+	USpaceKitSubsystem* SpaceKit;
+
+	FSpaceGravityTree Tree;
+
+	// The bodies that attract: first the ones that aren't simulated, then the simulated ones, in the same order as in the states
+	TArray<FVectorFloat> SourceLocations;
+	TArray<double> SourceMasses;
+
+	// Bodies that aren't simulated don't move during a frame, so they're only gathered once per frame
+	int32 NumStaticSources = 0;
+	uint64 StaticSourcesFrame = MAX_uint64;
+
+	void GatherStaticSources();
+};
@@ -0,0 +1,94 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SpaceKitPrecision/Public/VectorFloat.h"
+#include "SpaceKitPrecision/Public/VectorHybrid.h"
+
+
+/**
+ * Barnes-Hut octree over bodies, giving their gravitational accelerations in O(N log N) instead of O(N^2).
+ * Locations are only read in high precision, to convert them to doubles relative to the tree's origin, its first body.
+ * The tree and the force math then run in double, whose error is about 1e-16 times the tree's extent: around a millimeter across the solar system.
+ * Building and evaluating both run in parallel: over the bodies, then over the subtrees, and over groups of close evaluated locations.
+ * Each group walks the tree once, and sums the sources it found for all its locations in a flat loop.
+ */
+class SPACEKIT_API FSpaceGravityTree
+{
+public:
+
+	// Most bodies in a leaf. Leaves' bodies are summed directly
+	static constexpr int32 MaxLeafBodies = 8;
+
+	// Builds the tree over bodies, with their masses in kilograms. Bodies without mass don't attract
+	void Build(TArrayView<const FVectorFloat> Locations, TArrayView<const double> Masses);
+
+	// Gravitational accelerations at locations, in cm/s², for a gravitational constant in cm³/(kg s²).
+	// A node is taken as a single body at its center of mass while it's seen under an angle less than OpeningAngle, in radians: zero sums all the bodies directly.
+	// Softening, in centimeters, bounds the accelerations near bodies. A location on a body gets no acceleration from it
+	void ComputeAccelerations(TArrayView<const FVectorFloat> Locations, double GravitationalConstant, double OpeningAngle, double Softening, TArrayView<FVectorHybrid> OutAccelerations) const;
+
+	int32 GetNumBodies() const
+	{
+		return Bodies.Num();
+	}
+
+	int32 GetNumNodes() const
+	{
+		return Nodes.Num();
+	}
+
+private:
+
+	// Location relative to the origin, and mass
+	struct FBody
+	{
+		double X, Y, Z, Mass;
+	};
+
+	struct FNode
+	{
+		// Center of mass, relative to the origin, and mass
+		double X, Y, Z, Mass;
+
+		// Edge length of the node's cube
+		double Size;
+
+		// Children are contiguous. Leaves have none, and sum their bodies
+		int32 FirstChild;
+		int32 NumChildren;
+
+		// Bodies are sorted along a Morton curve, so each node's bodies are contiguous
+		int32 FirstBody;
+		int32 NumBodies;
+	};
+
+	// A node whose subtree is built by a parallel task
+	struct FSubtree
+	{
+		int32 Node;
+		int32 Begin;
+		int32 End;
+	};
+
+	FVectorFloat Origin;
+
+	// Corner and edge length of the root's cube, relative to the origin
+	double RootMin[3];
+	double RootSize;
+
+	TArray<FBody> Bodies;
+	TArray<uint64> Codes;
+	TArray<FNode> Nodes;
+
+	// Morton code of a location: the cells containing it at each level, from the root
+	uint64 GetCode(const FBody& Body) const;
+
+	// Sets up a node over bodies, and builds its children. Nodes reaching the parallel level are added to OutSubtrees instead, if not null
+	void BuildNode(TArray<FNode>& OutNodes, int32 NodeIndex, int32 Begin, int32 End, int32 Level, TArray<FSubtree>* OutSubtrees) const;
+
+	// Sets a node's mass and center of mass, from its bodies if it's a leaf, else from its children
+	void ComputeCenterOfMass(TArray<FNode>& OutNodes, int32 NodeIndex) const;
+};
@@ -0,0 +1,77 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+#include "SpaceKitPrecision/Public/VectorFloat.h"
+#include "SpaceKitPrecision/Public/VectorHybrid.h"
+
+#include "SpaceIntegration.generated.h"
+
+
+/**
+ * Method used to advance a body's movement by a fixed step
+ */
+UENUM(BlueprintType)
+enum class ESpaceIntegrator : uint8
+{
+	// First order, with one evaluation of the accelerations per step. Cheap, but orbits drift unless the steps are small
+	SemiImplicitEuler,
+	// Second order and symplectic, with one evaluation per step: orbits keep their energy over long times, even with large steps
+	VelocityVerlet,
+	// Dormand-Prince: fifth order, in adaptive substeps bounded by an error tolerance. For close encounters, where accelerations change quickly
+	DormandPrince,
+	Num UMETA(Hidden),
+};
+
+/**
+ * States of bodies, stored as arrays, so that each integrator runs over a contiguous batch of them
+ */
+struct SPACEKIT_API FSpaceBodyStates
+{
+	TArray<FVectorFloat> Locations;
+	TArray<FVectorHybrid> Velocities;
+
+	// Masses of the transform components, that make the bodies attract, see USpaceGravitySubsystem
+	TArray<FRealHybrid> Masses;
+
+	// Accelerations at the current locations. Integrators expect them up to date, and keep them so
+	TArray<FVectorHybrid> Accelerations;
+
+	int32 Num() const
+	{
+		return Locations.Num();
+	}
+
+	void SetNum(int32 Num)
+	{
+		Locations.SetNum(Num, false);
+		Velocities.SetNum(Num, false);
+		Masses.SetNum(Num, false);
+		Accelerations.SetNum(Num, false);
+	}
+};
+
+// Computes the accelerations of the bodies from First to First + Num - 1, given the states of all the bodies. No function means no acceleration
+using FSpaceAccelerationFunction = TFunction<void(const FSpaceBodyStates& States, int32 First, int32 Num, TArrayView<FVectorHybrid> OutAccelerations)>;
+
+/**
+ * Integrators, advancing a batch of bodies by a step, in seconds.
+ * Accelerations are evaluated with the other bodies where they are, so batches advanced one after the other see the ones before them already advanced.
+ */
+struct SPACEKIT_API FSpaceIntegrators
+{
+	static void StepSemiImplicitEuler(FSpaceBodyStates& States, int32 First, int32 Num, double Step, const FSpaceAccelerationFunction& Accelerations);
+
+	// Kick, drift, kick: the accelerations at the new locations are those of the next step's first kick
+	static void StepVelocityVerlet(FSpaceBodyStates& States, int32 First, int32 Num, double Step, const FSpaceAccelerationFunction& Accelerations);
+
+	// Advances in as many substeps as needed to keep the error of each body under Tolerance, in centimeters.
+	// InOutSubstep is the substep to try first, and is set to the one to try next time. Returns the number of substeps taken
+	static int32 StepDormandPrince(FSpaceBodyStates& States, int32 First, int32 Num, double Step, double Tolerance, double& InOutSubstep, const FSpaceAccelerationFunction& Accelerations);
+
+	// Sets the accelerations of the batch to the ones at the current locations
+	static void EvaluateAccelerations(FSpaceBodyStates& States, int32 First, int32 Num, const FSpaceAccelerationFunction& Accelerations);
+};
@@ -0,0 +1,170 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+
+#include "SpaceKit/Public/SpaceIntegration.h"
+
+#include "SpaceKitSubsystem.generated.h"
+
+
+class USpaceTransformComponent;
+class USpaceMovementComponent;
+class USpaceFloatingOriginSubsystem;
+
+/**
+ * The SpaceKit components of an actor, registered together
+ */
+USTRUCT()
+struct SPACEKIT_API FSpaceKitBody
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	AActor* Owner = nullptr;
+
+	UPROPERTY()
+	USpaceTransformComponent* Transform = nullptr;
+
+	UPROPERTY()
+	USpaceMovementComponent* Movement = nullptr;
+};
+
+/**
+ * Registry of the SpaceKit components of a world, and the single tick that updates them all.
+ * Components register when they begin play and unregister when they end play, so nothing iterates over the world's actors or their components.
+ * Each actor gets a body, whose index stays the same while it's registered: bodies are stored in a dense array, and the freed ones are reused.
+ * Movements are simulated in fixed steps, independent of the frame rate: the frame's time is accumulated, and as many steps as it holds are run.
+ * Bodies are batched by integrator, see ESpaceIntegrator, and their states are only read from and written to the components once per frame.
+ * The accelerations at the end of a frame's last step are those of the next frame's first step, so they're kept, unless a body was added, removed or moved by something else than the simulation.
+ */
+UCLASS()
+class SPACEKIT_API USpaceKitSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	// Duration of a simulation step, in seconds
+	UPROPERTY(BlueprintReadWrite, category = "SpaceKit")
+	float FixedTimeStep = 1.f / 60.f;
+
+	// Most steps run in a frame. Once reached, the rest of the frame's time is dropped, so a slow frame doesn't make the next ones slower
+	UPROPERTY(BlueprintReadWrite, category = "SpaceKit")
+	int32 MaxStepsPerFrame = 8;
+
+	// Error allowed per step to the bodies using the DormandPrince integrator, in centimeters
+	UPROPERTY(BlueprintReadWrite, category = "SpaceKit")
+	float IntegrationTolerance = 1.f;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// Sets what computes the bodies' accelerations, e.g. gravity. Without one, bodies keep their velocities
+	void SetAccelerationFunction(FSpaceAccelerationFunction Function);
+
+	// Evaluates the accelerations again at the next step, for when what the acceleration function depends on changed outside of the bodies
+	void InvalidateAccelerations()
+	{
+		bAccelerationsValid = false;
+	}
+
+	void RegisterTransform(USpaceTransformComponent* Component);
+	void UnregisterTransform(USpaceTransformComponent* Component);
+
+	void RegisterMovement(USpaceMovementComponent* Component);
+	void UnregisterMovement(USpaceMovementComponent* Component);
+
+	// The body at an index. Freed bodies have no owner
+	const FSpaceKitBody& GetBody(int32 Index) const
+	{
+		return Bodies[Index];
+	}
+
+	// Number of indices, including the freed ones
+	int32 GetNumBodyIndices() const
+	{
+		return Bodies.Num();
+	}
+
+	// Calls Function(Transform, Movement) for each body that has both components
+	template<typename FunctionType>
+	void ForEachMovingBody(FunctionType Function) const
+	{
+		for (const FSpaceKitBody& Body : Bodies)
+		{
+			if (Body.Transform != nullptr && Body.Movement != nullptr)
+			{
+				Function(*Body.Transform, *Body.Movement);
+			}
+		}
+	}
+
+	// Updates all the registered components: their movement, then their actors' transforms. See USpaceFloatingOriginSubsystem
+	void UpdateBodies(float DeltaTime);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+
+private:
+
+	UPROPERTY()
+	TArray<FSpaceKitBody> Bodies;
+
+	// Indices of the freed bodies, to reuse them
+	TArray<int32> FreeIndices;
+
+	// Only read when components register, to pair the ones of the same actor
+	UPROPERTY()
+	TMap<AActor*, int32> BodyIndices;
+
+	int32 NumComponents = 0;
+
+	FSpaceAccelerationFunction AccelerationFunction;
+
+	// Simulated time not stepped yet, less than a step
+	double TimeAccumulator = 0;
+
+	// Substep the DormandPrince integrator tries first, adapted at each step
+	double DormandPrinceSubstep = 0;
+
+	// States of the moving bodies, sorted by integrator, the body each state was gathered from, and where each integrator's batch starts
+	FSpaceBodyStates States;
+	TArray<int32> StateBodies;
+	int32 BatchStarts[int32(ESpaceIntegrator::Num) + 1] = { };
+
+	// Whether the states' accelerations are those of the last step, and still hold if the bodies are where the simulation left them
+	bool bAccelerationsValid = false;
+
+	// Where the bodies that aren't simulated were, and their masses, when the accelerations were evaluated, as the acceleration function may depend on them
+	struct FStaticBody
+	{
+		int32 BodyIndex;
+		FVectorFloat Location;
+		FRealFloat Mass;
+	};
+	TArray<FStaticBody> StaticBodies;
+
+	UPROPERTY()
+	USpaceFloatingOriginSubsystem* FloatingOrigin;
+
+	int32 FindOrAddBody(AActor* Owner);
+
+	// Frees the body if it has no component left
+	void ReleaseBody(int32 Index);
+
+	// Copies the states of the moving bodies from their components, batched by integrator, and evaluates their accelerations unless the last ones still hold
+	void GatherStates();
+
+	// Runs simulation steps on the states, each integrator over its batch
+	void Simulate(int32 NumSteps);
+
+	// Copies the states back to the components, and turns them for the time they were simulated
+	void ScatterStates(double SimulatedTime);
+};
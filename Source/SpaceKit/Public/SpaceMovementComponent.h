@@ -7,13 +7,16 @@
 
 #include "SpaceKitPrecision/Public/RotatorFloat.h"
 
+#include "SpaceKit/Public/SpaceIntegration.h"
+
 #include "SpaceMovementComponent.generated.h"
 
 
 class USpaceTransformComponent;
 
 /**
- * Movement component for SpaceKit actors
+ * Movement component for SpaceKit actors.
+ * It doesn't tick: during play, USpaceKitSubsystem updates it along with the actor's USpaceTransformComponent
  */
 UCLASS()
 class SPACEKIT_API USpaceMovementComponent : public UMovementComponent
@@ -26,20 +29,35 @@ public:
 
 	virtual void InitializeComponent() override;
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="SpaceKit")
 	FVectorFloat SpaceVelocity;
 
+	// Axis of rotation, in world space, scaled by the rotation speed in degrees per second
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="SpaceKit")
 	FVectorFloat SpaceAngularVelocity;
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="SpaceKit")
 	FRealFloat SpaceMass;
 
+	// How the movement is simulated. VelocityVerlet keeps orbits stable with large steps, DormandPrince follows close encounters accurately
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="SpaceKit")
+	ESpaceIntegrator Integrator = ESpaceIntegrator::VelocityVerlet;
+
 protected:
 
+	// The actor's transform component. Paired with this one by the SpaceKit subsystem during play, so it isn't searched for
 	UFUNCTION()
 	USpaceTransformComponent* GetSpaceUpdatedComponent();
 
+private:
+
+	friend class USpaceKitSubsystem;
+
+	// Index of the actor's body in the SpaceKit subsystem, or INDEX_NONE if not registered
+	int32 SpaceKitBodyIndex = INDEX_NONE;
+
 };
@@ -12,6 +12,7 @@
 
 /**
  * This enables actor that possess it will have its location and rotation in FVectorFloat (precise) instead of FVector (single precision).
+ * During play, the actor is placed relative to the world's floating origin, see USpaceFloatingOriginSubsystem.
  * Note that this shouldn't be spawned in a BlueprintClass, because for some reason, you can't edit the position if you do that.
  */
 UCLASS()
@@ -36,10 +37,21 @@ public:
 
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 		
 private:
 
+	friend class USpaceFloatingOriginSubsystem;
+	friend class USpaceKitSubsystem;
+
+	// Index in the floating origin's arrays, or INDEX_NONE if not registered
+	int32 FloatingOriginIndex = INDEX_NONE;
+
+	// Index of the actor's body in the SpaceKit subsystem, or INDEX_NONE if not registered
+	int32 SpaceKitBodyIndex = INDEX_NONE;
+
 #if WITH_EDITOR
 	FVector CachedLocation;
 	FRotator CachedRotation;
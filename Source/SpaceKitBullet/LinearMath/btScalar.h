@@ -538,7 +538,7 @@ inline int btIsDoublePrecision()
 #define SIMD_RADS_PER_DEG (SIMD_2_PI / 360.0_fl)
 #define SIMD_DEGS_PER_RAD (360.0_fl / SIMD_2_PI)
 #define SIMDSQRT12 0.7071067811865475244008443621048490_fl
-#define btRecipSqrt(x) ((btScalar)(1.0_fl / btSqrt(btScalar(x)))) /* reciprocal square root */
+#define btRecipSqrt(x) (URealFloatMath::InvSqrt(btScalar(x))) /* reciprocal square root */
 #define btRecip(x) (1.0_fl / btScalar(x))
 
 #define BIGFLOAT_EPSILON 1e-9_fl
@@ -8,18 +8,21 @@ FQuatFloat FQuatFloat::Identity = FQuatFloat();
 FQuatFloat::FQuatFloat(const FRotatorFloat& Rotator)
 {
     // Precompute trigo ops
-    const auto CosY = URealFloatMath::CosDeg(Rotator.Yaw * 0.5_fl);
-    const auto SinY = URealFloatMath::SinDeg(Rotator.Yaw * 0.5_fl);
-    const auto CosP = URealFloatMath::CosDeg(Rotator.Pitch * 0.5_fl);
-    const auto SinP = URealFloatMath::SinDeg(Rotator.Pitch * 0.5_fl);
-    const auto CosR = URealFloatMath::CosDeg(Rotator.Roll * 0.5_fl);
-    const auto SinR = URealFloatMath::SinDeg(Rotator.Roll * 0.5_fl);
+    FRealFloat SinY, CosY, SinP, CosP, SinR, CosR;
+    URealFloatMath::SinCosDeg(Rotator.Yaw * 0.5_fl, SinY, CosY);
+    URealFloatMath::SinCosDeg(Rotator.Pitch * 0.5_fl, SinP, CosP);
+    URealFloatMath::SinCosDeg(Rotator.Roll * 0.5_fl, SinR, CosR);
     
+    const auto SinRCosP = SinR * CosP;
+    const auto CosRSinP = CosR * SinP;
+    const auto CosRCosP = CosR * CosP;
+    const auto SinRSinP = SinR * SinP;
+
     // Build the corresponding quaternion
-	X = SinR * CosP * CosY - CosR * SinP * SinY;
-	Y = CosR * SinP * CosY + SinR * CosP * SinY;
-	Z = CosR * CosP * SinY - SinR * SinP * CosY;
-	W = CosR * CosP * CosY + SinR * SinP * SinY;
+	X = URealFloatMath::SumOfProducts(SinRCosP, CosY, -CosRSinP, SinY);
+	Y = URealFloatMath::SumOfProducts(CosRSinP, CosY, SinRCosP, SinY);
+	Z = URealFloatMath::SumOfProducts(CosRCosP, SinY, -SinRSinP, CosY);
+	W = URealFloatMath::SumOfProducts(CosRCosP, CosY, SinRSinP, SinY);
     *this = GetNormalized();
 }
 
@@ -61,25 +64,27 @@ bool UQuatFloatMath::QuatNotEqualsQuat(const FQuatFloat& First, const FQuatFloat
     return !QuatEqualsQuat(First, Second, Tolerance);
 }
 
-FQuatFloat UQuatFloatMath::Slerp(FQuatFloat First, FQuatFloat Second, const FRealFloat& Alpha)
+FQuatFloat UQuatFloatMath::Slerp(const FQuatFloat& First, const FQuatFloat& Second, const FRealFloat& Alpha)
 {
     // Source code from https://en.wikipedia.org/wiki/Slerp
 
-    FRealFloat Dot = First.X * Second.X + First.Y * Second.Y + First.Z * Second.Z + First.W * Second.W;
+    FRealFloat Dot = URealFloatMath::SumOfProducts(First.X, Second.X, First.Y, Second.Y, First.Z, Second.Z, First.W, Second.W);
 
-    if (Dot < FRealFloat(0.f)) 
+    // Go the shortest way, to the opposite of Second if it is closer
+    const bool bOpposite = Dot < FRealFloat(0.f);
+    const FQuatFloat Target = bOpposite ? FQuatFloat(-Second.X, -Second.Y, -Second.Z, -Second.W) : Second;
+    if (bOpposite)
     {
-        Second = FQuatFloat(-Second.X, -Second.X, -Second.X, -Second.X);
         Dot = -Dot;
     }
 
     if (Dot > 0.9995_fl)
     {
         return FQuatFloat(
-            First.X + Alpha * (Second.X - First.X),
-            First.Y + Alpha * (Second.Y - First.Y),
-            First.Z + Alpha * (Second.Z - First.Z),
-            First.W + Alpha * (Second.W - First.W)
+            URealFloatMath::MultiplyAdd(Alpha, Target.X - First.X, First.X),
+            URealFloatMath::MultiplyAdd(Alpha, Target.Y - First.Y, First.Y),
+            URealFloatMath::MultiplyAdd(Alpha, Target.Z - First.Z, First.Z),
+            URealFloatMath::MultiplyAdd(Alpha, Target.W - First.W, First.W)
         ).GetNormalized();
     }
 
@@ -88,13 +93,13 @@ FQuatFloat UQuatFloatMath::Slerp(FQuatFloat First, FQuatFloat Second, const FRea
     FRealFloat sin_theta = URealFloatMath::SinRad(theta);
     FRealFloat sin_theta_0 = URealFloatMath::SinRad(theta_0);
 
-    FRealFloat s0 = URealFloatMath::CosRad(theta) - Dot * sin_theta / sin_theta_0;
     FRealFloat s1 = sin_theta / sin_theta_0;
+    FRealFloat s0 = URealFloatMath::CosRad(theta) - Dot * s1;
 
     return FQuatFloat(
-        (s0 * First.X) + (s1 * Second.X),
-        (s0 * First.Y) + (s1 * Second.Y),
-        (s0 * First.Z) + (s1 * Second.Z),
-        (s0 * First.W) + (s1 * Second.W)
+        URealFloatMath::SumOfProducts(s0, First.X, s1, Target.X),
+        URealFloatMath::SumOfProducts(s0, First.Y, s1, Target.Y),
+        URealFloatMath::SumOfProducts(s0, First.Z, s1, Target.Z),
+        URealFloatMath::SumOfProducts(s0, First.W, s1, Target.W)
     );
 }
@@ -1,107 +1,98 @@
 // Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
 
 #include "SpaceKitPrecision/Public/RealFixed.h"
+#include "SpaceKitPrecision/Public/RealFixedTrigo.h"
 #include "RealFloat.h"
 
 FRealFixed::FRealFixed()
-    : Value(*reinterpret_cast<real_fixed_type*>(InternalValue))
 {
-    Value = 0.0;
-}
-
-FRealFixed::FRealFixed(const FRealFixed& InValue)
-    : Value(*reinterpret_cast<real_fixed_type*>(InternalValue))
-{
-    Value = InValue.Value;
-}
-
-FRealFixed::FRealFixed(const real_fixed_type& InValue)
-    : Value(*reinterpret_cast<real_fixed_type*>(InternalValue))
-{
-    Value = InValue;
+    GetValue() = 0.0;
 }
 
 FRealFixed::FRealFixed(int32 InValue)
-    : Value(*reinterpret_cast<real_fixed_type*>(InternalValue))
 {
-    Value = InValue;
+    GetValue() = InValue;
 }
 
 FRealFixed::FRealFixed(int64 InValue)
-    : Value(*reinterpret_cast<real_fixed_type*>(InternalValue))
 {
-    Value = InValue;
+    GetValue() = InValue;
 }
 
 FRealFixed::FRealFixed(float InValue)
-    : Value(*reinterpret_cast<real_fixed_type*>(InternalValue))
 {
-    Value = InValue;
+    GetValue() = InValue;
 }
 
 FRealFixed::FRealFixed(double InValue)
-    : Value(*reinterpret_cast<real_fixed_type*>(InternalValue))
 {
-    Value = InValue;
+    GetValue() = InValue;
 }
 FRealFixed::FRealFixed(const char* InValue)
-    : Value(*reinterpret_cast<real_fixed_type*>(InternalValue))
 {
-    Value = InValue;
+    GetValue() = InValue;
 }
 
 FRealFixed::FRealFixed(const std::string& InValue)
-    : Value(*reinterpret_cast<real_fixed_type*>(InternalValue))
 {
-    Value = InValue;
+    GetValue() = InValue;
 }
 
 FRealFixed::FRealFixed(const FString& InValue)
-    : Value(*reinterpret_cast<real_fixed_type*>(InternalValue))
 {
-    Value = InValue;
+    GetValue() = InValue;
 }
 
 // Converts this number to a double number. Note that this can lead to huge precision loss
 double FRealFixed::ToDouble() const
 {
-    return Value.ToDouble();
+    return GetValue().ToDouble();
 }
 
 // Converts this number to a float number. Note that this can lead to huge precision loss
 float FRealFixed::ToFloat() const
 {
-    return Value.ToFloat();
+    return GetValue().ToFloat();
 }
 
 // Converts this number to a floating-point big number. This may not lead to precision loss
 real_fixed_type::ttBigType FRealFixed::ToBig() const
 {
-    return Value.ToBig();
+    return GetValue().ToBig();
 }
 
 FString FRealFixed::ToString() const
 {
-    return Value.ToString();
+    return GetValue().ToString();
 }
 
 bool FRealFixed::ExportTextItem(FString& ValueStr, FRealFixed const& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const
 {
-    ValueStr += FString::Printf(TEXT("(%s)"), *ToString());
+    TCHAR Buffer[StringBufferSize + 2];
+    Buffer[0] = TEXT('(');
+    const int32 Length = ToChars(Buffer + 1) + 1;
+    Buffer[Length] = TEXT(')');
+    ValueStr.AppendChars(Buffer, Length + 1);
     return true;
 }
 
+// Reads "(number)" in place, without copying the rest of the buffer
 bool FRealFixed::ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText)
 {
-    FString MutableString = Buffer;
-    const int32 Len = MutableString.Find(")") + 1;
-    Buffer += Len;
-
-    MutableString = MutableString.Left(Len);
-    MutableString.RemoveFromStart("(");
-    MutableString.RemoveFromEnd(")");
-
-    Value = MutableString;
+    const TCHAR* Cursor = Buffer;
+    if (*Cursor == TEXT('('))
+    {
+        Cursor++;
+    }
+    if (!InitFromChars(Cursor))
+    {
+        return false;
+    }
+    if (*Cursor == TEXT(')'))
+    {
+        Cursor++;
+    }
+    Buffer = Cursor;
     return true;
 }
 
@@ -115,7 +106,7 @@ FString URealFixedMath::ConvRealToString(const FRealFixed& InReal)
 
 float URealFixedMath::ConvRealToFloat(const FRealFixed& Val)
 {
-    return Val.Value.ToFloat();
+    return Val.GetValue().ToFloat();
 }
 
 FRealFixed URealFixedMath::ConvStringToReal(const FString& InString)
@@ -189,22 +180,52 @@ bool URealFixedMath::RealSupEqReal(const FRealFixed& First, const FRealFixed& Se
 
 FRealFixed URealFixedMath::Sqrt(const FRealFixed& Val)
 {
-    return FRealFixed(ttmath::Sqrt((Val.ToBig())));
+    return FRealFixed(::Sqrt(Val.GetValue()));
 }
 
 FRealFixed URealFixedMath::LogE(const FRealFixed& Val)
 {
-    return FRealFixed(ttmath::Ln(Val.ToBig()));
+    return FRealFixed(::Ln(Val.GetValue()));
 }
 
 FRealFixed URealFixedMath::Log2(const FRealFixed& Val)
 {
-    return FRealFixed(ttmath::Log(Val.ToBig(), real_fixed_type::ttBigType(2)));
+    return FRealFixed(::Log2(Val.GetValue()));
 }
 
 FRealFixed URealFixedMath::Log10(const FRealFixed& Val)
 {
-    return FRealFixed(ttmath::Log(Val.ToBig(), real_fixed_type::ttBigType(10)));
+    return FRealFixed(::Log10(Val.GetValue()));
+}
+
+FRealFixed URealFixedMath::SinRad(const FRealFixed& Val)
+{
+    return FRealFixed(::Sin(Val.GetValue()));
+}
+
+FRealFixed URealFixedMath::CosRad(const FRealFixed& Val)
+{
+    return FRealFixed(::Cos(Val.GetValue()));
+}
+
+void URealFixedMath::SinCosRad(const FRealFixed& Val, FRealFixed& OutSin, FRealFixed& OutCos)
+{
+    ::SinCos(Val.GetValue(), OutSin.GetValue(), OutCos.GetValue());
+}
+
+FRealFixed URealFixedMath::AtanRad(const FRealFixed& Val)
+{
+    return FRealFixed(::ATan(Val.GetValue()));
+}
+
+FRealFixed URealFixedMath::Atan2Rad(const FRealFixed& Y, const FRealFixed& X)
+{
+    return FRealFixed(::ATan2(Y.GetValue(), X.GetValue()));
+}
+
+FRealFixed URealFixedMath::Hypot(const FRealFixed& X, const FRealFixed& Y, const FRealFixed& Z)
+{
+    return FRealFixed(::Hypot(X.GetValue(), Y.GetValue(), Z.GetValue()));
 }
 
 FRealFixed URealFixedMath::Min(const FRealFixed& Val, const FRealFixed& InMin)
@@ -226,8 +247,3 @@ FRealFixed URealFixedMath::Abs(const FRealFixed& Val)
 {
 	return Val < 0_fx ? -Val : Val;
 }
-
-FRealFixed operator""_fx(const char* str)
-{
-    return FRealFixed(str);
-}
@@ -5,74 +5,110 @@
 
 #include "SpaceKitPrecision/SpaceKitPrecision.h"
 #include "SpaceKitPrecision/Public/RealFixed.h"
+#include "SpaceKitPrecision/Public/RealFloatTrigo.h"
+#include "SpaceKitPrecision/Public/RealFloatExpLog.h"
+#include "SpaceKitPrecision/Public/RealFloatSqrt.h"
 
 
 FRealFloat::FRealFloat()
 {
-    Value = 0.0;
-}
-
-FRealFloat::FRealFloat(const FRealFloat& InValue)
-{
-    Value = InValue.Value;
-}
-
-FRealFloat::FRealFloat(const ttBigType& InValue)
-{
-    Value = InValue;
+    GetValue() = 0.0;
 }
 
 FRealFloat::FRealFloat(int32 InValue)
 {
-    Value = InValue;
+    GetValue() = InValue;
 }
 
 FRealFloat::FRealFloat(uint32 InValue)
 {
-    Value = InValue;
+    GetValue() = InValue;
 }
 
 FRealFloat::FRealFloat(int64 InValue)
 {
-    Value = InValue;
+    GetValue() = InValue;
 }
 
 FRealFloat::FRealFloat(uint64 InValue)
 {
-    Value = InValue;
+    GetValue() = InValue;
 }
 
 FRealFloat::FRealFloat(float InValue)
 {
-    Value = InValue;
+    GetValue() = InValue;
 }
 
 FRealFloat::FRealFloat(double InValue)
 {
-    Value = InValue;
+    GetValue() = InValue;
+}
+
+// Reads a base 10 number into FRealFloat's storage, in a single pass. See FRealFloat::InitFromChars
+template<typename CharType>
+static bool ParseStorage(const CharType*& Buffer, FRealFloat::ttBigType& Out)
+{
+#if USE_BOOST_BIG
+    // Boost parses strings itself: only the number's characters are copied
+    const CharType* Start = Buffer;
+    DecimalConversion::TDecimal<1> Decimal;
+    if (!DecimalConversion::ParseDecimal(Buffer, Decimal))
+    {
+        return false;
+    }
+    std::string String;
+    for (const CharType* Char = Start; Char != Buffer; Char++)
+    {
+        String += char(*Char);
+    }
+    Out = FRealFloat::ttBigType(String);
+    return true;
+#elif USE_MULTI_DOUBLE_BIG
+    // Same precision as MultiDouble's string constructor, then rounded to a multi-double
+    ttmath::Big<1, TTMATH_BITS(53 * MULTI_DOUBLE_SIZE) + 1> Parsed;
+    if (!DecimalConversion::ParseFloat(Buffer, Parsed))
+    {
+        return false;
+    }
+    Out = FRealFloat::ttBigType::FromBig(Parsed);
+    return true;
+#elif USE_FLOAT128_STORAGE
+    // One word wider than the exact ttmath value of a binary128 number, then rounded to it
+    ttmath::Big<1, TTMATH_BITS(128) + 1> Parsed;
+    if (!DecimalConversion::ParseFloat(Buffer, Parsed))
+    {
+        return false;
+    }
+    Out = FRealFloat::ttBigType::FromBig(Parsed);
+    return true;
+#else
+    return DecimalConversion::ParseFloat(Buffer, Out);
+#endif
 }
 
 FRealFloat::FRealFloat(const char* InValue)
 {
-    Value = ttBigType(InValue);
+    GetValue() = 0.0;
+    ParseStorage(InValue, GetValue());
 }
 
 FRealFloat::FRealFloat(const std::string& InValue)
 {
-	if (IsFloat(FString(InValue.c_str())))
-	{
-	    Value = ttBigType(InValue.c_str());
-    }
+    GetValue() = 0.0;
+    const char* Cursor = InValue.c_str();
+    ParseStorage(Cursor, GetValue());
 }
 
 FRealFloat::FRealFloat(const FString& InValue)
 {
-	if (IsFloat(InValue))
-	{
-		Value = ttBigType(TCHAR_TO_ANSI(*InValue));
-    }
+    GetValue() = 0.0;
+    const TCHAR* Cursor = *InValue;
+    ParseStorage(Cursor, GetValue());
 }
 
+#if USE_BOOST_BIG
+
 static FRealFloat::ttBigType GenPi()
 {
     return FRealFloat::ttBigType("3.141592653589793238462643383279502884197");
@@ -87,40 +123,88 @@ FRealFloat FRealFloat::Pi = FRealFloat(GenPi());
 FRealFloat FRealFloat::HalfPi = FRealFloat(GenHalfPi());
 FRealFloat FRealFloat::DegToRad = FRealFloat::Pi / 180_fl;
 
+#else
+
+// The constants are built from their bits at compile time, so they are constant-initialized, and other static initializers can use them
+using FRealFloatConstants = RealFloatConstants::TConstants<FRealFloat::ttBigType>;
+
+FRealFloat FRealFloat::Pi = FRealFloat(FRealFloatConstants::Pi());
+FRealFloat FRealFloat::HalfPi = FRealFloat(FRealFloatConstants::HalfPi());
+FRealFloat FRealFloat::DegToRad = FRealFloat(FRealFloatConstants::DegToRad());
+
+#endif
+
 // Converts this number to a double number. Note that this can lead to huge precision loss
 double FRealFloat::ToDouble() const
 {
-    return Value.ToFloat();
+    return GetValue().ToDouble();
 }
 
 // Converts this number to a float number. Note that this can lead to huge precision loss
 float FRealFloat::ToFloat() const
 {
-    return Value.ToFloat();
+    return GetValue().ToFloat();
+}
+
+int32 FRealFloat::ToChars(TCHAR* Buffer) const
+{
+#if USE_BOOST_BIG || USE_MULTI_DOUBLE_BIG
+    // Multi-doubles have no fixed unit in the last place to round to, so they keep their own rounding to a number of significant digits
+    const std::string String = GetValue().ToString();
+    int32 Length = 0;
+    for (; Length < int32(String.size()) && Length < StringBufferSize - 1; Length++)
+    {
+        Buffer[Length] = TCHAR(String[Length]);
+    }
+    Buffer[Length] = TEXT('\0');
+    return Length;
+#elif USE_FLOAT128_STORAGE
+    // The shortest digits of the exact 128 bits value, which parse back to it, so to this number too
+    return DecimalConversion::WriteFloat(Buffer, GetValue().ToBig<f128math::ExactBigType>());
+#else
+    return DecimalConversion::WriteFloat(Buffer, GetValue());
+#endif
+}
+
+bool FRealFloat::InitFromChars(const TCHAR*& Buffer)
+{
+    return ParseStorage(Buffer, GetValue());
 }
 
 FString FRealFloat::ToString() const
 {
-    return Value.ToString().c_str();
+    TCHAR Buffer[StringBufferSize];
+    const int32 Length = ToChars(Buffer);
+    return FString(Length, Buffer);
 }
 
 bool FRealFloat::ExportTextItem(FString& ValueStr, FRealFloat const& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const
 {
-    ValueStr += FString::Printf(TEXT("(%s)"), *ToString());
+    TCHAR Buffer[StringBufferSize + 2];
+    Buffer[0] = TEXT('(');
+    const int32 Length = ToChars(Buffer + 1) + 1;
+    Buffer[Length] = TEXT(')');
+    ValueStr.AppendChars(Buffer, Length + 1);
     return true;
 }
 
+// Reads "(number)" in place, without copying the rest of the buffer
 bool FRealFloat::ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText)
 {
-    FString MutableString = Buffer;
-    const int32 Len = MutableString.Find(")") + 1;
-    Buffer += Len;
-
-    MutableString = MutableString.Left(Len);
-    MutableString.RemoveFromStart("(");
-    MutableString.RemoveFromEnd(")");
-
-    *this = FRealFloat(MutableString);
+    const TCHAR* Cursor = Buffer;
+    if (*Cursor == TEXT('('))
+    {
+        Cursor++;
+    }
+    if (!InitFromChars(Cursor))
+    {
+        return false;
+    }
+    if (*Cursor == TEXT(')'))
+    {
+        Cursor++;
+    }
+    Buffer = Cursor;
     return true;
 }
 
@@ -134,17 +218,12 @@ FRealFloat FRealFloat::GetMinValue()
     return 1e50_fl;
 }
 
-FRealFloat operator""_fl(const char* str)
-{
-    return FRealFloat(str);
-}
-
-FString URealFloatMath::ConvRealToString(FRealFloat InReal)
+FString URealFloatMath::ConvRealToString(const FRealFloat& InReal)
 {
     return InReal.ToString();
 }
 
-float URealFloatMath::ConvRealToFloat(FRealFloat InVal)
+float URealFloatMath::ConvRealToFloat(const FRealFloat& InVal)
 {
     return InVal.ToFloat();
 }
@@ -161,27 +240,27 @@ FRealFloat URealFloatMath::ConvFloatToReal(float InVal)
 
 // Real math
 
-FRealFloat URealFloatMath::RealPlusReal(FRealFloat First, FRealFloat Second)
+FRealFloat URealFloatMath::RealPlusReal(const FRealFloat& First, const FRealFloat& Second)
 {
-    return FRealFloat(First.Value + Second.Value);
+    return FRealFloat(First.GetValue() + Second.GetValue());
 }
 
-FRealFloat URealFloatMath::RealMinusReal(FRealFloat First, FRealFloat Second)
+FRealFloat URealFloatMath::RealMinusReal(const FRealFloat& First, const FRealFloat& Second)
 {
-    return FRealFloat(First.Value - Second.Value);
+    return FRealFloat(First.GetValue() - Second.GetValue());
 }
 
-FRealFloat URealFloatMath::RealMultReal(FRealFloat First, FRealFloat Second)
+FRealFloat URealFloatMath::RealMultReal(const FRealFloat& First, const FRealFloat& Second)
 {
-    return FRealFloat(First.Value * Second.Value);
+    return FRealFloat(First.GetValue() * Second.GetValue());
 }
 
-FRealFloat URealFloatMath::RealDivReal(FRealFloat First, FRealFloat Second)
+FRealFloat URealFloatMath::RealDivReal(const FRealFloat& First, const FRealFloat& Second)
 {
-    return FRealFloat(First.Value / Second.Value);
+    return FRealFloat(First.GetValue() / Second.GetValue());
 }
 
-bool URealFloatMath::RealEqualsReal(FRealFloat First, FRealFloat Second, FRealFloat Tolerance)
+bool URealFloatMath::RealEqualsReal(const FRealFloat& First, const FRealFloat& Second, const FRealFloat& Tolerance)
 {
     return Abs(First - Second) < Tolerance;
 }
@@ -191,86 +270,137 @@ bool URealFloatMath::RealNotEqualsReal(const FRealFloat& First, const FRealFloat
     return !URealFloatMath::RealEqualsReal(First, Second, Tolerance);
 }
 
-bool URealFloatMath::RealInfReal(FRealFloat First, FRealFloat Second)
+bool URealFloatMath::RealInfReal(const FRealFloat& First, const FRealFloat& Second)
+{
+    return First.GetValue() < Second.GetValue();
+}
+
+bool URealFloatMath::RealInfEqReal(const FRealFloat& First, const FRealFloat& Second)
+{
+    return First.GetValue() <= Second.GetValue();
+}
+
+bool URealFloatMath::RealSupReal(const FRealFloat& First, const FRealFloat& Second)
 {
-    return First.Value < Second.Value;
+    return First.GetValue() > Second.GetValue();
 }
 
-bool URealFloatMath::RealInfEqReal(FRealFloat First, FRealFloat Second)
+bool URealFloatMath::RealSupEqReal(const FRealFloat& First, const FRealFloat& Second)
 {
-    return First.Value <= Second.Value;
+    return First.GetValue() >= Second.GetValue();
 }
 
-bool URealFloatMath::RealSupReal(FRealFloat First, FRealFloat Second)
+FRealFloat URealFloatMath::MultiplyAdd(const FRealFloat& X, const FRealFloat& Y, const FRealFloat& Z)
 {
-    return First.Value > Second.Value;
+    static const FRealFloat::ttBigType One(1);
+    const FRealFloat::ttBigType* const Xs[] = { &X.GetValue(), &Z.GetValue() };
+    const FRealFloat::ttBigType* const Ys[] = { &Y.GetValue(), &One };
+    return FRealFloat(::SumOfProducts(Xs, Ys));
 }
 
-bool URealFloatMath::RealSupEqReal(FRealFloat First, FRealFloat Second)
+FRealFloat URealFloatMath::SumOfProducts(const FRealFloat& X0, const FRealFloat& Y0, const FRealFloat& X1, const FRealFloat& Y1)
 {
-    return First.Value >= Second.Value;
+    const FRealFloat::ttBigType* const Xs[] = { &X0.GetValue(), &X1.GetValue() };
+    const FRealFloat::ttBigType* const Ys[] = { &Y0.GetValue(), &Y1.GetValue() };
+    return FRealFloat(::SumOfProducts(Xs, Ys));
+}
+
+FRealFloat URealFloatMath::SumOfProducts(const FRealFloat& X0, const FRealFloat& Y0, const FRealFloat& X1, const FRealFloat& Y1, const FRealFloat& X2, const FRealFloat& Y2)
+{
+    const FRealFloat::ttBigType* const Xs[] = { &X0.GetValue(), &X1.GetValue(), &X2.GetValue() };
+    const FRealFloat::ttBigType* const Ys[] = { &Y0.GetValue(), &Y1.GetValue(), &Y2.GetValue() };
+    return FRealFloat(::SumOfProducts(Xs, Ys));
+}
+
+FRealFloat URealFloatMath::SumOfProducts(const FRealFloat& X0, const FRealFloat& Y0, const FRealFloat& X1, const FRealFloat& Y1, const FRealFloat& X2, const FRealFloat& Y2, const FRealFloat& X3, const FRealFloat& Y3)
+{
+    const FRealFloat::ttBigType* const Xs[] = { &X0.GetValue(), &X1.GetValue(), &X2.GetValue(), &X3.GetValue() };
+    const FRealFloat::ttBigType* const Ys[] = { &Y0.GetValue(), &Y1.GetValue(), &Y2.GetValue(), &Y3.GetValue() };
+    return FRealFloat(::SumOfProducts(Xs, Ys));
 }
 
 // Advanced FRealFloat math (trigo)
 
-FRealFloat URealFloatMath::NormalizeAngleRad(FRealFloat InVal)
+FRealFloat URealFloatMath::NormalizeAngleRad(const FRealFloat& InVal)
 {
     const FRealFloat Intermediate = (InVal + FRealFloat::Pi) % (FRealFloat::Pi * 2_fl);
     return Intermediate + ((Intermediate < 0_fl) ? FRealFloat::Pi : -FRealFloat::Pi);
 }
 
-FRealFloat URealFloatMath::SinRad(FRealFloat InVal)
+FRealFloat URealFloatMath::SinRad(const FRealFloat& InVal)
 {
-	return FRealFloat(ttmath::Sin(InVal.Value));
+    FRealFloat Sin, Cos;
+    SinCosRad(InVal, Sin, Cos);
+    return Sin;
 }
 
-FRealFloat URealFloatMath::CosRad(FRealFloat InVal)
+FRealFloat URealFloatMath::CosRad(const FRealFloat& InVal)
 {
-    return FRealFloat(ttmath::Cos(InVal.Value));
+    FRealFloat Sin, Cos;
+    SinCosRad(InVal, Sin, Cos);
+    return Cos;
 }
 
-FRealFloat URealFloatMath::TanRad(FRealFloat InVal)
+FRealFloat URealFloatMath::TanRad(const FRealFloat& InVal)
 {
-    return FRealFloat(ttmath::Tan(InVal.Value));
+    FRealFloat Sin, Cos;
+    SinCosRad(InVal, Sin, Cos);
+    return Sin / Cos;
 }
 
-FRealFloat URealFloatMath::NormalizeAngleDeg(FRealFloat InVal)
+void URealFloatMath::SinCosRad(const FRealFloat& InVal, FRealFloat& OutSin, FRealFloat& OutCos)
+{
+    RealFloatTrigo::SinCos(InVal.GetValue(), OutSin.GetValue(), OutCos.GetValue());
+}
+
+FRealFloat URealFloatMath::NormalizeAngleDeg(const FRealFloat& InVal)
 {
     const FRealFloat Intermediate = (InVal + 180_fl) % 360_fl;
     return Intermediate + ((Intermediate < 0_fl) ? 180_fl : FRealFloat(-180.0));
 }
 
-FRealFloat URealFloatMath::SinDeg(FRealFloat InVal)
+FRealFloat URealFloatMath::SinDeg(const FRealFloat& InVal)
+{
+    FRealFloat Sin, Cos;
+    SinCosDeg(InVal, Sin, Cos);
+    return Sin;
+}
+
+FRealFloat URealFloatMath::CosDeg(const FRealFloat& InVal)
 {
-    return FRealFloat(ttmath::Sin((InVal * FRealFloat::DegToRad).Value));
+    FRealFloat Sin, Cos;
+    SinCosDeg(InVal, Sin, Cos);
+    return Cos;
 }
 
-FRealFloat URealFloatMath::CosDeg(FRealFloat InVal)
+FRealFloat URealFloatMath::TanDeg(const FRealFloat& InVal)
 {
-    return FRealFloat(ttmath::Cos((InVal * FRealFloat::DegToRad).Value));
+    FRealFloat Sin, Cos;
+    SinCosDeg(InVal, Sin, Cos);
+    return Sin / Cos;
 }
 
-FRealFloat URealFloatMath::TanDeg(FRealFloat InVal)
+void URealFloatMath::SinCosDeg(const FRealFloat& InVal, FRealFloat& OutSin, FRealFloat& OutCos)
 {
-    return FRealFloat(ttmath::ATan((InVal * FRealFloat::DegToRad).Value));
+    RealFloatTrigo::SinCosDeg(InVal.GetValue(), OutSin.GetValue(), OutCos.GetValue());
 }
 
-FRealFloat URealFloatMath::AsinRad(FRealFloat InVal)
+FRealFloat URealFloatMath::AsinRad(const FRealFloat& InVal)
 {
-    return FRealFloat(ttmath::ASin(InVal.Value));
+    return FRealFloat(RealFloatBackend::ASin(InVal.GetValue()));
 }
 
-FRealFloat URealFloatMath::AcosRad(FRealFloat InVal)
+FRealFloat URealFloatMath::AcosRad(const FRealFloat& InVal)
 {
-    return FRealFloat(ttmath::ACos(InVal.Value));
+    return FRealFloat(RealFloatBackend::ACos(InVal.GetValue()));
 }
 
-FRealFloat URealFloatMath::AtanRad(FRealFloat InVal)
+FRealFloat URealFloatMath::AtanRad(const FRealFloat& InVal)
 {
-    return FRealFloat(ttmath::ATan(InVal.Value));
+    return FRealFloat(RealFloatTrigo::ATan(InVal.GetValue()));
 }
 
-FRealFloat URealFloatMath::Atan2Rad(FRealFloat Y, FRealFloat X)
+FRealFloat URealFloatMath::Atan2Rad(const FRealFloat& Y, const FRealFloat& X)
 {
 	// Undefined case, but we don't want to throw an exception, or to return NaN
     if (X == 0_fl && Y == 0_fl)
@@ -310,80 +440,105 @@ FRealFloat URealFloatMath::Atan2Rad(FRealFloat Y, FRealFloat X)
     return Angle;
 }
 
-FRealFloat URealFloatMath::AsinDeg(FRealFloat InVal)
+// Radians to degrees conversions divide by DegToRad, so its inverse is computed once
+static const FRealFloatReciprocal& GetDegToRadReciprocal()
+{
+    static const FRealFloatReciprocal DegToRadReciprocal(FRealFloat::DegToRad);
+    return DegToRadReciprocal;
+}
+
+FRealFloat URealFloatMath::AsinDeg(const FRealFloat& InVal)
 {
-    return FRealFloat(ttmath::ASin(InVal.Value)) / FRealFloat::DegToRad;
+    return FRealFloat(RealFloatBackend::ASin(InVal.GetValue())) / GetDegToRadReciprocal();
 }
 
-FRealFloat URealFloatMath::AcosDeg(FRealFloat InVal)
+FRealFloat URealFloatMath::AcosDeg(const FRealFloat& InVal)
 {
-    return FRealFloat(ttmath::ACos(InVal.Value)) / FRealFloat::DegToRad;
+    return FRealFloat(RealFloatBackend::ACos(InVal.GetValue())) / GetDegToRadReciprocal();
 }
 
-FRealFloat URealFloatMath::AtanDeg(FRealFloat InVal)
+FRealFloat URealFloatMath::AtanDeg(const FRealFloat& InVal)
 {
-    return FRealFloat(ttmath::ATan(InVal.Value)) / FRealFloat::DegToRad;
+    return FRealFloat(RealFloatTrigo::ATan(InVal.GetValue())) / GetDegToRadReciprocal();
 }
 
-FRealFloat URealFloatMath::Atan2Deg(FRealFloat Y, FRealFloat X)
+FRealFloat URealFloatMath::Atan2Deg(const FRealFloat& Y, const FRealFloat& X)
 {
-    return Atan2Rad(Y, X) / FRealFloat::DegToRad;
+    return Atan2Rad(Y, X) / GetDegToRadReciprocal();
 }
 
 // Advanced FRealFloat math
 
-FRealFloat URealFloatMath::Pow(FRealFloat X, FRealFloat Y)
+FRealFloat URealFloatMath::Pow(const FRealFloat& X, const FRealFloat& Y)
 {
+    // Small integer exponents are much faster, and exact, by square-and-multiply
+    static const double MaxIntPower = 1024.0;
+    const double YDouble = Y.ToDouble();
+    if (FMath::Abs(YDouble) <= MaxIntPower && FMath::FloorToDouble(YDouble) == YDouble && FRealFloat(YDouble) == Y)
+    {
+        return PowInt(X, int32(YDouble));
+    }
+
 	// a^b = e^(b*ln(a))
-    return FRealFloat(ttmath::Exp(Y.Value * ttmath::Ln(X.Value)));
+    return FRealFloat(RealFloatExpLog::Exp(Y.GetValue() * RealFloatExpLog::Ln(X.GetValue())));
+}
+
+FRealFloat URealFloatMath::PowInt(const FRealFloat& X, int32 Power)
+{
+    return FRealFloat(RealFloatExpLog::PowInt(X.GetValue(), Power));
+}
+
+FRealFloat URealFloatMath::Sqrt(const FRealFloat& Val)
+{
+    return FRealFloat(RealFloatSqrt::Sqrt(Val.GetValue()));
 }
 
-FRealFloat URealFloatMath::Sqrt(FRealFloat Val)
+FRealFloat URealFloatMath::InvSqrt(const FRealFloat& Val)
 {
-    return FRealFloat(ttmath::Sqrt(Val.Value));
+    return FRealFloat(RealFloatSqrt::InvSqrt(Val.GetValue()));
 }
 
-FRealFloat URealFloatMath::Exp(FRealFloat Val)
+FRealFloat URealFloatMath::Exp(const FRealFloat& Val)
 {
-    return FRealFloat(ttmath::Exp(Val.Value));
+    return FRealFloat(RealFloatExpLog::Exp(Val.GetValue()));
 }
 
-FRealFloat URealFloatMath::LogE(FRealFloat Val)
+FRealFloat URealFloatMath::LogE(const FRealFloat& Val)
 {
-    return FRealFloat(ttmath::Ln(Val.Value));
+    return FRealFloat(RealFloatExpLog::Ln(Val.GetValue()));
 }
 
-FRealFloat URealFloatMath::Log2(FRealFloat Val)
+FRealFloat URealFloatMath::Log2(const FRealFloat& Val)
 {
-    return FRealFloat(ttmath::Log(Val.Value, FRealFloat(2).Value));
+    return FRealFloat(RealFloatExpLog::Log2(Val.GetValue()));
 }
 
-FRealFloat URealFloatMath::Log10(FRealFloat Val)
+FRealFloat URealFloatMath::Log10(const FRealFloat& Val)
 {
-    return FRealFloat(ttmath::Log(Val.Value, FRealFloat(10).Value));
+    return FRealFloat(RealFloatExpLog::Log10(Val.GetValue()));
 }
 
-FRealFloat URealFloatMath::Min(FRealFloat First, FRealFloat Second)
+FRealFloat URealFloatMath::Min(const FRealFloat& First, const FRealFloat& Second)
 {
     return FRealFloat(First < Second ? First : Second);
 }
 
-FRealFloat URealFloatMath::Max(FRealFloat First, FRealFloat Second)
+FRealFloat URealFloatMath::Max(const FRealFloat& First, const FRealFloat& Second)
 {
     return FRealFloat(First > Second ? First : Second);
 }
 
-FRealFloat URealFloatMath::Clamp(FRealFloat Val, FRealFloat MinVal, FRealFloat MaxVal)
+FRealFloat URealFloatMath::Clamp(const FRealFloat& Val, const FRealFloat& MinVal, const FRealFloat& MaxVal)
 {
     return Max(Min(Val, MaxVal), MinVal);
 }
 
-FRealFloat URealFloatMath::Abs(FRealFloat Val)
+FRealFloat URealFloatMath::Abs(const FRealFloat& Val)
 {
-    return FRealFloat(ttmath::Abs(Val.Value));
+    return FRealFloat(RealFloatBackend::Abs(Val.GetValue()));
 }
 
-FRealFloat URealFloatMath::Sign(FRealFloat Val)
+FRealFloat URealFloatMath::Sign(const FRealFloat& Val)
 {
     return FRealFloat(Val < FRealFloat(0) ? 1 : -1);
 }
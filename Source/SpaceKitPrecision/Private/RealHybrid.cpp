@@ -0,0 +1,78 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "SpaceKitPrecision/Public/RealHybrid.h"
+
+#include "SpaceKitPrecision/SpaceKitPrecision.h"
+
+#include "CoreUObject/Public/UObject/PropertyTag.h"
+
+
+// The text is FRealFloat's, so copied values paste from one type to the other
+bool FRealHybrid::ExportTextItem(FString& ValueStr, FRealHybrid const& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const
+{
+	return FRealFloat(*this).ExportTextItem(ValueStr, FRealFloat(DefaultValue), Parent, PortFlags, ExportRootScope);
+}
+
+bool FRealHybrid::ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText)
+{
+	FRealFloat Value;
+	if (!Value.ImportTextItem(Buffer, PortFlags, Parent, ErrorText))
+	{
+		return false;
+	}
+	*this = Value;
+	return true;
+}
+
+bool FRealHybrid::SerializeFromMismatchedTag(const FPropertyTag& Tag, FStructuredArchive::FSlot Slot)
+{
+	static const FName RealFloatName(TEXT("RealFloat"));
+	if (Tag.Type == NAME_StructProperty && Tag.StructName == RealFloatName)
+	{
+		FRealFloat Value;
+		FRealFloat::StaticStruct()->SerializeItem(Slot, &Value, nullptr);
+		*this = Value;
+		return true;
+	}
+	return false;
+}
+
+FRealFloat URealHybridMath::ConvRealHybridToRealFloat(const FRealHybrid& InVal)
+{
+	return InVal;
+}
+
+FRealHybrid URealHybridMath::ConvRealFloatToRealHybrid(const FRealFloat& InVal)
+{
+	return FRealHybrid(InVal);
+}
+
+FString URealHybridMath::ConvRealHybridToString(const FRealHybrid& InVal)
+{
+	return InVal.ToString();
+}
+
+FRealHybrid URealHybridMath::HybridPlusHybrid(const FRealHybrid& First, const FRealHybrid& Second)
+{
+	return First + Second;
+}
+
+FRealHybrid URealHybridMath::HybridMinusHybrid(const FRealHybrid& First, const FRealHybrid& Second)
+{
+	return First - Second;
+}
+
+FRealHybrid URealHybridMath::HybridMultHybrid(const FRealHybrid& First, const FRealHybrid& Second)
+{
+	return First * Second;
+}
+
+FRealHybrid URealHybridMath::HybridDivHybrid(const FRealHybrid& First, const FRealHybrid& Second)
+{
+	return First / Second;
+}
+
+bool URealHybridMath::IsBig(const FRealHybrid& InVal)
+{
+	return InVal.IsBig();
+}
@@ -8,12 +8,12 @@ FRotatorFloat FRotatorFloat::Identity = FRotatorFloat();
 FRotatorFloat::FRotatorFloat(const FQuatFloat& Rotator)
 {
     // Roll (X-axis rotation)
-    const FRealFloat sinr_cosp = 2_fl * (Rotator.W * Rotator.X + Rotator.Y * Rotator.Z);
-    const FRealFloat cosr_cosp = 1_fl - 2_fl * (Rotator.X * Rotator.X + Rotator.Y * Rotator.Y);
+    const FRealFloat sinr_cosp = 2_fl * URealFloatMath::SumOfProducts(Rotator.W, Rotator.X, Rotator.Y, Rotator.Z);
+    const FRealFloat cosr_cosp = URealFloatMath::MultiplyAdd(-2_fl, URealFloatMath::SumOfProducts(Rotator.X, Rotator.X, Rotator.Y, Rotator.Y), 1_fl);
     Roll = URealFloatMath::Atan2Deg(sinr_cosp, cosr_cosp);
 
     // Pitch (Y-axis rotation)
-    const FRealFloat sinp = 2_fl * (Rotator.W * Rotator.Y - Rotator.Z * Rotator.X);
+    const FRealFloat sinp = 2_fl * URealFloatMath::SumOfProducts(Rotator.W, Rotator.Y, -Rotator.Z, Rotator.X);
     if (URealFloatMath::Abs(sinp) >= 1_fl)
     {
         Pitch = URealFloatMath::Sign(sinp) * 90_fl; // Use 90 degrees if out of range
@@ -24,8 +24,8 @@ FRotatorFloat::FRotatorFloat(const FQuatFloat& Rotator)
     }
 
     // Yaw (Z-axis rotation)
-    const FRealFloat siny_cosp = 2_fl * (Rotator.W * Rotator.Z + Rotator.X * Rotator.Y);
-    const FRealFloat cosy_cosp = 1_fl - 2_fl * (Rotator.Y * Rotator.Y + Rotator.Z * Rotator.Z);
+    const FRealFloat siny_cosp = 2_fl * URealFloatMath::SumOfProducts(Rotator.W, Rotator.Z, Rotator.X, Rotator.Y);
+    const FRealFloat cosy_cosp = URealFloatMath::MultiplyAdd(-2_fl, URealFloatMath::SumOfProducts(Rotator.Y, Rotator.Y, Rotator.Z, Rotator.Z), 1_fl);
     Yaw = URealFloatMath::Atan2Deg(siny_cosp, cosy_cosp);
 }
 
@@ -0,0 +1,138 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Containers/UnrealString.h"
+#include "Core/Public/Misc/AutomationTest.h"
+
+#include "SpaceKitPrecision/Public/FixedVectorSoA.h"
+#include "SpaceKitPrecision/Public/VectorFixed.h"
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SpaceKitFixedVectorSoATest
+{
+	// A random number: mostly moderate values, whose sums carry and borrow across the words as their signs change,
+	// and sometimes any mantissa, whose sums and products overflow
+	FRealFixed RandomReal(FRandomStream& Random)
+	{
+		if (Random.GetFraction() < 0.75)
+		{
+			return FRealFixed((Random.GetFraction() * 2 - 1) * FMath::Pow(10.0, Random.FRandRange(-6.f, 9.f)));
+		}
+
+		real_fixed_type::ttIntType Mantissa;
+		for (ttmath::uint Word = 0; Word < TTMATH_BITS(REAL_FIXED_MANTISSA_SIZE + REAL_FIXED_EXPONENT); Word++)
+		{
+			Mantissa.table[Word] = ttmath::uint((uint64(Random.GetUnsignedInt()) << 32) | Random.GetUnsignedInt());
+		}
+		return FRealFixed(real_fixed_type::FromMantissa(Mantissa));
+	}
+
+	FVectorFixed RandomVector(FRandomStream& Random)
+	{
+		return FVectorFixed(RandomReal(Random), RandomReal(Random), RandomReal(Random));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionFixedVectorSoAOperationsTest, "SpaceKitPrecision.VectorFixedMath.StructureOfArrays", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpacePrecisionFixedVectorSoAOperationsTest::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitFixedVectorSoATest;
+
+	// Not a multiple of the lanes count, so the scalar loops run too
+	const int32 Num = 4 * FFixedVectorSoA::LaneCount + 3;
+
+	FRandomStream Random(7);
+	TArray<FVectorFixed> First, Second;
+	for (int32 Index = 0; Index < Num; Index++)
+	{
+		First.Add(RandomVector(Random));
+		Second.Add(RandomVector(Random));
+	}
+
+	// Edge cases: equal values, opposite ones, the lowest and highest values, and values around the words' boundaries
+	const FRealFixed WordBoundary = FRealFixed(FMath::Pow(2.0, 64.0 - REAL_FIXED_EXPONENT));
+	First[0] = FVectorFixed(1_fx, -0.5_fx, FRealFixed::GetMaxValue());
+	Second[0] = FVectorFixed(1_fx, 0.5_fx, 1_fx);
+	First[1] = FVectorFixed(WordBoundary, -WordBoundary, FRealFixed::GetMinValue());
+	Second[1] = FVectorFixed(-FRealFixed::GetMinValue(), FRealFixed::GetMinValue(), 1_fx);
+	First[2] = FVectorFixed(FRealFixed::GetMaxValue(), FRealFixed::GetMinValue(), 0_fx);
+	Second[2] = FVectorFixed(FRealFixed::GetMinValue(), FRealFixed::GetMaxValue(), -0_fx);
+
+	const FRealFixed RandomScalar = RandomReal(Random);
+	const auto Check = [&](const TCHAR* Operation, const FFixedVectorSoA& Result, auto Expected)
+	{
+		TArray<FVectorFixed> Vectors;
+		Result.Scatter(Vectors);
+		TestEqual(FString::Printf(TEXT("%s count"), Operation), Vectors.Num(), Num);
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			if (!(Vectors[Index] == Expected(First[Index], Second[Index])))
+			{
+				AddError(FString::Printf(TEXT("%s of vectors %d: %s instead of %s"), Operation, Index, *Vectors[Index].ToString(), *Expected(First[Index], Second[Index]).ToString()));
+			}
+		}
+	};
+
+	FFixedVectorSoA FirstSoA, SecondSoA;
+	FirstSoA.Gather(First);
+	SecondSoA.Gather(Second);
+	Check(TEXT("Gather"), FirstSoA, [](const FVectorFixed& x, const FVectorFixed& y) { return x; });
+
+	FFixedVectorSoA Result = FirstSoA;
+	Result.Add(SecondSoA);
+	Check(TEXT("Addition"), Result, [](const FVectorFixed& x, const FVectorFixed& y) { return x + y; });
+
+	Result = FirstSoA;
+	Result.Sub(SecondSoA);
+	Check(TEXT("Substraction"), Result, [](const FVectorFixed& x, const FVectorFixed& y) { return x - y; });
+
+	// Scalars of both signs, and the lowest one, whose absolute value is itself
+	for (const FRealFixed& Scalar : { RandomScalar, -RandomScalar, 1_fx / 60_fx, FRealFixed::GetMinValue() })
+	{
+		Result = FirstSoA;
+		Result.Scale(Scalar.GetValue());
+		Check(TEXT("Scale"), Result, [&](const FVectorFixed& x, const FVectorFixed& y) { return x * Scalar; });
+
+		Result = FirstSoA;
+		Result.AddScaled(SecondSoA, Scalar.GetValue());
+		Check(TEXT("Scaled addition"), Result, [&](const FVectorFixed& x, const FVectorFixed& y) { return x + y * Scalar; });
+	}
+
+	const auto MinReal = [](const FRealFixed& x, const FRealFixed& y) { return y < x ? y : x; };
+	Result = FirstSoA;
+	Result.Min(SecondSoA);
+	Check(TEXT("Min"), Result, [&](const FVectorFixed& x, const FVectorFixed& y) { return FVectorFixed(MinReal(x.X, y.X), MinReal(x.Y, y.Y), MinReal(x.Z, y.Z)); });
+
+	const auto MaxReal = [](const FRealFixed& x, const FRealFixed& y) { return x < y ? y : x; };
+	Result = FirstSoA;
+	Result.Max(SecondSoA);
+	Check(TEXT("Max"), Result, [&](const FVectorFixed& x, const FVectorFixed& y) { return FVectorFixed(MaxReal(x.X, y.X), MaxReal(x.Y, y.Y), MaxReal(x.Z, y.Z)); });
+
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		TArray<bool> Less;
+		FirstSoA.Less(SecondSoA, Axis, Less);
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			const EAxis::Type AxisType = Axis == 0 ? EAxis::X : Axis == 1 ? EAxis::Y : EAxis::Z;
+			TestEqual(FString::Printf(TEXT("Comparison of vectors %d on axis %d"), Index, Axis), Less[Index], First[Index].GetAxis(AxisType) < Second[Index].GetAxis(AxisType));
+		}
+	}
+
+	// Single vectors, at the native precision
+	Result.SetNum(Num + 1);
+	Result.Set(Num, TVectorFixed<REAL_FIXED_MANTISSA_SIZE, REAL_FIXED_EXPONENT>(First[3]));
+	TestTrue(TEXT("Predefined set"), FVectorFixed(Result.Get(Num)) == First[3]);
+	TestTrue(TEXT("Predefined get"), FVectorFixed(Result.Get(0)) == FVectorFixed(MaxReal(First[0].X, Second[0].X), MaxReal(First[0].Y, Second[0].Y), MaxReal(First[0].Z, Second[0].Z)));
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+#endif //WITH_DEV_AUTOMATION_TESTS
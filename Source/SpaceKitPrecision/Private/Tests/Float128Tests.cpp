@@ -0,0 +1,171 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Containers/UnrealString.h"
+#include "Core/Public/Misc/AutomationTest.h"
+
+#include "SpaceKitPrecision/Public/Float128.h"
+#include "SpaceKitPrecision/Public/RealFloatConstants.h"
+#include "SpaceKitPrecision/Public/RealFloatTrigo.h"
+#include "SpaceKitPrecision/Public/RealFloatExpLog.h"
+#include "SpaceKitPrecision/Public/RealFloatSqrt.h"
+#include "SpaceKitPrecision/Private/Tests/PrecisionTestHelpers.h"
+
+
+#if WITH_DEV_AUTOMATION_TESTS && SPACEKIT_HAS_FLOAT128
+
+namespace SpaceKitFloat128Test
+{
+	using f128math::Float128;
+
+	// Reference type, much more precise than a binary128 number
+	using ReferenceType = ttmath::Big<1, 6>;
+
+	ReferenceType ToReference(const Float128& Value)
+	{
+		return Value.ToBig<ReferenceType>();
+	}
+
+	// 2^Power, as a reference number
+	ReferenceType PowerOfTwo(int32 Power)
+	{
+		ReferenceType Result = 1;
+		Result.exponent.Add(Power);
+		return Result;
+	}
+
+	// Relative error of Value, or absolute error if bAbsolute is true
+	double Error(const Float128& Value, const ReferenceType& Expected, bool bAbsolute)
+	{
+		const ReferenceType Difference = ttmath::Abs(ToReference(Value) - Expected);
+		return bAbsolute || Expected.IsZero() ? Difference.ToDouble() : (Difference / ttmath::Abs(Expected)).ToDouble();
+	}
+
+	// Whether a compile time constant has the bits of Expected
+	bool IsConstant(const RealFloatConstants::TConstants<Float128>::StorageType& Constant, const Float128& Expected)
+	{
+		return Constant.Words[0] == Expected.Words[0] && Constant.Words[1] == Expected.Words[1];
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathFloat128ConversionsTest, "SpaceKitPrecision.FloatingPointMath.Float128Conversions", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathFloat128ConversionsTest::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitFloat128Test;
+
+	// 64 bits integers are exact
+	TestEqual(TEXT("Predefined integer 1"), FString(Float128(int64(MIN_int64)).ToString().c_str()), FString(TEXT("-9.223372036854775808e+18")));
+	TestEqual(TEXT("Predefined integer 2"), FString(Float128(uint64(MAX_uint64)).ToString().c_str()), FString(TEXT("1.8446744073709551615e+19")));
+
+	// Conversions to ttmath are exact, and back again
+	FRandomStream Random(42);
+	for (int32 Index = 0; Index < 256; Index++)
+	{
+		const Float128 Number = SpaceKitPrecisionTest::RandomMultiPart<Float128>(Random, 2, -300, 300);
+		const Float128 RoundTrip = Float128::FromBig(ToReference(Number));
+		if (RoundTrip.Words[0] != Number.Words[0] || RoundTrip.Words[1] != Number.Words[1])
+		{
+			AddError(FString::Printf(TEXT("Round trip through ttmath changed %s"), UTF8_TO_TCHAR(Number.ToString().c_str())));
+		}
+	}
+
+	// Ttmath numbers are rounded to nearest, with the halves rounded to even
+	const ReferenceType One = 1;
+	const ReferenceType Ulp = PowerOfTwo(-112);
+	TestTrue(TEXT("Round down below half"), Float128::FromBig(One + Ulp * ReferenceType("0.49")) == Float128(1.0));
+	TestTrue(TEXT("Round up above half"), ToReference(Float128::FromBig(One + Ulp * ReferenceType("0.51"))) == One + Ulp);
+	TestTrue(TEXT("Round half to even down"), Float128::FromBig(One + Ulp / 2) == Float128(1.0));
+	TestTrue(TEXT("Round half to even up"), ToReference(Float128::FromBig(One + Ulp * ReferenceType("1.5"))) == One + Ulp * 2);
+	TestTrue(TEXT("Round up to the next power of two"), Float128::FromBig(ReferenceType(2) - Ulp / 4) == Float128(2.0));
+
+	// Subnormal numbers, and the limits of the range
+	const ReferenceType Smallest = PowerOfTwo(f128math::MinLowestBitExponent);
+	const Float128 SmallestNumber = Float128::FromBig(Smallest);
+	TestTrue(TEXT("Smallest subnormal"), SmallestNumber.Words[0] == 1 && SmallestNumber.Words[1] == 0);
+	TestTrue(TEXT("Smallest subnormal round trip"), ToReference(SmallestNumber) == Smallest);
+	TestTrue(TEXT("Subnormal round trip"), ToReference(Float128::FromBig(Smallest * 12345)) == Smallest * 12345);
+	TestTrue(TEXT("Underflow"), Float128::FromBig(Smallest / 3).IsZero());
+	TestTrue(TEXT("Underflow rounded up"), Float128::FromBig(Smallest * ReferenceType("0.75")) == SmallestNumber);
+	TestTrue(TEXT("Underflow half to even"), Float128::FromBig(Smallest / 2).IsZero());
+	TestTrue(TEXT("Subnormal product"), (SmallestNumber * Float128(3.0)) == Float128::FromBig(Smallest * 3));
+	TestTrue(TEXT("Overflow"), Float128::FromBig(PowerOfTwo(f128math::MaxHighestBitExponent + 1)).Words[1] == f128math::InfinityHighWord);
+	TestTrue(TEXT("Largest power of two"), ToReference(Float128::FromBig(PowerOfTwo(f128math::MaxHighestBitExponent))) == PowerOfTwo(f128math::MaxHighestBitExponent));
+	TestTrue(TEXT("Negative zero"), Float128::FromBig(-Smallest / 3).IsSign());
+
+	// Compile time constants are the rounded ttmath ones
+	ReferenceType Pi;
+	Pi.SetPi();
+	TestTrue(TEXT("Pi constant"), IsConstant(RealFloatConstants::TConstants<Float128>::Pi(), Float128::FromBig(Pi)));
+	TestTrue(TEXT("Half pi constant"), IsConstant(RealFloatConstants::TConstants<Float128>::HalfPi(), Float128::FromBig(Pi / 2)));
+	TestTrue(TEXT("Degrees to radians constant"), IsConstant(RealFloatConstants::TConstants<Float128>::DegToRad(), Float128::FromBig(Pi / 180)));
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathFloat128PrecisionTest, "SpaceKitPrecision.FloatingPointMath.Float128Precision", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathFloat128PrecisionTest::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitFloat128Test;
+
+	// Half an ulp for the arithmetic, and a few ulps for the functions
+	const double Epsilon = std::ldexp(1.0, -113);
+	const double Tolerance = 16 * Epsilon;
+
+	FRandomStream Random(42);
+	for (int32 Index = 0; Index < 256; Index++)
+	{
+		const Float128 x = SpaceKitPrecisionTest::RandomMultiPart<Float128>(Random, 2, -5, 5);
+		const Float128 y = SpaceKitPrecisionTest::RandomMultiPart<Float128>(Random, 2, -5, 5);
+		const ReferenceType ReferenceX = ToReference(x);
+		const ReferenceType ReferenceY = ToReference(y);
+		const Float128 AbsX = f128math::Abs(x);
+		const ReferenceType ReferenceAbsX = ttmath::Abs(ReferenceX);
+
+		// Small values for the functions that overflow, and values in ]-1, 1[ for the inverse trigonometric ones
+		const Float128 SmallX = x / Float128(FMath::Max(1.0, FMath::Abs(x.ToDouble()) / 10));
+		const Float128 UnitX = x / Float128(2 * FMath::Max(1.0, FMath::Abs(x.ToDouble())));
+
+		const auto Check = [&](const TCHAR* Operation, const Float128& Value, const ReferenceType& Expected, double OperationTolerance, bool bAbsolute = false)
+		{
+			const double OperationError = Error(Value, Expected, bAbsolute);
+			if (!(OperationError <= OperationTolerance))
+			{
+				AddError(FString::Printf(TEXT("%s: error %g with %s"), Operation, OperationError, UTF8_TO_TCHAR(x.ToString().c_str())));
+			}
+		};
+
+		Check(TEXT("addition"), x + y, ReferenceX + ReferenceY, Epsilon);
+		Check(TEXT("substraction"), x - y, ReferenceX - ReferenceY, Epsilon);
+		Check(TEXT("multiplication"), x * y, ReferenceX * ReferenceY, Epsilon);
+		Check(TEXT("division"), x / y, ReferenceX / ReferenceY, Epsilon);
+		Check(TEXT("square root"), RealFloatSqrt::Sqrt(AbsX), ttmath::Sqrt(ReferenceAbsX), Tolerance);
+		Check(TEXT("inverse square root"), RealFloatSqrt::InvSqrt(AbsX), ReferenceType(1) / ttmath::Sqrt(ReferenceAbsX), Tolerance);
+		Check(TEXT("exponential"), RealFloatExpLog::Exp(SmallX), ttmath::Exp(ToReference(SmallX)), Tolerance);
+		Check(TEXT("arc tangent"), RealFloatTrigo::ATan(x), ttmath::ATan(ReferenceX), Tolerance);
+		Check(TEXT("arc sine"), f128math::ASin(UnitX), ttmath::ASin(ToReference(UnitX)), Tolerance);
+
+		// The logarithm is close to zero around 1, so check its absolute error
+		Check(TEXT("logarithm"), RealFloatExpLog::Ln(AbsX), ttmath::Ln(ReferenceAbsX), Tolerance * 16, true);
+
+		// The reduction modulo 2 pi loses as many digits as the angle has in front of the comma
+		const double AngleTolerance = Tolerance * FMath::Max(1.0, FMath::Abs(SmallX.ToDouble()));
+		Float128 Sin, Cos;
+		RealFloatTrigo::SinCos(SmallX, Sin, Cos);
+		Check(TEXT("sine"), Sin, ttmath::Sin(ToReference(SmallX)), AngleTolerance, true);
+		Check(TEXT("cosine"), Cos, ttmath::Cos(ToReference(SmallX)), AngleTolerance, true);
+	}
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,117 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Containers/UnrealString.h"
+#include "Core/Public/Misc/AutomationTest.h"
+#include "Core/Public/HAL/PlatformTime.h"
+
+#include "SpaceKitPrecision/Public/RealFloat.h"
+#include "SpaceKitPrecision/Public/VectorFixed.h"
+
+#include <type_traits>
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SpaceKitMemoryLayoutBenchmark
+{
+	// Mirrors the layout FRealFloat and FRealFixed used to have: a byte array, plus a reference to it that has to be rebound on every copy
+	template<typename T>
+	struct TLegacyReal
+	{
+		uint8 InternalValue[sizeof(T)];
+		T& Value = *reinterpret_cast<T*>(InternalValue);
+
+		TLegacyReal()
+		{
+			Value = T(0);
+		}
+
+		TLegacyReal(const TLegacyReal& Other)
+		{
+			Value = Other.Value;
+		}
+
+		TLegacyReal& operator=(const TLegacyReal& Other)
+		{
+			Value = Other.Value;
+			return *this;
+		}
+	};
+
+	template<typename T>
+	struct TLegacyVector
+	{
+		TLegacyReal<T> X;
+		TLegacyReal<T> Y;
+		TLegacyReal<T> Z;
+	};
+
+	static const int32 NumElements = 1 << 18;
+	static const int32 NumCopies = 16;
+
+	// Returns the time, in milliseconds, taken to copy an array of NumElements elements NumCopies times
+	template<typename ElementType>
+	double TimeArrayCopies()
+	{
+		TArray<ElementType> Source;
+		Source.SetNum(NumElements);
+
+		TArray<ElementType> Destination;
+		Destination.Reserve(NumElements);
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Copy = 0; Copy < NumCopies; Copy++)
+		{
+			Destination = Source;
+		}
+		return (FPlatformTime::Seconds() - Start) * 1000.0;
+	}
+
+	template<typename NewType, typename LegacyType>
+	void Report(FAutomationTestBase& Test, const TCHAR* Name)
+	{
+		const double NewTime = TimeArrayCopies<NewType>();
+		const double LegacyTime = TimeArrayCopies<LegacyType>();
+
+		Test.AddInfo(FString::Printf(TEXT("%s: %d bytes per element (was %d), %.1f MB per array (was %.1f MB)"),
+			Name, (int32)sizeof(NewType), (int32)sizeof(LegacyType),
+			NumElements * sizeof(NewType) / (1024.0 * 1024.0), NumElements * sizeof(LegacyType) / (1024.0 * 1024.0)));
+		Test.AddInfo(FString::Printf(TEXT("%s: %d array copies in %.2f ms (was %.2f ms), %.1fx faster"),
+			Name, NumCopies, NewTime, LegacyTime, LegacyTime / FMath::Max(NewTime, 1e-6)));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionMemoryLayoutBenchmark, "SpaceKitPrecision.Benchmarks.MemoryLayout", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionMemoryLayoutBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitMemoryLayoutBenchmark;
+
+	// Layout guarantees
+	TestEqual(TEXT("FRealFloat has no overhead"), (int32)sizeof(FRealFloat), (int32)sizeof(FRealFloat::ttBigType));
+	TestEqual(TEXT("FRealFixed has no overhead"), (int32)sizeof(FRealFixed), (int32)sizeof(real_fixed_type));
+	TestEqual(TEXT("FVectorFixed has no overhead"), (int32)sizeof(FVectorFixed), 3 * (int32)sizeof(real_fixed_type));
+	TestTrue(TEXT("FRealFloat is trivially copyable"), std::is_trivially_copyable<FRealFloat>::value);
+	TestTrue(TEXT("FRealFixed is trivially copyable"), std::is_trivially_copyable<FRealFixed>::value);
+	TestTrue(TEXT("FVectorFixed is trivially copyable"), std::is_trivially_copyable<FVectorFixed>::value);
+
+	// Copying an array must still copy the values
+	{
+		TArray<FVectorFixed> Source;
+		Source.Add(FVectorFixed(1_fx, 2_fx, 3_fx));
+		Source.Add(FVectorFixed(4_fx, 5_fx, 6_fx));
+		TArray<FVectorFixed> Destination = Source;
+		Source[0].X = 7_fx;
+		TestEqual(TEXT("Copied arrays keep their own values 1"), Destination[0], FVectorFixed(1_fx, 2_fx, 3_fx));
+		TestEqual(TEXT("Copied arrays keep their own values 2"), Destination[1], FVectorFixed(4_fx, 5_fx, 6_fx));
+	}
+
+	Report<FRealFloat, TLegacyReal<FRealFloat::ttBigType>>(*this, TEXT("FRealFloat"));
+	Report<FRealFixed, TLegacyReal<real_fixed_type>>(*this, TEXT("FRealFixed"));
+	Report<FVectorFixed, TLegacyVector<real_fixed_type>>(*this, TEXT("FVectorFixed"));
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,201 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Containers/UnrealString.h"
+#include "Core/Public/Misc/AutomationTest.h"
+
+#include "SpaceKitPrecision/Public/MultiDouble.h"
+#include "SpaceKitPrecision/Public/RealFloatTrigo.h"
+#include "SpaceKitPrecision/Private/Tests/PrecisionTestHelpers.h"
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SpaceKitMultiDoubleTest
+{
+	// Reference type, much more precise than a quad-double
+	using ReferenceType = ttmath::Big<1, 6>;
+
+	template<int N>
+	ReferenceType ToReference(const ddmath::MultiDouble<N>& Value)
+	{
+		return Value.template ToBig<ReferenceType>();
+	}
+
+	// Relative error of Value, or absolute error if bAbsolute is true
+	template<int N>
+	double Error(const ddmath::MultiDouble<N>& Value, const ReferenceType& Expected, bool bAbsolute)
+	{
+		const ReferenceType Difference = ttmath::Abs(ToReference(Value) - Expected);
+		return bAbsolute || Expected.IsZero() ? Difference.ToDouble() : (Difference / ttmath::Abs(Expected)).ToDouble();
+	}
+
+	// Checks the operations of MultiDouble<N> against ttmath, on values spread over a few orders of magnitude, and using all their components
+	template<int N>
+	void TestPrecision(FAutomationTestBase& Test, const TCHAR* Name)
+	{
+		using MultiDoubleType = ddmath::MultiDouble<N>;
+		const double Tolerance = 16 * ddmath::Epsilon<N>();
+
+		FRandomStream Random(42);
+		for (int32 Index = 0; Index < 256; Index++)
+		{
+			const MultiDoubleType x = SpaceKitPrecisionTest::RandomMultiPart<MultiDoubleType>(Random, N, -5, 5);
+			const MultiDoubleType y = SpaceKitPrecisionTest::RandomMultiPart<MultiDoubleType>(Random, N, -5, 5);
+			const ReferenceType ReferenceX = ToReference(x);
+			const ReferenceType ReferenceY = ToReference(y);
+			const MultiDoubleType AbsX = ddmath::Abs(x);
+			const ReferenceType ReferenceAbsX = ttmath::Abs(ReferenceX);
+
+			// Small values for the functions that overflow, and values in ]-1, 1[ for the inverse trigonometric ones
+			const MultiDoubleType SmallX = ddmath::DivDouble(x, FMath::Max(1.0, FMath::Abs(x.ToDouble()) / 10));
+			const MultiDoubleType UnitX = ddmath::DivDouble(x, 2 * FMath::Max(1.0, FMath::Abs(x.ToDouble())));
+
+			const auto Check = [&](const TCHAR* Operation, const MultiDoubleType& Value, const ReferenceType& Expected, double OperationTolerance, bool bAbsolute = false)
+			{
+				const double OperationError = Error(Value, Expected, bAbsolute);
+				if (!(OperationError <= OperationTolerance))
+				{
+					Test.AddError(FString::Printf(TEXT("%s %s: error %g with %s"), Name, Operation, OperationError, UTF8_TO_TCHAR(x.ToString().c_str())));
+				}
+			};
+
+			Check(TEXT("addition"), x + y, ReferenceX + ReferenceY, Tolerance);
+			Check(TEXT("substraction"), x - y, ReferenceX - ReferenceY, Tolerance);
+			Check(TEXT("multiplication"), x * y, ReferenceX * ReferenceY, Tolerance);
+			Check(TEXT("division"), x / y, ReferenceX / ReferenceY, Tolerance);
+			Check(TEXT("square root"), ddmath::Sqrt(AbsX), ttmath::Sqrt(ReferenceAbsX), Tolerance);
+			Check(TEXT("exponential"), ddmath::Exp(SmallX), ttmath::Exp(ToReference(SmallX)), Tolerance);
+			Check(TEXT("arc tangent"), ddmath::ATan(x), ttmath::ATan(ReferenceX), Tolerance);
+			Check(TEXT("arc sine"), ddmath::ASin(UnitX), ttmath::ASin(ToReference(UnitX)), Tolerance);
+
+			// The logarithm is close to zero around 1, so check its absolute error
+			Check(TEXT("logarithm"), ddmath::Ln(AbsX), ttmath::Ln(ReferenceAbsX), Tolerance * 16, true);
+
+			// The reduction modulo 2 pi loses as many digits as the angle has in front of the comma
+			const double AngleTolerance = Tolerance * FMath::Max(1.0, FMath::Abs(SmallX.ToDouble()));
+			Check(TEXT("sine"), ddmath::Sin(SmallX), ttmath::Sin(ToReference(SmallX)), AngleTolerance, true);
+			Check(TEXT("cosine"), ddmath::Cos(SmallX), ttmath::Cos(ToReference(SmallX)), AngleTolerance, true);
+		}
+
+		// Angles whose quotient by pi/2 doesn't fit in a double, in all the quadrants, and negative ones, whose quadrants are negative. They are reduced at twice the precision
+		for (const double Angle : { 1e16, -1e16, 1e17, 1e18, -1e18, 1e19, 1e20, -1e20, 1e21, 1e22, -1e22 })
+		{
+			const MultiDoubleType x(Angle);
+			MultiDoubleType Sin, Cos;
+			ddmath::SinCos(x, Sin, Cos);
+			if (!(Error(Sin, ttmath::Sin(ToReference(x)), true) <= Tolerance) || !(Error(Cos, ttmath::Cos(ToReference(x)), true) <= Tolerance))
+			{
+				Test.AddError(FString::Printf(TEXT("%s sine and cosine of %g: %g, %g"), Name, Angle, Sin.ToDouble(), Cos.ToDouble()));
+			}
+		}
+		Test.TestEqual(FString::Printf(TEXT("%s sine of 1e22"), Name), ddmath::Sin(MultiDoubleType(1e22)).ToDouble(), -0.8522008497671888, 1e-15);
+
+		ReferenceType ReferencePi;
+		ReferencePi.SetPi();
+
+		// Angles in degrees whose multiple of 90 has more bits than a double, in all the quadrants. They are reduced exactly
+		for (const double Turns : { 281474976710655.0, -562949953421309.0, 10000000000007.0 })
+		{
+			for (const double Offset : { 30.0, 120.0, -150.0, -60.0 })
+			{
+				const MultiDoubleType x = ddmath::MulDouble(MultiDoubleType(360.0), Turns) + MultiDoubleType(Offset);
+				MultiDoubleType Sin, Cos;
+				RealFloatTrigo::SinCosDeg(x, Sin, Cos);
+				const ReferenceType Radians = ReferenceType(Offset) * ReferencePi / 180;
+				if (!(Error(Sin, ttmath::Sin(Radians), true) <= Tolerance) || !(Error(Cos, ttmath::Cos(Radians), true) <= Tolerance))
+				{
+					Test.AddError(FString::Printf(TEXT("%s sine and cosine of %g turns and %g degrees: %g, %g"), Name, Turns, Offset, Sin.ToDouble(), Cos.ToDouble()));
+				}
+			}
+		}
+
+		// Arc tangents of points whose squared distance to the origin overflows or underflows
+		const double ArcTangentPoints[][2] = { { 1e155, 1.0 }, { 1e200, 1e200 }, { 1e-200, 1e-200 }, { -1e300, 1e-300 }, { 1e-300, -1e-250 } };
+		for (const auto& Point : ArcTangentPoints)
+		{
+			const MultiDoubleType y(Point[0]);
+			const MultiDoubleType x(Point[1]);
+			// Points left of the y axis are half a turn from the arc tangent of y / x. The only one here is above the x axis
+			const ReferenceType Expected = ttmath::ATan(ToReference(y) / ToReference(x)) + (Point[1] < 0 ? ReferencePi : ReferenceType(0));
+			if (!(Error(ddmath::ATan2(y, x), Expected, false) <= Tolerance))
+			{
+				Test.AddError(FString::Printf(TEXT("%s arc tangent of %g / %g: %g"), Name, Point[0], Point[1], ddmath::ATan2(y, x).ToDouble()));
+			}
+		}
+
+		// Components that are ties for the renormalization, each half an ulp of the one before it, added or substracted. The sums stay exact
+		for (const double Sign : { 1.0, -1.0 })
+		{
+			MultiDoubleType Boundary(1.0);
+			ReferenceType ReferenceBoundary = 1;
+			for (int32 Part = 1; Part < N; Part++)
+			{
+				const double Component = Sign * std::ldexp(1.0, -53 * Part);
+				Boundary = Boundary + MultiDoubleType(Component);
+				ReferenceBoundary = ReferenceBoundary + ReferenceType(Component);
+			}
+
+			const auto Check = [&](const TCHAR* Operation, const MultiDoubleType& Value, const ReferenceType& Expected, double OperationTolerance)
+			{
+				const double OperationError = Error(Value, Expected, false);
+				if (!(OperationError <= OperationTolerance))
+				{
+					Test.AddError(FString::Printf(TEXT("%s %s of 1 %s 2^-53...: error %g"), Name, Operation, Sign > 0 ? TEXT("+") : TEXT("-"), OperationError));
+				}
+			};
+
+			Check(TEXT("sum"), Boundary, ReferenceBoundary, 0);
+			Check(TEXT("difference with 1"), Boundary - MultiDoubleType(1.0), ReferenceBoundary - 1, 0);
+			Check(TEXT("square"), Boundary * Boundary, ReferenceBoundary * ReferenceBoundary, Tolerance);
+			Check(TEXT("inverse"), MultiDoubleType(1.0) / Boundary, ReferenceType(1) / ReferenceBoundary, Tolerance);
+			Check(TEXT("square root"), ddmath::Sqrt(Boundary), ttmath::Sqrt(ReferenceBoundary), Tolerance);
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathMultiDoublePrecisionTest, "SpaceKitPrecision.FloatingPointMath.MultiDoublePrecision", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathMultiDoublePrecisionTest::RunTest(const FString& Parameters)
+{
+	SpaceKitMultiDoubleTest::TestPrecision<2>(*this, TEXT("Double-double"));
+	SpaceKitMultiDoubleTest::TestPrecision<4>(*this, TEXT("Quad-double"));
+	return true;
+}
+
+#pragma optimize("", on)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathMultiDoubleConversionsTest, "SpaceKitPrecision.FloatingPointMath.MultiDoubleConversions", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathMultiDoubleConversionsTest::RunTest(const FString& Parameters)
+{
+	using ddmath::DoubleDouble;
+	using ddmath::QuadDouble;
+
+	// Strings are rounded to the digits the mantissa can hold
+	TestEqual(TEXT("Predefined string 1"), FString(DoubleDouble("2.4").ToString().c_str()), FString(TEXT("2.4")));
+	TestEqual(TEXT("Predefined string 2"), FString(DoubleDouble("-0.1").ToString().c_str()), FString(TEXT("-0.1")));
+	TestEqual(TEXT("Predefined string 3"), FString(DoubleDouble("1e-20").ToString().c_str()), FString(TEXT("1e-20")));
+	TestEqual(TEXT("Predefined string 4"), FString(QuadDouble("2.4").ToString().c_str()), FString(TEXT("2.4")));
+	TestEqual(TEXT("Predefined string 5"), FString(ddmath::PiConstant<4>().ToString().c_str()), FString(TEXT("3.1415926535897932384626433832795028841971693993751058209749446")));
+	TestTrue(TEXT("Predefined string round trip"), DoubleDouble(DoubleDouble("2.4").ToString()) == DoubleDouble("2.4"));
+
+	// 64 bits integers are exact
+	TestEqual(TEXT("Predefined integer 1"), FString(DoubleDouble(int64(MIN_int64)).ToString().c_str()), FString(TEXT("-9.223372036854775808e+18")));
+	TestEqual(TEXT("Predefined integer 2"), FString(DoubleDouble(uint64(MAX_uint64)).ToString().c_str()), FString(TEXT("1.8446744073709551615e+19")));
+
+	// The components can be far apart
+	const DoubleDouble OnePlusTiny = DoubleDouble(1.0) + DoubleDouble(1e-30);
+	TestTrue(TEXT("Predefined tiny addition"), OnePlusTiny > DoubleDouble(1.0));
+	TestEqual(TEXT("Predefined tiny substraction"), (OnePlusTiny - DoubleDouble(1.0)).ToDouble(), 1e-30);
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,114 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Containers/UnrealString.h"
+#include "Core/Public/Misc/AutomationTest.h"
+
+#include "SpaceKitPrecision/Public/RealFloat.h"
+#include "SpaceKitPrecision/Public/VectorFixed.h"
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathFixedPrecisionConversionsTest, "SpaceKitPrecision.FixedPointMath.PrecisionConversions", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathFixedPrecisionConversionsTest::RunTest(const FString& Parameters)
+{
+	using NarrowType = TRealFixed<52, 12>;
+	using WideType = TRealFixed<REAL_FIXED_MANTISSA_SIZE, REAL_FIXED_EXPONENT>;
+
+	// Widening is exact
+	TestEqual(TEXT("Predefined widening 1"), WideType(NarrowType("1234.5")), WideType("1234.5"));
+	TestEqual(TEXT("Predefined widening 2"), WideType(NarrowType("-1234.5")), WideType("-1234.5"));
+	TestEqual(TEXT("Predefined widening 3"), WideType(NarrowType::GetMinValue()), WideType(1) / WideType(4096));
+
+	// Narrowing rounds to nearest
+	TestEqual(TEXT("Predefined narrowing 1"), NarrowType(WideType("1234.5")), NarrowType("1234.5"));
+	TestEqual(TEXT("Predefined narrowing 2"), NarrowType(WideType(1) / WideType(3)), NarrowType(1) / NarrowType(3));
+	TestEqual(TEXT("Predefined narrowing 3"), NarrowType(WideType(-1) / WideType(3)), NarrowType(-1) / NarrowType(3));
+	TestEqual(TEXT("Predefined narrowing 4"), NarrowType(WideType(2) / WideType(3)), NarrowType(2) / NarrowType(3));
+	TestEqual(TEXT("Predefined narrowing 5"), NarrowType(WideType(1) / WideType(16384)), NarrowType(0));
+	TestEqual(TEXT("Predefined narrowing 6"), NarrowType(WideType(1) / WideType(8192)), NarrowType::GetMinValue());
+
+	// Through the Blueprint-facing types
+	TestEqual(TEXT("Predefined FRealFixed from template"), FRealFixed(NarrowType("-1234.5")), FRealFixed("-1234.5"));
+	TestEqual(TEXT("Predefined FRealFixed to template"), NarrowType(FRealFixed("-1234.5")), NarrowType("-1234.5"));
+
+	// Arithmetic works at any precision
+	TestEqual(TEXT("Predefined narrow arithmetic"), (NarrowType(6) * NarrowType(2) - NarrowType(4)) / NarrowType(-2), NarrowType(-4));
+	TestEqual(TEXT("Predefined narrow storage"), (int32)sizeof(NarrowType), 8);
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathFloatPrecisionConversionsTest, "SpaceKitPrecision.FloatingPointMath.PrecisionConversions", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathFloatPrecisionConversionsTest::RunTest(const FString& Parameters)
+{
+	using NarrowType = TRealFloat<64>;
+	using WideType = TRealFloat<192>;
+
+	// Widening is exact, narrowing rounds to nearest. The bits of 1/3 past the mantissa are above half a unit in its last place, so it rounds up where truncating wouldn't.
+	// The expected thirds are parsed, which rounds to nearest, with digits far beyond the precision of the mantissa
+	const WideType WideThird = WideType(1) / WideType(3);
+	const NarrowType NarrowThird("0.33333333333333333333333333333333333333333333333333");
+	TestEqual(TEXT("Predefined widening"), NarrowType(WideType(NarrowThird)), NarrowThird);
+	TestEqual(TEXT("Predefined narrowing"), NarrowType(WideThird), NarrowThird);
+	TestTrue(TEXT("Predefined narrowing loses precision"), WideType(NarrowThird) != WideThird);
+	TestTrue(TEXT("Predefined narrowing rounds up"), WideType(NarrowThird) > WideThird);
+
+	// Through the Blueprint-facing type
+	TestEqual(TEXT("Predefined FRealFloat from template"), FRealFloat(TRealFloat<TT_REAL_FLOAT_SIZE>("2.5")), 2.5_fl);
+	TestEqual(TEXT("Predefined FRealFloat to template"), NarrowType(FRealFloat(2.5)), NarrowType(2.5));
+#if !USE_BOOST_BIG && !USE_MULTI_DOUBLE_BIG && !USE_FLOAT128_STORAGE
+	TestEqual(TEXT("Predefined FRealFloat from template rounds"), FRealFloat(WideThird), FRealFloat("0.33333333333333333333333333333333333333333333333333"));
+	TestEqual(TEXT("Predefined FRealFloat to template rounds"), NarrowType(FRealFloat(WideThird)), NarrowThird);
+#endif
+
+	// Arithmetic and math functions work at any precision
+	TestEqual(TEXT("Predefined narrow arithmetic"), (NarrowType(6) * NarrowType(2) - NarrowType(4)) / NarrowType(-2), NarrowType(-4));
+	TestEqual(TEXT("Predefined narrow sqrt"), Sqrt(NarrowType(16)), NarrowType(4));
+	TestEqual(TEXT("Predefined narrow sin"), Sin(NarrowType(0)), NarrowType(0));
+	TestTrue(TEXT("Predefined narrow storage"), sizeof(NarrowType) < sizeof(WideType));
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathVectorFixedPrecisionConversionsTest, "SpaceKitPrecision.VectorFixedMath.PrecisionConversions", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathVectorFixedPrecisionConversionsTest::RunTest(const FString& Parameters)
+{
+	using NarrowType = TVectorFixed<52, 12>;
+	using NarrowRealType = NarrowType::RealType;
+
+	const NarrowType x(FVector(6.f, 12.f, 20.f));
+	const NarrowType y(NarrowRealType(2), NarrowRealType(3), NarrowRealType(4));
+
+	// Vector math works at any precision
+	TestEqual(TEXT("Predefined addition"), x + y, NarrowType(NarrowRealType(8), NarrowRealType(15), NarrowRealType(24)));
+	TestEqual(TEXT("Predefined division"), x / y, NarrowType(NarrowRealType(3), NarrowRealType(4), NarrowRealType(5)));
+	TestEqual(TEXT("Predefined dot product"), x | y, NarrowRealType(128));
+	TestEqual(TEXT("Predefined cross product"), x ^ y, NarrowType(NarrowRealType(-12), NarrowRealType(16), NarrowRealType(-6)));
+	TestEqual(TEXT("Predefined size"), NarrowType(NarrowRealType(3), NarrowRealType(4), NarrowRealType(0)).Size(), NarrowRealType(5));
+
+	// Conversions with the Blueprint-facing type
+	TestEqual(TEXT("Predefined FVectorFixed from template"), FVectorFixed(x), FVectorFixed(6_fx, 12_fx, 20_fx));
+	TestEqual(TEXT("Predefined FVectorFixed to template"), NarrowType(FVectorFixed(6_fx, 12_fx, 20_fx)), x);
+	TestEqual(TEXT("Predefined narrow storage"), (int32)sizeof(NarrowType), 3 * 8);
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,33 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Math/RandomStream.h"
+
+#include <cmath>
+
+
+namespace SpaceKitPrecisionTest
+{
+	// Random double between -10^Exponent and 10^Exponent, with Exponent uniform between MinExponent and MaxExponent
+	inline double RandomDouble(FRandomStream& Random, double MinExponent, double MaxExponent)
+	{
+		const double Fraction = Random.GetFraction() * 2 - 1;
+		return Fraction * std::pow(10.0, MinExponent + (MaxExponent - MinExponent) * Random.GetFraction());
+	}
+
+	// Random number made of NumParts doubles, each a random fraction of 1e-17 of the one before it, so the digits past a double's are all used
+	template<typename NumberType>
+	NumberType RandomMultiPart(FRandomStream& Random, int32 NumParts, double MinExponent, double MaxExponent)
+	{
+		double Part = RandomDouble(Random, MinExponent, MaxExponent);
+		NumberType Result(Part);
+		for (int32 Index = 1; Index < NumParts; Index++)
+		{
+			Part *= Random.GetFraction() * 1e-17;
+			Result = Result + NumberType(Part);
+		}
+		return Result;
+	}
+}
@@ -21,6 +21,9 @@ bool FCoreMathQuatFloatOperatorsTest::RunTest(const FString& Parameters)
 	const FQuatFloat Quat(FVectorFloat(0_fl, 0_fl, 1_fl), 90_fl);
 
 	TestEqual(TEXT("Predefined rotation 1"), Quat.RotateVector(Vec1).ToFVector(), FVector(-0.2f, 1.f, 5.f));
+	TestEqual(TEXT("Predefined unrotation 1"), Quat.UnrotateVector(Vec1).ToFVector(), FVector(0.2f, -1.f, 5.f));
+	TestEqual(TEXT("Predefined product 1"), (Quat * Quat).RotateVector(Vec1).ToFVector(), FVector(-1.f, -0.2f, 5.f));
+	TestEqual(TEXT("Predefined product 2"), (Quat * Quat.Inverse()).RotateVector(Vec1).ToFVector(), Vec1.ToFVector());
 
 	return true;
 }
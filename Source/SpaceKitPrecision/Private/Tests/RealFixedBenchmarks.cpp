@@ -0,0 +1,387 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Containers/UnrealString.h"
+#include "Core/Public/Misc/AutomationTest.h"
+#include "Core/Public/HAL/PlatformTime.h"
+
+#include "SpaceKitPrecision/Public/RealFixed.h"
+#include "SpaceKitPrecision/Public/RealFixedTrigo.h"
+#include "SpaceKitPrecision/Public/VectorFixed.h"
+#include "SpaceKitPrecision/Public/FixedVectorSoA.h"
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SpaceKitRealFixedBenchmark
+{
+	using ttIntType = real_fixed_type::ttIntType;
+
+	static const int32 NumValues = 1 << 10;
+	static const int32 NumPasses = 256;
+
+	// The multiplication and division real_fixed used to have: at the mantissa width, then a full division by 2^Exponent
+	ttIntType LegacyMultiply(const ttIntType& x, const ttIntType& y)
+	{
+		return (x * y) / ttIntType(real_fixed_type::GetExponentiatedTtInt());
+	}
+
+	ttIntType LegacyDivide(const ttIntType& x, const ttIntType& y)
+	{
+		return (x * ttIntType(real_fixed_type::GetExponentiatedTtInt())) / y;
+	}
+
+	// The conversion from double real_fixed used to have: through a ttmath float, then truncated
+	real_fixed_type LegacyFromDouble(double x)
+	{
+		ttIntType mantissa;
+		(real_fixed_type::ttBigType(x) * real_fixed_type::exponentiatedDouble).ToInt(mantissa);
+		return real_fixed_type::FromMantissa(mantissa);
+	}
+
+	// The base 10 conversions real_fixed used to have: through ttmath floats and strings, and FString concatenations
+	FString LegacyToString(const real_fixed_type& x)
+	{
+		const ttIntType exponentiatedTtInt = real_fixed_type::GetExponentiatedTtInt();
+		const real_fixed_type::ttBigType RightPart = real_fixed_type::ttBigType(ttIntType(ttmath::Abs(ttIntType(x.mantissa)) % exponentiatedTtInt)) / real_fixed_type::GetExponentiatedTtBig();
+		const ttIntType LeftPart = ttIntType(x.mantissa) / exponentiatedTtInt;
+
+		ttmath::Conv c;
+		c.round = FMath::FloorToInt((float)REAL_FIXED_EXPONENT * FMath::Loge(2.0) / FMath::Loge(10.0));
+		FString RightPartString = FString(RightPart.ToString(c).c_str());
+		RightPartString.RemoveFromStart("0.");
+		return ttbigToString(LeftPart) + "." + RightPartString;
+	}
+
+	real_fixed_type LegacyFromString(const FString& x)
+	{
+		ttIntType mantissa;
+		(real_fixed_type::ttBigType(TCHAR_TO_ANSI(*x)) * real_fixed_type::GetExponentiatedTtBig()).ToInt(mantissa);
+		return real_fixed_type::FromMantissa(mantissa);
+	}
+
+	// The text import FRealFixed used to have: it copied the whole rest of the buffer to find the closing parenthesis
+	bool LegacyImportTextItem(FRealFixed& Value, const TCHAR*& Buffer)
+	{
+		FString MutableString = Buffer;
+		const int32 Len = MutableString.Find(")") + 1;
+		Buffer += Len;
+
+		MutableString = MutableString.Left(Len);
+		MutableString.RemoveFromStart("(");
+		MutableString.RemoveFromEnd(")");
+
+		Value.GetValue() = LegacyFromString(MutableString);
+		return true;
+	}
+
+	// Returns the time, in nanoseconds, taken by one operation on average.
+	// Operation is applied on all pairs of consecutive values, and accumulated, so the compiler can't skip it
+	template<typename ValueType, typename OperationType, typename AccumulatorType>
+	double TimeOperation(const TArray<ValueType>& Values, OperationType Operation, AccumulatorType& Accumulator)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumPasses; Pass++)
+		{
+			for (int32 Index = 1; Index < Values.Num(); Index++)
+			{
+				Accumulator += Operation(Values[Index - 1], Values[Index]);
+			}
+		}
+		return (FPlatformTime::Seconds() - Start) * 1e9 / (double(NumPasses) * (Values.Num() - 1));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionRealFixedOperatorsBenchmark, "SpaceKitPrecision.Benchmarks.RealFixedOperators", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionRealFixedOperatorsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFixedBenchmark;
+
+	// Values between 1e-3 and 1e6, so none of the legacy operations overflow
+	TArray<real_fixed_type> Values;
+	TArray<ttIntType> LegacyValues;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		const real_fixed_type Value = real_fixed_type((double)FMath::Pow(10.f, FMath::FRandRange(-3.f, 6.f)) * (Index % 2 ? -1.0 : 1.0));
+		Values.Add(Value);
+		LegacyValues.Add(ttIntType(Value.mantissa));
+	}
+
+	real_fixed_type Accumulator = real_fixed_type(0);
+	ttIntType LegacyAccumulator = ttIntType(0);
+
+	const double MultiplyTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return x * y; }, Accumulator);
+	const double LegacyMultiplyTime = TimeOperation(LegacyValues, LegacyMultiply, LegacyAccumulator);
+	const double DivideTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return x / y; }, Accumulator);
+	const double LegacyDivideTime = TimeOperation(LegacyValues, LegacyDivide, LegacyAccumulator);
+
+	// Dividing by the same number, like by a body's mass
+	const real_fixed_type Divisor = Values[0];
+	const FRealFixedReciprocal::ReciprocalType Reciprocal(Divisor);
+	const double SameDivisorTime = TimeOperation(Values, [&Divisor](const real_fixed_type& x, const real_fixed_type& y) { return x / Divisor; }, Accumulator);
+	const double ReciprocalTime = TimeOperation(Values, [&Reciprocal](const real_fixed_type& x, const real_fixed_type& y) { return x / Reciprocal; }, Accumulator);
+
+	AddInfo(FString::Printf(TEXT("ttmath limb kernels: %s"), SPACEKIT_TTMATH_KERNELS));
+	AddInfo(FString::Printf(TEXT("Multiplication: %.1f ns (was %.1f ns), %.1fx faster"), MultiplyTime, LegacyMultiplyTime, LegacyMultiplyTime / FMath::Max(MultiplyTime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("Division: %.1f ns (was %.1f ns), %.1fx faster"), DivideTime, LegacyDivideTime, LegacyDivideTime / FMath::Max(DivideTime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("Division by the same number: %.1f ns, by its reciprocal: %.1f ns"), SameDivisorTime, ReciprocalTime));
+
+	// Both paths must agree, up to the rounding of the last bit
+	for (int32 Index = 1; Index < NumValues; Index++)
+	{
+		const real_fixed_type Product = Values[Index - 1] * Values[Index];
+		const real_fixed_type LegacyProduct = real_fixed_type::FromMantissa(LegacyMultiply(LegacyValues[Index - 1], LegacyValues[Index]));
+		if (Abs(Product.mantissa - LegacyProduct.mantissa) > real_fixed_type::ttIntMantissaType(1))
+		{
+			AddError(FString::Printf(TEXT("Multiplication %d differs: %s, was %s"), Index, *Product.ToString(), *LegacyProduct.ToString()));
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Checksums: %s, %s"), *Accumulator.ToString(), *ttbigToString(LegacyAccumulator)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionRealFixedAdvancedMathBenchmark, "SpaceKitPrecision.Benchmarks.RealFixedAdvancedMath", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionRealFixedAdvancedMathBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFixedBenchmark;
+	using ttBigType = real_fixed_type::ttBigType;
+
+	// Positive values between 1e-3 and 1e15
+	TArray<real_fixed_type> Values;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		Values.Add(real_fixed_type((double)FMath::Pow(10.f, FMath::FRandRange(-3.f, 15.f))));
+	}
+
+	real_fixed_type Accumulator = real_fixed_type(0);
+
+	// The legacy versions went through a ttmath float, and back
+	const double SqrtTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return Sqrt(x); }, Accumulator);
+	const double LegacySqrtTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return real_fixed_type(ttmath::Sqrt(x.ToBig())); }, Accumulator);
+	const double HypotTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return Hypot(x, y, x); }, Accumulator);
+	const double LnTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return Ln(x); }, Accumulator);
+	const double LegacyLnTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return real_fixed_type(ttmath::Ln(x.ToBig())); }, Accumulator);
+	const double Log2Time = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return Log2(x); }, Accumulator);
+	const double LegacyLog2Time = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return real_fixed_type(ttmath::Log(x.ToBig(), ttBigType(2))); }, Accumulator);
+
+	AddInfo(FString::Printf(TEXT("Sqrt: %.1f ns (was %.1f ns), %.1fx faster. Vector size: %.1f ns"), SqrtTime, LegacySqrtTime, LegacySqrtTime / FMath::Max(SqrtTime, 1e-6), HypotTime));
+	AddInfo(FString::Printf(TEXT("Ln: %.1f ns (was %.1f ns), %.1fx faster"), LnTime, LegacyLnTime, LegacyLnTime / FMath::Max(LnTime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("Log2: %.1f ns (was %.1f ns), %.1fx faster"), Log2Time, LegacyLog2Time, LegacyLog2Time / FMath::Max(Log2Time, 1e-6)));
+	AddInfo(FString::Printf(TEXT("Checksum: %s"), *Accumulator.ToString()));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionRealFixedConversionsBenchmark, "SpaceKitPrecision.Benchmarks.RealFixedConversions", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionRealFixedConversionsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFixedBenchmark;
+
+	// Coordinates between -1e12 and 1e12, like positions in a solar system
+	TArray<double> Doubles;
+	TArray<real_fixed_type> Values;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		Doubles.Add((double)FMath::FRandRange(-1.f, 1.f) * 1e12);
+		Values.Add(real_fixed_type(Doubles[Index]));
+	}
+
+	// The legacy conversions went through a ttmath float
+	real_fixed_type Accumulator = real_fixed_type(0);
+	double DoubleAccumulator = 0.0;
+	float FloatAccumulator = 0.f;
+	const double FromDoubleTime = TimeOperation(Doubles, [](const double& x, const double& y) { return real_fixed_type(x); }, Accumulator);
+	const double LegacyFromDoubleTime = TimeOperation(Doubles, [](const double& x, const double& y) { return LegacyFromDouble(x); }, Accumulator);
+	const double ToDoubleTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return x.ToDouble(); }, DoubleAccumulator);
+	const double LegacyToDoubleTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return x.ToBig().ToDouble(); }, DoubleAccumulator);
+	const double ToFloatTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return x.ToFloat(); }, FloatAccumulator);
+	const double LegacyToFloatTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return x.ToBig().ToFloat(); }, FloatAccumulator);
+
+	TArray<FVectorFixed> Vectors;
+	for (int32 Index = 2; Index < NumValues; Index++)
+	{
+		Vectors.Add(FVectorFixed(FRealFixed(Values[Index - 2]), FRealFixed(Values[Index - 1]), FRealFixed(Values[Index])));
+	}
+	TArray<FVector> Converted;
+	const double Start = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < NumPasses; Pass++)
+	{
+		FVectorFixed::ToFVectors(Vectors, Converted);
+	}
+	const double BatchTime = (FPlatformTime::Seconds() - Start) * 1e9 / (double(NumPasses) * Vectors.Num());
+
+	AddInfo(FString::Printf(TEXT("From double: %.1f ns (was %.1f ns), %.1fx faster"), FromDoubleTime, LegacyFromDoubleTime, LegacyFromDoubleTime / FMath::Max(FromDoubleTime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("To double: %.1f ns (was %.1f ns), %.1fx faster"), ToDoubleTime, LegacyToDoubleTime, LegacyToDoubleTime / FMath::Max(ToDoubleTime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("To float: %.1f ns (was %.1f ns), %.1fx faster"), ToFloatTime, LegacyToFloatTime, LegacyToFloatTime / FMath::Max(ToFloatTime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("FVectorFixed to FVector, in batch: %.1f ns per vector"), BatchTime));
+	AddInfo(FString::Printf(TEXT("Checksums: %s, %f, %f, %f"), *Accumulator.ToString(), DoubleAccumulator, FloatAccumulator, Converted[0].X));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionRealFixedTrigoBenchmark, "SpaceKitPrecision.Benchmarks.RealFixedTrigo", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionRealFixedTrigoBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFixedBenchmark;
+
+	// Angles between -4 and 4 radians, to hit every quadrant, and coordinates between -1e6 and 1e6
+	TArray<real_fixed_type> Angles;
+	TArray<real_fixed_type> Coordinates;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		Angles.Add(real_fixed_type((double)FMath::FRandRange(-4.f, 4.f)));
+		Coordinates.Add(real_fixed_type((double)FMath::FRandRange(-1e6f, 1e6f)));
+	}
+
+	real_fixed_type Accumulator = real_fixed_type(0);
+
+	// The float detour converts to a ttmath float, and back
+	const double SinCosTime = TimeOperation(Angles, [](const real_fixed_type& x, const real_fixed_type& y)
+	{
+		real_fixed_type Sin, Cos;
+		SinCos(x, Sin, Cos);
+		return Sin + Cos;
+	}, Accumulator);
+	const double FloatSinCosTime = TimeOperation(Angles, [](const real_fixed_type& x, const real_fixed_type& y)
+	{
+		const real_fixed_type::ttBigType Big = x.ToBig();
+		return real_fixed_type(ttmath::Sin(Big)) + real_fixed_type(ttmath::Cos(Big));
+	}, Accumulator);
+	const double ATan2Time = TimeOperation(Coordinates, [](const real_fixed_type& x, const real_fixed_type& y) { return ATan2(y, x); }, Accumulator);
+	const double FloatATan2Time = TimeOperation(Coordinates, [](const real_fixed_type& x, const real_fixed_type& y)
+	{
+		// ttmath has no atan2, and a quadrant fix up is negligible next to the arc tangent
+		return real_fixed_type(ttmath::ATan(y.ToBig() / x.ToBig()));
+	}, Accumulator);
+
+	AddInfo(FString::Printf(TEXT("Sine and cosine: %.1f ns (float detour %.1f ns), %.1fx faster"), SinCosTime, FloatSinCosTime, FloatSinCosTime / FMath::Max(SinCosTime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("Atan2: %.1f ns (float detour %.1f ns), %.1fx faster"), ATan2Time, FloatATan2Time, FloatATan2Time / FMath::Max(ATan2Time, 1e-6)));
+	AddInfo(FString::Printf(TEXT("Checksum: %s"), *Accumulator.ToString()));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionRealFixedStringsBenchmark, "SpaceKitPrecision.Benchmarks.RealFixedStrings", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionRealFixedStringsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFixedBenchmark;
+
+	// Coordinates between -1e12 and 1e12, with all their fraction bits set, like positions saved in a level
+	TArray<real_fixed_type> Values;
+	TArray<FString> Strings;
+	FString Text;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		Values.Add(real_fixed_type((double)FMath::FRandRange(-1.f, 1.f) * 1e12) + real_fixed_type((double)FMath::FRandRange(0.f, 1.f)));
+		Strings.Add(Values[Index].ToString());
+		FRealFixed(Values[Index]).ExportTextItem(Text, FRealFixed(), nullptr, 0, nullptr);
+	}
+
+	int32 Length = 0;
+	real_fixed_type Accumulator = real_fixed_type(0);
+	const double ToCharsTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y)
+	{
+		TCHAR Buffer[real_fixed_type::StringBufferSize];
+		return x.ToChars(Buffer);
+	}, Length);
+	const double ToStringTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return x.ToString().Len(); }, Length);
+	const double LegacyToStringTime = TimeOperation(Values, [](const real_fixed_type& x, const real_fixed_type& y) { return LegacyToString(x).Len(); }, Length);
+	const double ParseTime = TimeOperation(Strings, [](const FString& x, const FString& y)
+	{
+		const TCHAR* Cursor = *x;
+		real_fixed_type Value = real_fixed_type(0);
+		Value.InitFromChars(Cursor);
+		return Value;
+	}, Accumulator);
+	const double LegacyParseTime = TimeOperation(Strings, [](const FString& x, const FString& y) { return LegacyFromString(x); }, Accumulator);
+
+	// Imports every value of one text, one after the other, like a level or a config file is read
+	const double ImportStart = FPlatformTime::Seconds();
+	const TCHAR* Cursor = *Text;
+	FRealFixed Imported;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		Imported.ImportTextItem(Cursor, 0, nullptr, nullptr);
+		Accumulator += Imported.GetValue();
+	}
+	const double ImportTime = (FPlatformTime::Seconds() - ImportStart) * 1e9 / NumValues;
+
+	const double LegacyImportStart = FPlatformTime::Seconds();
+	Cursor = *Text;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		LegacyImportTextItem(Imported, Cursor);
+		Accumulator += Imported.GetValue();
+	}
+	const double LegacyImportTime = (FPlatformTime::Seconds() - LegacyImportStart) * 1e9 / NumValues;
+
+	AddInfo(FString::Printf(TEXT("To characters: %.1f ns, to FString: %.1f ns (was %.1f ns), %.1fx faster"), ToCharsTime, ToStringTime, LegacyToStringTime, LegacyToStringTime / FMath::Max(ToStringTime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("From characters: %.1f ns (was %.1f ns), %.1fx faster"), ParseTime, LegacyParseTime, LegacyParseTime / FMath::Max(ParseTime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("Text import of %d values: %.1f ns per value (was %.1f ns), %.1fx faster"), NumValues, ImportTime, LegacyImportTime, LegacyImportTime / FMath::Max(ImportTime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("Checksums: %d, %s"), Length, *Accumulator.ToString()));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionFixedVectorSoABenchmark, "SpaceKitPrecision.Benchmarks.FixedVectorSoA", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionFixedVectorSoABenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFixedBenchmark;
+
+	// A fleet: positions up to an astronomical unit, in centimeters, and velocities up to 1e6 cm/s
+	const int32 NumVectors = 1 << 16;
+	const int32 NumSteps = 16;
+	TArray<FVectorFixed> Positions, Velocities;
+	for (int32 Index = 0; Index < NumVectors; Index++)
+	{
+		Positions.Add(FVectorFixed(FRealFixed(FMath::FRandRange(-1.5e13f, 1.5e13f)), FRealFixed(FMath::FRandRange(-1.5e13f, 1.5e13f)), FRealFixed(FMath::FRandRange(-1.5e13f, 1.5e13f))));
+		Velocities.Add(FVectorFixed(FVector(FMath::FRandRange(-1e6f, 1e6f), FMath::FRandRange(-1e6f, 1e6f), FMath::FRandRange(-1e6f, 1e6f))));
+	}
+	const FRealFixed DeltaTime = 1_fx / 60_fx;
+
+	FFixedVectorSoA PositionsSoA, VelocitiesSoA;
+	PositionsSoA.Gather(Positions);
+	VelocitiesSoA.Gather(Velocities);
+
+	// Returns the time, in nanoseconds, taken to update one vector on average
+	const auto Time = [&](auto Step)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumSteps; Pass++)
+		{
+			Step();
+		}
+		return (FPlatformTime::Seconds() - Start) * 1e9 / (double(NumSteps) * NumVectors);
+	};
+
+	const double IntegrateTime = Time([&]() { for (int32 Index = 0; Index < NumVectors; Index++) { Positions[Index] += Velocities[Index] * DeltaTime; } });
+	const double IntegrateSoATime = Time([&]() { PositionsSoA.AddScaled(VelocitiesSoA, DeltaTime.GetValue()); });
+	const double AddTime = Time([&]() { for (int32 Index = 0; Index < NumVectors; Index++) { Positions[Index] += Velocities[Index]; } });
+	const double AddSoATime = Time([&]() { PositionsSoA.Add(VelocitiesSoA); });
+	const double MinTime = Time([&]() { for (int32 Index = 0; Index < NumVectors; Index++) { Positions[Index] = FVectorFixed(FMath::Min(Positions[Index].X, Velocities[Index].X), FMath::Min(Positions[Index].Y, Velocities[Index].Y), FMath::Min(Positions[Index].Z, Velocities[Index].Z)); } });
+	const double MinSoATime = Time([&]() { PositionsSoA.Min(VelocitiesSoA); });
+
+	const double GatherStart = FPlatformTime::Seconds();
+	PositionsSoA.Scatter(Velocities);
+	PositionsSoA.Gather(Velocities);
+	const double GatherScatterTime = (FPlatformTime::Seconds() - GatherStart) * 1e9 / NumVectors;
+
+	AddInfo(FString::Printf(TEXT("SIMD kernels: %s"), FIXED_VECTOR_SOA_AVX2 ? TEXT("AVX2") : TEXT("none")));
+	AddInfo(FString::Printf(TEXT("Position += Velocity * DeltaTime: %.1f ns per vector (array of FVectorFixed: %.1f ns), %.1fx faster"), IntegrateSoATime, IntegrateTime, IntegrateTime / FMath::Max(IntegrateSoATime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("Position += Velocity: %.1f ns per vector (array of FVectorFixed: %.1f ns), %.1fx faster"), AddSoATime, AddTime, AddTime / FMath::Max(AddSoATime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("Min: %.1f ns per vector (array of FVectorFixed: %.1f ns), %.1fx faster"), MinSoATime, MinTime, MinTime / FMath::Max(MinSoATime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("Scatter and gather: %.1f ns per vector"), GatherScatterTime));
+	AddInfo(FString::Printf(TEXT("Checksums: %s, %s"), *Positions[0].ToString(), *FVectorFixed(PositionsSoA.Get(0)).ToString()));
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -106,6 +106,22 @@ bool FCoreMathFixedOperatorsTest::RunTest(const FString& Parameters)
 		TestEqual(TEXT("Predefined div assign operator works 2"), a, -0.25_fx);
 	}
 
+	// Chained and aliased assigns
+	{
+		FRealFixed a = 2_fx;
+		(a += 1_fx) *= 4_fx;
+		TestEqual(TEXT("Predefined chained assign operators work"), a, 12_fx);
+		a += a;
+		TestEqual(TEXT("Predefined aliased add assign operator works"), a, 24_fx);
+		a -= a;
+		TestEqual(TEXT("Predefined aliased sub assign operator works"), a, 0_fx);
+		a = 3_fx;
+		a *= a;
+		TestEqual(TEXT("Predefined aliased mult assign operator works"), a, 9_fx);
+		a /= a;
+		TestEqual(TEXT("Predefined aliased div assign operator works"), a, 1_fx);
+	}
+
 	// Mod assign
 	{
 		FRealFixed a = 8_fx;
@@ -115,6 +131,24 @@ bool FCoreMathFixedOperatorsTest::RunTest(const FString& Parameters)
 		TestEqual(TEXT("Predefined mod assign operator works 2"), a.ToFloat(), 0.2_fx.ToFloat());
 	}
 
+	// Multiplication and division are computed with double-width intermediates, so they don't overflow before the result does
+	{
+		TestEqual(TEXT("Predefined big multiplication 1"), 1e12_fx * 1e12_fx, 1e24_fx);
+		TestEqual(TEXT("Predefined big multiplication 2"), -1e15_fx * 1e14_fx, -1e29_fx);
+		TestEqual(TEXT("Predefined big division 1"), 1e24_fx / 1e12_fx, 1e12_fx);
+		TestEqual(TEXT("Predefined big division 2"), 1e29_fx / -0.5_fx, -2e29_fx);
+	}
+
+	// And they round to the nearest value
+	{
+		const FRealFixed Epsilon(real_fixed_type::GetMinValue());
+		TestEqual(TEXT("Predefined multiplication rounding 1"), Epsilon * 0.5_fx, Epsilon);
+		TestEqual(TEXT("Predefined multiplication rounding 2"), Epsilon * -0.5_fx, -Epsilon);
+		TestEqual(TEXT("Predefined multiplication rounding 3"), Epsilon * 0.25_fx, 0_fx);
+		TestEqual(TEXT("Predefined division rounding 1"), 2_fx / 3_fx - 1_fx / 3_fx, 1_fx / 3_fx + Epsilon);
+		TestEqual(TEXT("Predefined division rounding 2"), -2_fx / 3_fx, -(2_fx / 3_fx));
+	}
+
 	return true;
 }
 
@@ -171,4 +205,291 @@ bool FCoreMathFixedLimitsTest::RunTest(const FString& Parameters)
 #pragma optimize("", on)
 
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathFixedConversionsTest, "SpaceKitPrecision.FixedPointMath.Conversions", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathFixedConversionsTest::RunTest(const FString& Parameters)
+{
+	const FRealFixed Epsilon(real_fixed_type::GetMinValue());
+
+	// Integers, and doubles that fit in the mantissa, are exact both ways
+	TestEqual(TEXT("Predefined from int 1"), FRealFixed(int32(-7)), -7_fx);
+	TestEqual(TEXT("Predefined from int 2"), FRealFixed(int64(946073047258004200)), 946073047258004200_fx);
+	TestEqual(TEXT("Predefined from double 1"), FRealFixed(0.375), 0.375_fx);
+	TestEqual(TEXT("Predefined from double 2"), FRealFixed(-1e15), -1e15_fx);
+	TestEqual(TEXT("Predefined from double 3"), FRealFixed(-0.0), 0_fx);
+	TestEqual(TEXT("Predefined to double 1"), (-0.375_fx).ToDouble(), -0.375);
+	TestEqual(TEXT("Predefined to double 2"), (946073047258004200_fx).ToDouble(), 946073047258004200.0);
+	TestEqual(TEXT("Predefined to double 3"), Epsilon.ToDouble(), 1.0 / real_fixed_type::exponentiatedDouble);
+
+	// Doubles below the precision are rounded to nearest, with the halves rounded away from zero
+	const double Lsb = Epsilon.ToDouble();
+	TestEqual(TEXT("Predefined rounding 1"), FRealFixed(Lsb * 0.49), 0_fx);
+	TestEqual(TEXT("Predefined rounding 2"), FRealFixed(Lsb * 0.5), Epsilon);
+	TestEqual(TEXT("Predefined rounding 3"), FRealFixed(-Lsb * 1.5), -Epsilon * 2_fx);
+	TestEqual(TEXT("Predefined rounding 4"), FRealFixed(1e-300), 0_fx);
+
+	// Mantissas wider than a double are rounded to nearest, with the halves rounded to even
+	const FRealFixed Big = 9007199254740993_fx; // 2^53 + 1
+	TestEqual(TEXT("Predefined to double 4"), Big.ToDouble(), 9007199254740992.0);
+	TestEqual(TEXT("Predefined to double 5"), (Big + Epsilon).ToDouble(), 9007199254740994.0);
+	TestEqual(TEXT("Predefined to float 1"), (16777217_fx).ToFloat(), 16777216.f);
+
+	// Literals have the value of their string, every time their expression runs
+	for (int32 Index = 0; Index < 3; Index++)
+	{
+		TestEqual(TEXT("Predefined literal 1"), 0.25_fx * FRealFixed(Index), FRealFixed("0.25") * FRealFixed(Index));
+	}
+	TestEqual(TEXT("Predefined literal 2"), 1e15_fx, FRealFixed("1e15"));
+
+	// NaNs give 0, and infinities saturate
+	TestEqual(TEXT("Predefined nan"), FRealFixed(std::numeric_limits<double>::quiet_NaN()), 0_fx);
+	TestEqual(TEXT("Predefined infinity 1"), FRealFixed(std::numeric_limits<double>::infinity()), FRealFixed::GetMaxValue());
+	TestTrue(TEXT("Predefined infinity 2"), FRealFixed(-std::numeric_limits<double>::infinity()) < -FRealFixed::GetMaxValue() + Epsilon);
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathFixedStringsTest, "SpaceKitPrecision.FixedPointMath.Strings", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathFixedStringsTest::RunTest(const FString& Parameters)
+{
+	// Numbers are written with the fewest fraction digits that parse back to them, and at least one
+	TestEqual(TEXT("Predefined to string 1"), (3_fx).ToString(), FString(TEXT("3.0")));
+	TestEqual(TEXT("Predefined to string 2"), (-0.5_fx).ToString(), FString(TEXT("-0.5")));
+	TestEqual(TEXT("Predefined to string 3"), (0.99999999_fx).ToString(), FString(TEXT("0.99999999")));
+	TestEqual(TEXT("Predefined to string 4"), (-1e30_fx).ToString(), FString(TEXT("-1000000000000000000000000000000.0")));
+
+	TCHAR Buffer[FRealFixed::StringBufferSize];
+	const FRealFixed Epsilon(real_fixed_type::GetMinValue());
+	const FRealFixed Values[] = { 0_fx, Epsilon, -Epsilon, 1_fx / 3_fx, -946073047258004200.123_fx, FRealFixed::GetMaxValue() };
+	for (const FRealFixed& Value : Values)
+	{
+		const int32 Length = Value.ToChars(Buffer);
+		const TCHAR* Cursor = Buffer;
+		FRealFixed Parsed;
+		TestTrue(TEXT("Predefined parse"), Parsed.InitFromChars(Cursor));
+		TestEqual(TEXT("Predefined parse end"), int32(Cursor - Buffer), Length);
+		TestEqual(TEXT("Predefined round trip"), Parsed, Value);
+	}
+
+	// Parsing stops after the number, and fails without moving if there is none
+	const TCHAR* Text = TEXT(" -2.5e1)");
+	FRealFixed Parsed;
+	TestTrue(TEXT("Predefined parse partial 1"), Parsed.InitFromChars(Text));
+	TestEqual(TEXT("Predefined parse partial 2"), Parsed, -25_fx);
+	TestEqual(TEXT("Predefined parse partial 3"), *Text, TEXT(')'));
+	TestFalse(TEXT("Predefined parse failure 1"), Parsed.InitFromChars(Text));
+	TestEqual(TEXT("Predefined parse failure 2"), *Text, TEXT(')'));
+
+	// Text export and import
+	FString Exported;
+	(-12.75_fx).ExportTextItem(Exported, 0_fx, nullptr, 0, nullptr);
+	TestEqual(TEXT("Predefined export"), Exported, FString(TEXT("(-12.75)")));
+	const TCHAR* Imported = TEXT("(-12.75),next");
+	TestTrue(TEXT("Predefined import 1"), Parsed.ImportTextItem(Imported, 0, nullptr, nullptr));
+	TestEqual(TEXT("Predefined import 2"), Parsed, -12.75_fx);
+	TestEqual(TEXT("Predefined import 3"), *Imported, TEXT(','));
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathFixedReciprocalTest, "SpaceKitPrecision.FixedPointMath.Reciprocal", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathFixedReciprocalTest::RunTest(const FString& Parameters)
+{
+	const FRealFixed Epsilon(real_fixed_type::GetMinValue());
+	const FRealFixed Dividends[] = { 1_fx, -1_fx, 7_fx, 0.1_fx, -123456.789_fx, 946073047258004200_fx, Epsilon, -Epsilon, 0_fx, FRealFixed::GetMaxValue(), -FRealFixed::GetMaxValue() };
+	const FRealFixed Divisors[] = { 1_fx, -1_fx, 3_fx, 7.3_fx, -0.001_fx, 1e12_fx, -1e20_fx, Epsilon, Epsilon * 3_fx, 946073047258004200_fx };
+
+	// Dividing by a reciprocal gives exactly the same results as dividing by the number
+	for (const FRealFixed& Divisor : Divisors)
+	{
+		const FRealFixedReciprocal Reciprocal(Divisor);
+		TestEqual(TEXT("Predefined reciprocal divisor"), Reciprocal.GetDivisor(), Divisor);
+		for (const FRealFixed& Dividend : Dividends)
+		{
+			TestEqual(FString::Printf(TEXT("Predefined reciprocal %s / %s"), *Dividend.ToString(), *Divisor.ToString()), Dividend / Reciprocal, Dividend / Divisor);
+		}
+	}
+
+	// Like dividing by zero, dividing by its reciprocal leaves the dividend unchanged
+	TestEqual(TEXT("Predefined reciprocal zero"), 5_fx / FRealFixedReciprocal(0_fx), 5_fx / 0_fx);
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathFixedAdvancedMathTest, "SpaceKitPrecision.FixedPointMath.AdvancedMath", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathFixedAdvancedMathTest::RunTest(const FString& Parameters)
+{
+	const FRealFixed Epsilon(real_fixed_type::GetMinValue());
+
+	// Sqrt, rounded to nearest
+	TestEqual(TEXT("Predefined sqrt 1"), URealFixedMath::Sqrt(16_fx), 4_fx);
+	TestEqual(TEXT("Predefined sqrt 2"), URealFixedMath::Sqrt(0.25_fx), 0.5_fx);
+	TestEqual(TEXT("Predefined sqrt 3"), URealFixedMath::Sqrt(0_fx), 0_fx);
+	TestEqual(TEXT("Predefined sqrt 4"), URealFixedMath::Sqrt(1e24_fx), 1e12_fx);
+	TestEqual(TEXT("Predefined sqrt 5"), URealFixedMath::Sqrt(Epsilon * 4_fx), FRealFixed(real_fixed_type::FromMantissa(real_fixed_type::ttIntMantissaType(16384))));
+	TestTrue(TEXT("Predefined sqrt 6"), URealFixedMath::RealEqualsReal(URealFixedMath::Sqrt(2_fx) * URealFixedMath::Sqrt(2_fx), 2_fx, Epsilon * 4_fx));
+
+	// Logarithms, rounded to nearest
+	TestEqual(TEXT("Predefined log2 1"), URealFixedMath::Log2(1024_fx), 10_fx);
+	TestEqual(TEXT("Predefined log2 2"), URealFixedMath::Log2(0.125_fx), -3_fx);
+	TestTrue(TEXT("Predefined log10 1"), URealFixedMath::RealEqualsReal(URealFixedMath::Log10(1000_fx), 3_fx, Epsilon));
+	TestTrue(TEXT("Predefined log10 2"), URealFixedMath::RealEqualsReal(URealFixedMath::Log10(1e6_fx), 6_fx, Epsilon));
+	TestEqual(TEXT("Predefined loge 1"), URealFixedMath::LogE(1_fx), 0_fx);
+	// Logarithms are rounded to Epsilon, about 1.5e-8, so they are within half of it
+	TestEqual(TEXT("Predefined loge 2"), URealFixedMath::LogE(946073047258004200_fx).ToDouble(), std::log(946073047258004200.0), Epsilon.ToDouble() / 2);
+	TestEqual(TEXT("Predefined loge 3"), URealFixedMath::LogE(0.001_fx).ToDouble(), std::log(0.001_fx.ToDouble()), 1e-7);
+	TestEqual(TEXT("Predefined loge 4"), URealFixedMath::LogE(0_fx), URealFixedMath::LogE(-1_fx));
+	TestTrue(TEXT("Predefined loge 5"), URealFixedMath::LogE(0_fx) < -1e29_fx);
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathFixedTrigonometryTest, "SpaceKitPrecision.FixedPointMath.Trigonometry", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathFixedTrigonometryTest::RunTest(const FString& Parameters)
+{
+	const FRealFixed Epsilon(real_fixed_type::GetMinValue());
+
+	TestEqual(TEXT("Predefined sin 1"), URealFixedMath::SinRad(0_fx), 0_fx);
+	TestEqual(TEXT("Predefined cos 1"), URealFixedMath::CosRad(0_fx), 1_fx);
+	TestEqual(TEXT("Predefined sin 2"), URealFixedMath::SinRad(1.5707963267948966192_fx), 1_fx);
+	TestEqual(TEXT("Predefined cos 2"), URealFixedMath::CosRad(3.1415926535897932385_fx), -1_fx);
+	TestEqual(TEXT("Predefined atan 1"), URealFixedMath::AtanRad(1_fx).ToDouble(), DOUBLE_PI / 4, 1e-8);
+	TestEqual(TEXT("Predefined atan 2"), URealFixedMath::AtanRad(0_fx), 0_fx);
+	TestEqual(TEXT("Predefined atan2 1"), URealFixedMath::Atan2Rad(1_fx, -1_fx).ToDouble(), 3 * DOUBLE_PI / 4, 1e-8);
+	TestEqual(TEXT("Predefined atan2 2"), URealFixedMath::Atan2Rad(0_fx, -5_fx).ToDouble(), DOUBLE_PI, 1e-8);
+	TestEqual(TEXT("Predefined atan2 3"), URealFixedMath::Atan2Rad(0_fx, 0_fx), 0_fx);
+	TestEqual(TEXT("Predefined atan2 5"), URealFixedMath::Atan2Rad(-Epsilon, -1e12_fx).ToDouble(), -DOUBLE_PI, 1e-8);
+	TestEqual(TEXT("Predefined atan2 6"), URealFixedMath::Atan2Rad(Epsilon, -1e12_fx).ToDouble(), DOUBLE_PI, 1e-8);
+	TestEqual(TEXT("Predefined hypot 1"), URealFixedMath::Hypot(2_fx, -3_fx, 6_fx), 7_fx);
+	// Roots beyond the largest number saturate to it, instead of wrapping to negative numbers
+	const FRealFixed Largest = FRealFixed::GetMaxValue();
+	TestEqual(TEXT("Predefined hypot 2"), URealFixedMath::Hypot(Largest, -Largest, Largest), Largest);
+	TestEqual(TEXT("Predefined hypot 3"), URealFixedMath::Hypot(Largest, 0_fx, 0_fx), Largest);
+	TestEqual(TEXT("Predefined hypot 4"), URealFixedMath::Hypot(Largest, Largest, 0_fx), Largest);
+	TestEqual(TEXT("Predefined hypot 5"), URealFixedMath::Hypot(Largest * 0.5_fx, Largest * 0.5_fx, 0_fx).ToDouble(), Largest.ToDouble() * 0.7071067811865476, Largest.ToDouble() * 1e-15);
+
+	// Against the double implementations, on angles and ratios spread over several orders of magnitude. The results are rounded to Epsilon, about 1.5e-8
+	for (const double Input : { -1e6, -123.456, -3.0, -0.5, 1e-4, 0.7853981, 2.0, 40.0, 1e9 })
+	{
+		const FRealFixed Fixed(Input);
+		const double Value = Fixed.ToDouble();
+		FRealFixed Sin, Cos;
+		URealFixedMath::SinCosRad(Fixed, Sin, Cos);
+		TestEqual(TEXT("Predefined sincos 1"), Sin.ToDouble(), std::sin(Value), 1e-8);
+		TestEqual(TEXT("Predefined sincos 2"), Cos.ToDouble(), std::cos(Value), 1e-8);
+		TestTrue(TEXT("Predefined sincos 3"), URealFixedMath::RealEqualsReal(Sin * Sin + Cos * Cos, 1_fx, Epsilon * 4_fx));
+		TestEqual(TEXT("Predefined sincos 4"), Sin, URealFixedMath::SinRad(Fixed));
+		TestEqual(TEXT("Predefined atan 3"), URealFixedMath::AtanRad(Fixed).ToDouble(), std::atan(Value), 1e-8);
+		TestEqual(TEXT("Predefined atan2 4"), URealFixedMath::Atan2Rad(Fixed, -7_fx).ToDouble(), std::atan2(Value, -7.0), 1e-8);
+	}
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+
+#if FIXED_INT128_SUPPORTED
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCoreMathFixedNativeInt128Test, "SpaceKitPrecision.FixedPointMath.NativeInt128", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FCoreMathFixedNativeInt128Test::RunTest(const FString& Parameters)
+{
+	using ttIntType = fixed_int128::ttIntType;
+
+	// Edge values, where overflows and signs handling differ the most
+	TArray<fixed_int128> Values;
+	{
+		fixed_int128 Max, Min;
+		Max.SetMax();
+		Min.SetMin();
+		Values.Append({ fixed_int128(0), fixed_int128(1), fixed_int128(-1), fixed_int128(2), fixed_int128(-3), Max, Min, Max - fixed_int128(1), Min + fixed_int128(1) });
+		Values.Append({ fixed_int128::FromLimbs(~0ull, 0), fixed_int128::FromLimbs(0, 1), fixed_int128::FromLimbs(~0ull, ~0ull - 1), real_fixed_type::GetExponentiatedTtInt() });
+	}
+
+	// And pseudo-random values of all magnitudes
+	uint64 Seed = 0x2545F4914F6CDD1Dull;
+	const auto Random = [&Seed]()
+	{
+		Seed ^= Seed << 13;
+		Seed ^= Seed >> 7;
+		Seed ^= Seed << 17;
+		return Seed;
+	};
+	for (int32 Shift = 0; Shift < 64; Shift++)
+	{
+		Values.Add(fixed_int128::FromLimbs(Random(), Random() >> Shift));
+		Values.Add(-fixed_int128::FromLimbs(Random() >> Shift, 0));
+	}
+
+	const auto TestSame = [this](const TCHAR* What, const fixed_int128& Native, const ttIntType& Reference)
+	{
+		if (Native != fixed_int128(Reference))
+		{
+			AddError(FString::Printf(TEXT("Native %s is %s, but ttmath gives %s"), What, *ttbigToString(Native), *ttbigToString(Reference)));
+		}
+	};
+
+	for (const fixed_int128& x : Values)
+	{
+		const ttIntType ttX = x;
+		TestSame(TEXT("negation"), -x, -ttX);
+		TestSame(TEXT("absolute value"), Abs(x), ttmath::Abs(ttX));
+
+		for (const fixed_int128& y : Values)
+		{
+			const ttIntType ttY = y;
+			TestSame(TEXT("addition"), x + y, ttX + ttY);
+			TestSame(TEXT("substraction"), x - y, ttX - ttY);
+			TestSame(TEXT("multiplication"), x * y, ttX * ttY);
+			TestSame(TEXT("division"), x / y, ttX / ttY);
+			TestSame(TEXT("fixed point multiplication"), MulShiftRound(x, y, REAL_FIXED_EXPONENT), MulShiftRound(ttX, ttY, REAL_FIXED_EXPONENT));
+			TestSame(TEXT("fixed point division"), ShiftDivRound(x, y, REAL_FIXED_EXPONENT), ShiftDivRound(ttX, ttY, REAL_FIXED_EXPONENT));
+			// ttmath leaves the remainder of a division by zero undefined
+			if (!y.IsZero())
+			{
+				TestSame(TEXT("modulo"), x % y, ttX % ttY);
+			}
+			TestEqual(TEXT("Native strictly inferior"), x < y, ttX < ttY);
+			TestEqual(TEXT("Native inferior or equal"), x <= y, ttX <= ttY);
+			TestEqual(TEXT("Native equal"), x == y, ttX == ttY);
+		}
+	}
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+#endif // FIXED_INT128_SUPPORTED
+
+
 #endif //WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,410 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Containers/UnrealString.h"
+#include "Core/Public/Misc/AutomationTest.h"
+#include "Core/Public/HAL/PlatformTime.h"
+
+#include "SpaceKitPrecision/Public/RealFloat.h"
+#include "SpaceKitPrecision/Public/RealHybrid.h"
+#include "SpaceKitPrecision/Public/RealFloatTrigo.h"
+#include "SpaceKitPrecision/Public/RealFloatExpLog.h"
+#include "SpaceKitPrecision/Public/RealFloatSqrt.h"
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SpaceKitRealFloatBenchmark
+{
+	// The ttmath storage of FRealFloat, whatever the current setting is
+	using ttmathType = ttmath::Big<TTMATH_BITS(64), TTMATH_BITS(TT_REAL_FLOAT_SIZE)>;
+
+	static const int32 NumValues = 1 << 10;
+	static const int32 NumPasses = 64;
+
+	// Returns the time, in nanoseconds, taken by one operation on average.
+	// Operation is applied on all pairs of consecutive values, and accumulated, so the compiler can't skip it
+	template<typename ValueType, typename OperationType, typename AccumulatorType>
+	double TimeOperation(const TArray<ValueType>& Values, OperationType Operation, AccumulatorType& Accumulator)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumPasses; Pass++)
+		{
+			for (int32 Index = 1; Index < Values.Num(); Index++)
+			{
+				Accumulator += Operation(Values[Index - 1], Values[Index]);
+			}
+		}
+		return (FPlatformTime::Seconds() - Start) * 1e9 / (double(NumPasses) * (Values.Num() - 1));
+	}
+
+	// Times the operations FRealFloat relies on the most, for one storage type
+	template<typename ValueType>
+	void TimeStorage(FAutomationTestBase& Test, const TCHAR* Name, const TArray<double>& Doubles)
+	{
+		TArray<ValueType> Values;
+		for (const double Value : Doubles)
+		{
+			Values.Add(ValueType(Value));
+		}
+
+		ValueType Accumulator = ValueType(0);
+		const double AddTime = TimeOperation(Values, [](const ValueType& x, const ValueType& y) { return x + y; }, Accumulator);
+		const double MultiplyTime = TimeOperation(Values, [](const ValueType& x, const ValueType& y) { return x * y; }, Accumulator);
+		const double DivideTime = TimeOperation(Values, [](const ValueType& x, const ValueType& y) { return x / y; }, Accumulator);
+		const double SqrtTime = TimeOperation(Values, [](const ValueType& x, const ValueType& y) { return Sqrt(x * x); }, Accumulator);
+		const double SinTime = TimeOperation(Values, [](const ValueType& x, const ValueType& y) { return Sin(x); }, Accumulator);
+
+		Test.AddInfo(FString::Printf(TEXT("%s: addition %.1f ns, multiplication %.1f ns, division %.1f ns, square root %.1f ns, sine %.1f ns (checksum %s)"),
+			Name, AddTime, MultiplyTime, DivideTime, SqrtTime, SinTime, UTF8_TO_TCHAR(Accumulator.ToString().c_str())));
+	}
+
+	// Returns the time, in nanoseconds, taken by one operation on average, like TimeOperation. The results are stored instead of accumulated,
+	// so the time doesn't depend on the accumulator's representation
+	template<typename ValueType, typename OperationType>
+	double TimeIntoArray(const TArray<ValueType>& Values, OperationType Operation, TArray<ValueType>& Results)
+	{
+		Results.SetNum(Values.Num());
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumPasses; Pass++)
+		{
+			for (int32 Index = 1; Index < Values.Num(); Index++)
+			{
+				Results[Index] = Operation(Values[Index - 1], Values[Index]);
+			}
+		}
+		return (FPlatformTime::Seconds() - Start) * 1e9 / (double(NumPasses) * (Values.Num() - 1));
+	}
+
+	// Times the arithmetic of FRealHybrid or FRealFloat
+	template<typename ValueType>
+	void TimeArithmetic(const TArray<double>& Doubles, double& OutAddTime, double& OutMultiplyTime, double& OutDivideTime, double& OutChecksum)
+	{
+		TArray<ValueType> Values, Results;
+		for (const double Value : Doubles)
+		{
+			Values.Add(ValueType(Value));
+		}
+
+		OutChecksum = 0;
+		const auto Checksum = [&]()
+		{
+			for (const ValueType& Result : Results)
+			{
+				OutChecksum += Result.ToDouble();
+			}
+		};
+		OutAddTime = TimeIntoArray(Values, [](const ValueType& x, const ValueType& y) { return x + y; }, Results);
+		Checksum();
+		OutMultiplyTime = TimeIntoArray(Values, [](const ValueType& x, const ValueType& y) { return x * y; }, Results);
+		Checksum();
+		OutDivideTime = TimeIntoArray(Values, [](const ValueType& x, const ValueType& y) { return x / y; }, Results);
+		Checksum();
+	}
+
+	// Times velocity updates as the integrators do them, v += a * dt, in nanoseconds per update
+	template<typename ValueType>
+	double TimeVelocityUpdates(const TArray<double>& Doubles, double& OutChecksum)
+	{
+		TArray<ValueType> Velocities, Accelerations;
+		for (const double Value : Doubles)
+		{
+			Velocities.Add(ValueType(Value));
+			Accelerations.Add(ValueType(Value / 7));
+		}
+
+		const ValueType Step(1.0 / 60);
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumPasses; Pass++)
+		{
+			for (int32 Index = 0; Index < Velocities.Num(); Index++)
+			{
+				Velocities[Index] += Accelerations[Index] * Step;
+			}
+		}
+		const double Time = (FPlatformTime::Seconds() - Start) * 1e9 / (double(NumPasses) * Velocities.Num());
+
+		OutChecksum = 0;
+		for (const ValueType& Velocity : Velocities)
+		{
+			OutChecksum += Velocity.ToDouble();
+		}
+		return Time;
+	}
+
+	// Four components, read as a vector (the first three) or as a quaternion (X, Y, Z, W)
+	template<typename NumberType>
+	struct TComponents
+	{
+		NumberType C[4];
+	};
+
+	// Times vector and quaternion math written as plain expressions on a boost number type, as FRealFloat's operators do with the boost storage.
+	// With expression templates, each expression is evaluated when it's assigned, into the result's storage. Without them, every product and sum is a new number
+	template<boost::multiprecision::expression_template_option ExpressionTemplates>
+	void TimeBoostExpressions(FAutomationTestBase& Test, const TCHAR* Name, const TArray<double>& Doubles, double& OutDotTime, double& OutCrossTime, double& OutQuatTime)
+	{
+		using NumberType = TBoostFloat<ExpressionTemplates>;
+		using ComponentsType = TComponents<NumberType>;
+
+		TArray<ComponentsType> Values;
+		for (int32 Index = 0; Index + 3 < Doubles.Num(); Index += 4)
+		{
+			Values.Add(ComponentsType{ { NumberType(Doubles[Index]), NumberType(Doubles[Index + 1]), NumberType(Doubles[Index + 2]), NumberType(Doubles[Index + 3]) } });
+		}
+
+		NumberType Accumulator = NumberType(0);
+		OutDotTime = TimeOperation(Values, [](const ComponentsType& a, const ComponentsType& b)
+		{
+			NumberType Dot = a.C[0] * b.C[0] + a.C[1] * b.C[1] + a.C[2] * b.C[2];
+			return Dot;
+		}, Accumulator);
+		OutCrossTime = TimeOperation(Values, [](const ComponentsType& a, const ComponentsType& b)
+		{
+			ComponentsType Cross;
+			Cross.C[0] = a.C[1] * b.C[2] - a.C[2] * b.C[1];
+			Cross.C[1] = a.C[2] * b.C[0] - a.C[0] * b.C[2];
+			Cross.C[2] = a.C[0] * b.C[1] - a.C[1] * b.C[0];
+			return NumberType(Cross.C[0] + Cross.C[1] + Cross.C[2]);
+		}, Accumulator);
+		OutQuatTime = TimeOperation(Values, [](const ComponentsType& a, const ComponentsType& b)
+		{
+			ComponentsType Product;
+			Product.C[0] = a.C[3] * b.C[0] + a.C[0] * b.C[3] + a.C[1] * b.C[2] - a.C[2] * b.C[1];
+			Product.C[1] = a.C[3] * b.C[1] - a.C[0] * b.C[2] + a.C[1] * b.C[3] + a.C[2] * b.C[0];
+			Product.C[2] = a.C[3] * b.C[2] + a.C[0] * b.C[1] - a.C[1] * b.C[0] + a.C[2] * b.C[3];
+			Product.C[3] = a.C[3] * b.C[3] - a.C[0] * b.C[0] - a.C[1] * b.C[1] - a.C[2] * b.C[2];
+			return NumberType(Product.C[0] + Product.C[1] + Product.C[2] + Product.C[3]);
+		}, Accumulator);
+
+		Test.AddInfo(FString::Printf(TEXT("%s: dot product %.1f ns, cross product %.1f ns, quaternion product %.1f ns (checksum %s)"),
+			Name, OutDotTime, OutCrossTime, OutQuatTime, UTF8_TO_TCHAR(Accumulator.str().c_str())));
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionRealFloatBackendsBenchmark, "SpaceKitPrecision.Benchmarks.RealFloatBackends", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionRealFloatBackendsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFloatBenchmark;
+
+	// Values between 1e-3 and 1e6, positive so square roots are defined
+	TArray<double> Doubles;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		Doubles.Add((double)FMath::Pow(10.f, FMath::FRandRange(-3.f, 6.f)));
+	}
+
+	AddInfo(FString::Printf(TEXT("ttmath limb kernels: %s"), SPACEKIT_TTMATH_KERNELS));
+	AddInfo(FString::Printf(TEXT("FRealFloat storage: %s"), USE_MULTI_DOUBLE_BIG ? TEXT("multi-double") : USE_FLOAT128_STORAGE ? TEXT("__float128") : TEXT("ttmath")));
+	TimeStorage<ttmathType>(*this, TEXT("ttmath"), Doubles);
+	TimeStorage<ddmath::DoubleDouble>(*this, TEXT("Double-double"), Doubles);
+	TimeStorage<ddmath::QuadDouble>(*this, TEXT("Quad-double"), Doubles);
+#if SPACEKIT_HAS_FLOAT128
+	TimeStorage<f128math::Float128>(*this, SPACEKIT_WITH_QUADMATH ? TEXT("__float128 (libquadmath)") : TEXT("__float128 (ttmath kernels)"), Doubles);
+#endif
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionRealFloatTrigoBenchmark, "SpaceKitPrecision.Benchmarks.RealFloatTrigo", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionRealFloatTrigoBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFloatBenchmark;
+
+	// Angles between -4 and 4 radians, to hit every quadrant, and tangents between -50 and 50
+	TArray<ttmathType> Angles;
+	TArray<ttmathType> Tangents;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		Angles.Add(ttmathType(FMath::FRandRange(-4.f, 4.f)));
+		Tangents.Add(ttmathType(FMath::FRandRange(-50.f, 50.f)));
+	}
+
+	ttmathType Accumulator = ttmathType(0);
+	const double SeriesSinTime = TimeOperation(Angles, [](const ttmathType& x, const ttmathType& y) { return ttmath::Sin(x); }, Accumulator);
+	const double SeriesCosTime = TimeOperation(Angles, [](const ttmathType& x, const ttmathType& y) { return ttmath::Cos(x); }, Accumulator);
+	const double SeriesATanTime = TimeOperation(Tangents, [](const ttmathType& x, const ttmathType& y) { return ttmath::ATan(x); }, Accumulator);
+
+	const double SinCosTime = TimeOperation(Angles, [](const ttmathType& x, const ttmathType& y)
+	{
+		ttmathType Sin, Cos;
+		RealFloatTrigo::SinCos(x, Sin, Cos);
+		return Sin + Cos;
+	}, Accumulator);
+	const double SinCosDegTime = TimeOperation(Angles, [](const ttmathType& x, const ttmathType& y)
+	{
+		ttmathType Sin, Cos;
+		RealFloatTrigo::SinCosDeg(x * ttmathType(45), Sin, Cos);
+		return Sin + Cos;
+	}, Accumulator);
+	const double ATanTime = TimeOperation(Tangents, [](const ttmathType& x, const ttmathType& y) { return RealFloatTrigo::ATan(x); }, Accumulator);
+
+	AddInfo(FString::Printf(TEXT("ttmath series: sine %.1f ns, cosine %.1f ns, arc tangent %.1f ns"), SeriesSinTime, SeriesCosTime, SeriesATanTime));
+	AddInfo(FString::Printf(TEXT("Table kernels: sine and cosine %.1f ns, in degrees %.1f ns, arc tangent %.1f ns (checksum %s)"),
+		SinCosTime, SinCosDegTime, ATanTime, UTF8_TO_TCHAR(Accumulator.ToString().c_str())));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionRealFloatExpLogBenchmark, "SpaceKitPrecision.Benchmarks.RealFloatExpLog", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionRealFloatExpLogBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFloatBenchmark;
+
+	// Exponents between -20 and 20, and positive values spread over many orders of magnitude
+	TArray<ttmathType> Exponents;
+	TArray<ttmathType> Values;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		Exponents.Add(ttmathType(FMath::FRandRange(-20.f, 20.f)));
+		Values.Add(ttmathType(FMath::Exp(FMath::FRandRange(-20.f, 20.f))));
+	}
+
+	ttmathType Accumulator = ttmathType(0);
+	const double SeriesExpTime = TimeOperation(Exponents, [](const ttmathType& x, const ttmathType& y) { return ttmath::Exp(x); }, Accumulator);
+	const double SeriesLnTime = TimeOperation(Values, [](const ttmathType& x, const ttmathType& y) { return ttmath::Ln(x); }, Accumulator);
+	const double SeriesLog10Time = TimeOperation(Values, [](const ttmathType& x, const ttmathType& y) { return ttmath::Log(x, ttmathType(10)); }, Accumulator);
+	const double SeriesCubeTime = TimeOperation(Values, [](const ttmathType& x, const ttmathType& y) { return ttmath::Exp(ttmathType(3) * ttmath::Ln(x)); }, Accumulator);
+
+	const double ExpTime = TimeOperation(Exponents, [](const ttmathType& x, const ttmathType& y) { return RealFloatExpLog::Exp(x); }, Accumulator);
+	const double LnTime = TimeOperation(Values, [](const ttmathType& x, const ttmathType& y) { return RealFloatExpLog::Ln(x); }, Accumulator);
+	const double Log10Time = TimeOperation(Values, [](const ttmathType& x, const ttmathType& y) { return RealFloatExpLog::Log10(x); }, Accumulator);
+	const double CubeTime = TimeOperation(Values, [](const ttmathType& x, const ttmathType& y) { return RealFloatExpLog::PowInt(x, 3); }, Accumulator);
+
+	AddInfo(FString::Printf(TEXT("ttmath series: exp %.1f ns, ln %.1f ns, log10 %.1f ns, x^3 %.1f ns"), SeriesExpTime, SeriesLnTime, SeriesLog10Time, SeriesCubeTime));
+	AddInfo(FString::Printf(TEXT("Table kernels: exp %.1f ns, ln %.1f ns, log10 %.1f ns, integer x^3 %.1f ns (checksum %s)"),
+		ExpTime, LnTime, Log10Time, CubeTime, UTF8_TO_TCHAR(Accumulator.ToString().c_str())));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionRealFloatSqrtBenchmark, "SpaceKitPrecision.Benchmarks.RealFloatSqrt", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionRealFloatSqrtBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFloatBenchmark;
+
+	// Squared lengths, over many orders of magnitude
+	TArray<ttmathType> Values;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		Values.Add(ttmathType(FMath::Exp(FMath::FRandRange(-40.f, 40.f))));
+	}
+
+	ttmathType Accumulator = ttmathType(0);
+	const double DigitSqrtTime = TimeOperation(Values, [](const ttmathType& x, const ttmathType& y) { return ttmath::Sqrt(x); }, Accumulator);
+	const double DigitInvSqrtTime = TimeOperation(Values, [](const ttmathType& x, const ttmathType& y) { return ttmathType(1) / ttmath::Sqrt(x); }, Accumulator);
+	const double SqrtTime = TimeOperation(Values, [](const ttmathType& x, const ttmathType& y) { return RealFloatSqrt::Sqrt(x); }, Accumulator);
+	const double InvSqrtTime = TimeOperation(Values, [](const ttmathType& x, const ttmathType& y) { return RealFloatSqrt::InvSqrt(x); }, Accumulator);
+
+	AddInfo(FString::Printf(TEXT("ttmath digit by digit: sqrt %.1f ns, 1 / sqrt %.1f ns"), DigitSqrtTime, DigitInvSqrtTime));
+	AddInfo(FString::Printf(TEXT("Newton kernels: sqrt %.1f ns, inverse sqrt %.1f ns (checksum %s)"), SqrtTime, InvSqrtTime, UTF8_TO_TCHAR(Accumulator.ToString().c_str())));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionRealFloatStringsBenchmark, "SpaceKitPrecision.Benchmarks.RealFloatStrings", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionRealFloatStringsBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFloatBenchmark;
+
+	// Values between 1e-3 and 1e6, of both signs, with all their mantissa bits set, like computed values
+	TArray<FRealFloat> Values;
+	TArray<FString> Strings;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		Values.Add(FRealFloat((double)FMath::Pow(10.f, FMath::FRandRange(-3.f, 6.f)) * (Index % 2 == 0 ? 1.0 : -1.0)) / 3_fl);
+		Strings.Add(Values[Index].ToString());
+	}
+
+	// The legacy conversions went through std::string, and the parsing through an ANSI copy of the string
+	int32 Length = 0;
+	FRealFloat Accumulator = FRealFloat(0);
+	const double ToCharsTime = TimeOperation(Values, [](const FRealFloat& x, const FRealFloat& y)
+	{
+		TCHAR Buffer[FRealFloat::StringBufferSize];
+		return x.ToChars(Buffer);
+	}, Length);
+	const double ToStringTime = TimeOperation(Values, [](const FRealFloat& x, const FRealFloat& y) { return x.ToString().Len(); }, Length);
+	const double LegacyToStringTime = TimeOperation(Values, [](const FRealFloat& x, const FRealFloat& y) { return FString(x.GetValue().ToString().c_str()).Len(); }, Length);
+	const double ParseTime = TimeOperation(Strings, [](const FString& x, const FString& y)
+	{
+		const TCHAR* Cursor = *x;
+		FRealFloat Value = FRealFloat(0);
+		Value.InitFromChars(Cursor);
+		return Value;
+	}, Accumulator);
+	const double LegacyParseTime = TimeOperation(Strings, [](const FString& x, const FString& y) { return FRealFloat(FRealFloat::ttBigType(TCHAR_TO_ANSI(*x))); }, Accumulator);
+
+	AddInfo(FString::Printf(TEXT("To characters: %.1f ns, to FString: %.1f ns (was %.1f ns), %.1fx faster"), ToCharsTime, ToStringTime, LegacyToStringTime, LegacyToStringTime / FMath::Max(ToStringTime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("From characters: %.1f ns (was %.1f ns), %.1fx faster"), ParseTime, LegacyParseTime, LegacyParseTime / FMath::Max(ParseTime, 1e-6)));
+	AddInfo(FString::Printf(TEXT("Checksums: %d, %s"), Length, *Accumulator.ToString()));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionBoostExpressionTemplatesBenchmark, "SpaceKitPrecision.Benchmarks.BoostExpressionTemplates", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionBoostExpressionTemplatesBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFloatBenchmark;
+
+	// Values between -1e6 and 1e6, like positions and rotations
+	TArray<double> Doubles;
+	for (int32 Index = 0; Index < 4 * NumValues; Index++)
+	{
+		Doubles.Add((double)FMath::Pow(10.f, FMath::FRandRange(-3.f, 6.f)) * (Index % 3 == 0 ? -1.0 : 1.0));
+	}
+
+	AddInfo(FString::Printf(TEXT("FRealFloat storage: %s, expression templates %s"), USE_BOOST_BIG ? TEXT("boost") : TEXT("not boost"), BOOST_EXPRESSION_TEMPLATES ? TEXT("on") : TEXT("off")));
+	double DotOn, CrossOn, QuatOn, DotOff, CrossOff, QuatOff;
+	TimeBoostExpressions<boost::multiprecision::et_on>(*this, TEXT("et_on"), Doubles, DotOn, CrossOn, QuatOn);
+	TimeBoostExpressions<boost::multiprecision::et_off>(*this, TEXT("et_off"), Doubles, DotOff, CrossOff, QuatOff);
+	AddInfo(FString::Printf(TEXT("et_on speedup: dot product %.2fx, cross product %.2fx, quaternion product %.2fx"),
+		DotOff / FMath::Max(DotOn, 1e-6), CrossOff / FMath::Max(CrossOn, 1e-6), QuatOff / FMath::Max(QuatOn, 1e-6)));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionRealHybridBenchmark, "SpaceKitPrecision.Benchmarks.RealHybrid", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSpacePrecisionRealHybridBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace SpaceKitRealFloatBenchmark;
+
+	// Values between 1e-3 and 1e6. Rounded to multiples of 1/16, their sums and products are exact, like the ones of masses, velocities and
+	// time steps with few significant digits. Their quotients mostly aren't. Divided by 3, they use the whole mantissa and most results aren't exact.
+	// Without a tolerance (see PrecisionSettings.h), inexact results are promoted
+	TArray<double> Doubles, ExactDoubles;
+	for (int32 Index = 0; Index < NumValues; Index++)
+	{
+		const double Value = (double)FMath::Pow(10.f, FMath::FRandRange(-3.f, 6.f));
+		Doubles.Add(Value / 3);
+		ExactDoubles.Add(FMath::FloorToDouble(Value * 16 + 1) / 16);
+	}
+
+	const auto Time = [this](const TCHAR* Name, const TArray<double>& Values)
+	{
+		double HybridAdd, HybridMultiply, HybridDivide, HybridChecksum, FloatAdd, FloatMultiply, FloatDivide, FloatChecksum;
+		TimeArithmetic<FRealHybrid>(Values, HybridAdd, HybridMultiply, HybridDivide, HybridChecksum);
+		TimeArithmetic<FRealFloat>(Values, FloatAdd, FloatMultiply, FloatDivide, FloatChecksum);
+		AddInfo(FString::Printf(TEXT("%s: FRealHybrid addition %.1f ns, multiplication %.1f ns, division %.1f ns (checksum %g)"), Name, HybridAdd, HybridMultiply, HybridDivide, HybridChecksum));
+		AddInfo(FString::Printf(TEXT("%s: FRealFloat addition %.1f ns, multiplication %.1f ns, division %.1f ns (checksum %g)"), Name, FloatAdd, FloatMultiply, FloatDivide, FloatChecksum));
+	};
+
+	Time(TEXT("Exact values"), ExactDoubles);
+	Time(TEXT("Random values"), Doubles);
+
+	double HybridChecksum, FloatChecksum;
+	const double HybridUpdate = TimeVelocityUpdates<FRealHybrid>(ExactDoubles, HybridChecksum);
+	const double FloatUpdate = TimeVelocityUpdates<FRealFloat>(ExactDoubles, FloatChecksum);
+	AddInfo(FString::Printf(TEXT("Velocity updates: FRealHybrid %.1f ns, FRealFloat %.1f ns (checksums %g, %g)"), HybridUpdate, FloatUpdate, HybridChecksum, FloatChecksum));
+
+	return true;
+}
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -104,6 +104,22 @@ bool FCoreMathFloatOperatorsTest::RunTest(const FString& Parameters)
 		TestEqual(TEXT("Predefined div assign operator works 2"), a, -0.25_fl);
 	}
 
+	// Chained and aliased assigns
+	{
+		FRealFloat a = 2_fl;
+		(a += 1_fl) *= 4_fl;
+		TestEqual(TEXT("Predefined chained assign operators work"), a, 12_fl);
+		a += a;
+		TestEqual(TEXT("Predefined aliased add assign operator works"), a, 24_fl);
+		a -= a;
+		TestEqual(TEXT("Predefined aliased sub assign operator works"), a, 0_fl);
+		a = 3_fl;
+		a *= a;
+		TestEqual(TEXT("Predefined aliased mult assign operator works"), a, 9_fl);
+		a /= a;
+		TestEqual(TEXT("Predefined aliased div assign operator works"), a, 1_fl);
+	}
+
 	return true;
 }
 
@@ -325,6 +341,20 @@ bool FSpacePrecisionFloatAdvancedMath::RunTest(const FString& Parameters)
 		TestEqual(TEXT("Predefined sqrt 1"), URealFloatMath::Sqrt(4_fl).ToFloat(), 2_fl.ToFloat());
 		TestEqual(TEXT("Predefined sqrt 2"), URealFloatMath::Sqrt(1_fl).ToFloat(), 1_fl.ToFloat());
 		TestEqual(TEXT("Predefined sqrt 3"), URealFloatMath::Sqrt(0.25_fl).ToFloat(), 0.5_fl.ToFloat());
+		// The inputs are built in FRealFloat: 123456789^2 doesn't fit in a double's mantissa, and 2e-30 or 1e40 aren't doubles
+		TestEqual(TEXT("Predefined sqrt 4"), URealFloatMath::Sqrt(FRealFloat(123456789) * FRealFloat(123456789)), FRealFloat(123456789));
+		TestEqual(TEXT("Predefined sqrt 5"), URealFloatMath::Sqrt(0_fl), 0_fl);
+		TestTrue(TEXT("Predefined sqrt 6"), URealFloatMath::RealEqualsReal(URealFloatMath::Sqrt(2_fl) * URealFloatMath::Sqrt(2_fl), 2_fl, 1e-30_fl));
+		TestTrue(TEXT("Predefined sqrt 7"), URealFloatMath::RealEqualsReal(URealFloatMath::Sqrt(2e-30_fl) / URealFloatMath::Sqrt(2_fl), 1e-15_fl, 1e-45_fl));
+	}
+
+	// InvSqrt
+	{
+		TestEqual(TEXT("Predefined invsqrt 1"), URealFloatMath::InvSqrt(4_fl), 0.5_fl);
+		TestEqual(TEXT("Predefined invsqrt 2"), URealFloatMath::InvSqrt(0.0625_fl), 4_fl);
+		TestEqual(TEXT("Predefined invsqrt 3"), URealFloatMath::InvSqrt(8_fl).ToDouble(), 1.0 / std::sqrt(8.0), 1e-15);
+		TestTrue(TEXT("Predefined invsqrt 4"), URealFloatMath::RealEqualsReal(URealFloatMath::InvSqrt(3_fl) * URealFloatMath::Sqrt(3_fl), 1_fl, 1e-30_fl));
+		TestTrue(TEXT("Predefined invsqrt 5"), URealFloatMath::RealEqualsReal(URealFloatMath::InvSqrt(1e40_fl), 1e-20_fl, 1e-50_fl));
 	}
 
 	// Exp
@@ -408,6 +438,145 @@ bool FSpacePrecisionFloatAdvancedMath::RunTest(const FString& Parameters)
 
 #pragma optimize("", on)
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionFloatSinCosTest, "SpaceKitPrecision.FloatingPointMath.SinCos", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpacePrecisionFloatSinCosTest::RunTest(const FString& Parameters)
+{
+	FRealFloat Sin, Cos;
+
+	// Degrees are reduced exactly
+	{
+		URealFloatMath::SinCosDeg(90_fl, Sin, Cos);
+		TestEqual(TEXT("Predefined sincosdeg 1"), Sin, 1_fl);
+		TestEqual(TEXT("Predefined sincosdeg 2"), Cos, 0_fl);
+
+		URealFloatMath::SinCosDeg(FRealFloat(-540), Sin, Cos);
+		TestEqual(TEXT("Predefined sincosdeg 3"), Sin, 0_fl);
+		TestEqual(TEXT("Predefined sincosdeg 4"), Cos, FRealFloat(-1));
+
+		URealFloatMath::SinCosDeg(30_fl, Sin, Cos);
+		TestTrue(TEXT("Predefined sincosdeg 5"), URealFloatMath::RealEqualsReal(Sin, 0.5_fl, 1e-30_fl));
+		TestTrue(TEXT("Predefined sincosdeg 6"), URealFloatMath::RealEqualsReal(Cos, URealFloatMath::Sqrt(3_fl) / 2_fl, 1e-30_fl));
+	}
+
+	// Radians, in all quadrants and far from zero
+	{
+		const double Angles[] = { 0.3, -0.7, 2.0, -2.5, 4.0, 100.0, -12345.678 };
+		for (const double Angle : Angles)
+		{
+			URealFloatMath::SinCosRad(FRealFloat(Angle), Sin, Cos);
+			TestEqual(FString::Printf(TEXT("Predefined sincosrad sin %f"), Angle), Sin.ToDouble(), std::sin(Angle), 1e-12);
+			TestEqual(FString::Printf(TEXT("Predefined sincosrad cos %f"), Angle), Cos.ToDouble(), std::cos(Angle), 1e-12);
+			TestTrue(FString::Printf(TEXT("Predefined sincosrad identity %f"), Angle), URealFloatMath::RealEqualsReal(Sin * Sin + Cos * Cos, 1_fl, 1e-30_fl));
+			TestEqual(FString::Printf(TEXT("Predefined sincosrad sin matches %f"), Angle), URealFloatMath::SinRad(FRealFloat(Angle)), Sin);
+		}
+	}
+
+	// Arc tangent, on both sides of 1
+	{
+		const double Values[] = { 0.01, -0.4, 1.0, 3.0, -250.0 };
+		for (const double Value : Values)
+		{
+			TestEqual(FString::Printf(TEXT("Predefined atanrad %f"), Value), URealFloatMath::AtanRad(FRealFloat(Value)).ToDouble(), std::atan(Value), 1e-12);
+		}
+		TestTrue(TEXT("Predefined atanrad 1"), URealFloatMath::RealEqualsReal(URealFloatMath::AtanRad(1_fl) * 4_fl, FRealFloat::Pi, 1e-30_fl));
+	}
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionFloatExpLogTest, "SpaceKitPrecision.FloatingPointMath.ExpLog", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpacePrecisionFloatExpLogTest::RunTest(const FString& Parameters)
+{
+	// Powers of two and integer powers are exact
+	{
+		TestEqual(TEXT("Predefined log2 exact 1"), URealFloatMath::Log2(8_fl), 3_fl);
+		TestEqual(TEXT("Predefined log2 exact 2"), URealFloatMath::Log2(1_fl / 1024_fl), FRealFloat(-10));
+		TestEqual(TEXT("Predefined log2 exact 3"), URealFloatMath::Log2(1_fl), 0_fl);
+		TestEqual(TEXT("Predefined powint 1"), URealFloatMath::PowInt(3_fl, 5), 243_fl);
+		TestEqual(TEXT("Predefined powint 2"), URealFloatMath::PowInt(2_fl, -3), 0.125_fl);
+		TestEqual(TEXT("Predefined powint 3"), URealFloatMath::PowInt(FRealFloat(-2), 3), FRealFloat(-8));
+		TestEqual(TEXT("Predefined powint 4"), URealFloatMath::PowInt(7_fl, 0), 1_fl);
+		TestEqual(TEXT("Predefined pow integer"), URealFloatMath::Pow(2_fl, 10_fl), 1024_fl);
+		TestEqual(TEXT("Predefined pow negative base"), URealFloatMath::Pow(FRealFloat(-3), 3_fl), FRealFloat(-27));
+	}
+
+	// Other values are correct to the last few bits
+	{
+		const double Values[] = { 1e-20, 0.001, 0.7, 0.999, 1.001, 2.5, 1234.5, 1e30 };
+		for (const double Value : Values)
+		{
+			const FRealFloat Real(Value);
+			// ToDouble truncates, and these results reach 69, where a double's last bit is 1.4e-14: they are compared relatively, as exp's are below
+			TestTrue(FString::Printf(TEXT("Predefined loge %g"), Value), FMath::Abs(URealFloatMath::LogE(Real).ToDouble() / std::log(Value) - 1.0) < 1e-14);
+			TestTrue(FString::Printf(TEXT("Predefined log2 %g"), Value), FMath::Abs(URealFloatMath::Log2(Real).ToDouble() / std::log2(Value) - 1.0) < 1e-14);
+			TestTrue(FString::Printf(TEXT("Predefined log10 %g"), Value), FMath::Abs(URealFloatMath::Log10(Real).ToDouble() / std::log10(Value) - 1.0) < 1e-14);
+			TestTrue(FString::Printf(TEXT("Predefined exp loge %g"), Value), URealFloatMath::RealEqualsReal(URealFloatMath::Exp(URealFloatMath::LogE(Real)) / Real, 1_fl, 1e-30_fl));
+		}
+
+		const double Exponents[] = { -700.0, -3.3, -1e-10, 0.5, 1.0, 42.0, 700.0 };
+		for (const double Exponent : Exponents)
+		{
+			const double Expected = std::exp(Exponent);
+			TestTrue(FString::Printf(TEXT("Predefined exp %g"), Exponent), FMath::Abs(URealFloatMath::Exp(FRealFloat(Exponent)).ToDouble() / Expected - 1.0) < 1e-14);
+		}
+
+		TestTrue(TEXT("Predefined log10 1000"), URealFloatMath::RealEqualsReal(URealFloatMath::Log10(1000_fl), 3_fl, 1e-30_fl));
+		TestTrue(TEXT("Predefined pow fractional"), URealFloatMath::RealEqualsReal(URealFloatMath::Pow(2_fl, 0.5_fl), URealFloatMath::Sqrt(2_fl), 1e-30_fl));
+	}
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionFloatFusedProductsTest, "SpaceKitPrecision.FloatingPointMath.FusedProducts", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpacePrecisionFloatFusedProductsTest::RunTest(const FString& Parameters)
+{
+	// Multiply-add
+	{
+		TestEqual(TEXT("Predefined multiply-add 1"), URealFloatMath::MultiplyAdd(2_fl, 3_fl, 4_fl), 10_fl);
+		TestEqual(TEXT("Predefined multiply-add 2"), URealFloatMath::MultiplyAdd(FRealFloat(-2.5), 4_fl, 10_fl), 0_fl);
+		TestEqual(TEXT("Predefined multiply-add 3"), URealFloatMath::MultiplyAdd(0_fl, 3_fl, FRealFloat(-4.5)), FRealFloat(-4.5));
+	}
+
+	// Sums of products
+	{
+		TestEqual(TEXT("Predefined sum of products 1"), URealFloatMath::SumOfProducts(1_fl, 2_fl, 3_fl, 4_fl), 14_fl);
+		TestEqual(TEXT("Predefined sum of products 2"), URealFloatMath::SumOfProducts(1_fl, 2_fl, 3_fl, 4_fl, 5_fl, FRealFloat(-6)), FRealFloat(-16));
+		TestEqual(TEXT("Predefined sum of products 3"), URealFloatMath::SumOfProducts(1_fl, 2_fl, 3_fl, 4_fl, 5_fl, 6_fl, 7_fl, 8_fl), 100_fl);
+		TestEqual(TEXT("Predefined sum of products 4"), URealFloatMath::SumOfProducts(2_fl, 3_fl, FRealFloat(-3), 2_fl), 0_fl);
+		TestEqual(TEXT("Predefined sum of products 5"), URealFloatMath::SumOfProducts(0_fl, 2_fl, 0_fl, 4_fl, 0_fl, 6_fl), 0_fl);
+	}
+
+#if !USE_BOOST_BIG && !USE_MULTI_DOUBLE_BIG && !USE_FLOAT128_STORAGE
+	// With ttmath storage, products are exact and only the sum is rounded
+	{
+		const FRealFloat Big = 1e30_fl;
+		TestEqual(TEXT("Predefined exact cancellation"), URealFloatMath::SumOfProducts(Big, Big, 1_fl, 1_fl, -Big, Big), 1_fl);
+
+		const FRealFloat Third = 1_fl / 3_fl;
+		const FRealFloat ThirdError = URealFloatMath::MultiplyAdd(Third, 3_fl, FRealFloat(-1));
+		TestTrue(TEXT("Predefined rounding error is kept"), ThirdError != 0_fl);
+		TestTrue(TEXT("Predefined rounding error is small"), URealFloatMath::Abs(ThirdError) < 1e-37_fl);
+	}
+#endif
+
+	return true;
+}
+
+#pragma optimize("", on)
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionFloatLimitsTest, "SpaceKitPrecision.FloatingPointMath.Limits", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
 
 #pragma optimize("", off)
@@ -432,4 +601,147 @@ bool FSpacePrecisionFloatLimitsTest::RunTest(const FString& Parameters)
 
 #pragma optimize("", on)
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionFloatReciprocalTest, "SpaceKitPrecision.FloatingPointMath.Reciprocal", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpacePrecisionFloatReciprocalTest::RunTest(const FString& Parameters)
+{
+	const FRealFloat Dividends[] = { 1_fl, -7_fl, 0.1_fl, 123456.789_fl, 1e30_fl, -1e-30_fl };
+	const FRealFloat Divisors[] = { 2_fl, -3_fl, 7.3_fl, 0.001_fl, 5.972e24_fl, -1e-20_fl };
+
+	// Dividing by a reciprocal only differs from dividing by the number in the last bit
+	for (const FRealFloat& Divisor : Divisors)
+	{
+		const FRealFloatReciprocal Reciprocal(Divisor);
+		TestEqual(TEXT("Predefined reciprocal divisor"), Reciprocal.GetDivisor(), Divisor);
+		for (const FRealFloat& Dividend : Dividends)
+		{
+			const FRealFloat Quotient = Dividend / Divisor;
+			TestTrue(FString::Printf(TEXT("Predefined reciprocal %s / %s"), *Dividend.ToString(), *Divisor.ToString()),
+				URealFloatMath::Abs(Dividend / Reciprocal - Quotient) <= URealFloatMath::Abs(Quotient) * 1e-30_fl);
+		}
+	}
+
+	// Powers of two have exact inverses
+	TestEqual(TEXT("Predefined reciprocal exact"), 3_fl / FRealFloatReciprocal(0.25_fl), 12_fl);
+
+	// Conversions to degrees divide by DegToRad's reciprocal
+	TestEqual(TEXT("Predefined reciprocal atan deg"), URealFloatMath::AtanDeg(1_fl).ToDouble(), 45.0, 1e-12);
+	TestEqual(TEXT("Predefined reciprocal asin deg"), URealFloatMath::AsinDeg(0.5_fl).ToDouble(), 30.0, 1e-12);
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+// Initialized dynamically, maybe before RealFloat.cpp's own static initializers: this only works if the constants are constant-initialized
+static const FRealFloat StaticHalfTurn = FRealFloat::DegToRad * 180_fl;
+static const FRealFloat StaticQuarterTurn = FRealFloat::HalfPi;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionFloatConstantsTest, "SpaceKitPrecision.FloatingPointMath.Constants", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpacePrecisionFloatConstantsTest::RunTest(const FString& Parameters)
+{
+	const FRealFloat Tolerance = 1e-30_fl;
+	const FRealFloat ParsedPi("3.14159265358979323846264338327950288419716939937510582097494459");
+
+	// The constants are right to the last bits
+	TestTrue(TEXT("Predefined pi"), URealFloatMath::Abs(FRealFloat::Pi - ParsedPi) < Tolerance);
+	TestTrue(TEXT("Predefined half pi"), URealFloatMath::Abs(FRealFloat::HalfPi * 2_fl - ParsedPi) < Tolerance);
+	TestTrue(TEXT("Predefined deg to rad"), URealFloatMath::Abs(FRealFloat::DegToRad * 180_fl - ParsedPi) < Tolerance);
+	TestEqual(TEXT("Predefined pi to double"), FRealFloat::Pi.ToDouble(), DOUBLE_PI, 0.0);
+
+	// Static initializers in other translation units can use them
+	TestTrue(TEXT("Predefined static init 1"), URealFloatMath::Abs(StaticHalfTurn - ParsedPi) < Tolerance);
+	TestEqual(TEXT("Predefined static init 2"), StaticQuarterTurn, FRealFloat::HalfPi);
+
+	// Literals have the value of their string, every time their expression runs
+	TestEqual(TEXT("Predefined literal 1"), 2.5_fl, FRealFloat("2.5"));
+	TestEqual(TEXT("Predefined literal 2"), 1e50_fl, FRealFloat("1e50"));
+	TestEqual(TEXT("Predefined literal 3"), 0.1_fl, FRealFloat("0.1"));
+	for (int32 Index = 0; Index < 3; Index++)
+	{
+		TestEqual(TEXT("Predefined literal 4"), 0.9995_fl * FRealFloat(Index), FRealFloat("0.9995") * FRealFloat(Index));
+	}
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionFloatStringsTest, "SpaceKitPrecision.FloatingPointMath.Strings", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpacePrecisionFloatStringsTest::RunTest(const FString& Parameters)
+{
+#if !USE_BOOST_BIG && !USE_MULTI_DOUBLE_BIG && !USE_FLOAT128_STORAGE
+	// ttmath numbers are written with the fewest digits that parse back to them
+	TestEqual(TEXT("Predefined to string 1"), (0.1_fl).ToString(), FString(TEXT("0.1")));
+	TestEqual(TEXT("Predefined to string 2"), (-2.5_fl).ToString(), FString(TEXT("-2.5")));
+	TestEqual(TEXT("Predefined to string 3"), (1e16_fl).ToString(), FString(TEXT("1e+16")));
+	TestEqual(TEXT("Predefined to string 4"), (1.5e-20_fl).ToString(), FString(TEXT("1.5e-20")));
+
+	// The numbers written exactly, up to binary exponents of +-1000 (1/3 has a full mantissa and the exponent -TT_REAL_FLOAT_SIZE - 1), are read back exactly too
+	const auto ScaleByPow2 = [](FRealFloat x, int32 Power)
+	{
+		for (; Power > 0; Power--)
+		{
+			x *= 2_fl;
+		}
+		for (; Power < 0; Power++)
+		{
+			x /= 2_fl;
+		}
+		return x;
+	};
+	const FRealFloat Third = 1_fl / 3_fl;
+	const FRealFloat EdgeValues[] = {
+		ScaleByPow2(Third, TT_REAL_FLOAT_SIZE + 1001), -ScaleByPow2(Third, TT_REAL_FLOAT_SIZE + 1000), ScaleByPow2(Third, TT_REAL_FLOAT_SIZE - 949),
+		ScaleByPow2(Third, TT_REAL_FLOAT_SIZE - 999), FRealFloat("9.5627297936210551951974629563209770197e+338"), FRealFloat("1.28164519179950654346601650428805289982e+339")
+	};
+	for (const FRealFloat& Value : EdgeValues)
+	{
+		TestEqual(FString::Printf(TEXT("Predefined round trip at the edges %s"), *Value.ToString()), FRealFloat(Value.ToString()), Value);
+	}
+#endif
+
+	TCHAR Buffer[FRealFloat::StringBufferSize];
+	const FRealFloat Values[] = { 0_fl, 1_fl / 3_fl, -FRealFloat::Pi, 6.02214076e23_fl, -1.616255e-35_fl, 9.4607304725808e15_fl };
+	for (const FRealFloat& Value : Values)
+	{
+		const int32 Length = Value.ToChars(Buffer);
+		const TCHAR* Cursor = Buffer;
+		FRealFloat Parsed;
+		TestTrue(TEXT("Predefined parse"), Parsed.InitFromChars(Cursor));
+		TestEqual(TEXT("Predefined parse end"), int32(Cursor - Buffer), Length);
+		TestEqual(TEXT("Predefined round trip"), Parsed, Value);
+	}
+
+	// Parsing stops after the number, and fails without moving if there is none
+	const TCHAR* Text = TEXT(" -2.5e1)");
+	FRealFloat Parsed;
+	TestTrue(TEXT("Predefined parse partial 1"), Parsed.InitFromChars(Text));
+	TestEqual(TEXT("Predefined parse partial 2"), Parsed, -25_fl);
+	TestEqual(TEXT("Predefined parse partial 3"), *Text, TEXT(')'));
+	TestFalse(TEXT("Predefined parse failure 1"), Parsed.InitFromChars(Text));
+	TestEqual(TEXT("Predefined parse failure 2"), *Text, TEXT(')'));
+
+	// Text export and import
+	FString Exported;
+	(-12.75_fl).ExportTextItem(Exported, 0_fl, nullptr, 0, nullptr);
+	const TCHAR* Imported = *Exported;
+	TestTrue(TEXT("Predefined import 1"), Parsed.ImportTextItem(Imported, 0, nullptr, nullptr));
+	TestEqual(TEXT("Predefined import 2"), Parsed, -12.75_fl);
+	TestEqual(TEXT("Predefined import 3"), *Imported, TEXT('\0'));
+
+	return true;
+}
+
+#pragma optimize("", on)
+
 #endif //WITH_DEV_AUTOMATION_TESTS
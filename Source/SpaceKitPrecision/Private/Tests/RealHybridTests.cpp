@@ -0,0 +1,220 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "Core/Public/CoreTypes.h"
+#include "Core/Public/Containers/UnrealString.h"
+#include "Core/Public/Misc/AutomationTest.h"
+
+#include "SpaceKitPrecision/Public/RealHybrid.h"
+#include "SpaceKitPrecision/Public/VectorHybrid.h"
+#include "SpaceKitPrecision/Private/Tests/PrecisionTestHelpers.h"
+
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionHybridPromotionTest, "SpaceKitPrecision.FloatingPointMath.HybridPromotion", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpacePrecisionHybridPromotionTest::RunTest(const FString& Parameters)
+{
+	using HybridType = FRealHybrid::HybridType;
+
+	// Below the conversion error, inexact doubles are promoted, above it they stay doubles, see PrecisionSettings.h
+	const bool bExact = HybridType::MaxRelativeError < HybridType::ConversionError;
+
+	// Exact results stay doubles
+	TestFalse(TEXT("Predefined exact addition"), (FRealHybrid(1.5) + FRealHybrid(2.25)).IsBig());
+	TestFalse(TEXT("Predefined exact substraction"), (FRealHybrid(1e20) - FRealHybrid(1e20)).IsBig());
+	TestFalse(TEXT("Predefined exact multiplication"), (FRealHybrid(500.0) * FRealHybrid(0.125)).IsBig());
+	TestFalse(TEXT("Predefined exact division"), (FRealHybrid(3.0) / FRealHybrid(4.0)).IsBig());
+	TestEqual(TEXT("Predefined exact value"), (FRealHybrid(3.0) / FRealHybrid(4.0)).ToDouble(), 0.75);
+
+	// Inexact ones are promoted, and are the FRealFloat results, or stay the double results
+	const FRealHybrid Sum = FRealHybrid(0.1) + FRealHybrid(0.2);
+	TestEqual(TEXT("Predefined inexact addition"), Sum.IsBig(), bExact);
+	TestTrue(TEXT("Predefined inexact addition value"), bExact ? FRealFloat(Sum) == FRealFloat(0.1) + FRealFloat(0.2) : Sum.ToDouble() == 0.1 + 0.2);
+	TestEqual(TEXT("Predefined absorbed addition"), (FRealHybrid(1e20) + FRealHybrid(1.0)).IsBig(), bExact);
+	// 1e16 + 1 is past a double's mantissa: the unit is only kept by the promoted sum
+	const FRealHybrid PastMantissa = FRealHybrid(1e16) + FRealHybrid(1.0);
+	TestEqual(TEXT("Predefined sum past the mantissa"), PastMantissa.IsBig(), bExact);
+	TestTrue(TEXT("Predefined sum past the mantissa value"), PastMantissa - FRealHybrid(1e16) == FRealHybrid(bExact ? 1.0 : 0.0));
+	TestEqual(TEXT("Predefined inexact division"), (FRealHybrid(1.0) / FRealHybrid(3.0)).IsBig(), bExact);
+	TestEqual(TEXT("Predefined inexact square"), (FRealHybrid(0.1) * FRealHybrid(0.1)).IsBig(), bExact);
+
+	// Out of the range of doubles, whatever the tolerance. Multi-doubles have the same range, so they overflow too
+	const FRealHybrid Huge = FRealHybrid(1e300) * FRealHybrid(1e300);
+	TestTrue(TEXT("Predefined overflow"), Huge.IsBig());
+	if (FRealFloat(1e300) * FRealFloat(1e300) > FRealFloat(1e300))
+	{
+		TestTrue(TEXT("Predefined overflow value"), FRealFloat(Huge) == FRealFloat(1e300) * FRealFloat(1e300));
+	}
+	TestTrue(TEXT("Predefined underflow"), (FRealHybrid(1e-300) * FRealHybrid(1e-300)).IsBig());
+	TestTrue(TEXT("Predefined subnormal product"), (FRealHybrid(1e-160) * FRealHybrid(1e-160)).IsBig());
+
+	// Big results that fit in a double are demoted, like a velocity that was promoted and comes back to rest. Only big types with a wider range than doubles have tiny values
+	const FRealHybrid Tiny = FRealHybrid(1e-200) * FRealHybrid(1e-200);
+	if (FRealFloat(1e-200) * FRealFloat(1e-200) > FRealFloat(0.0))
+	{
+		TestTrue(TEXT("Predefined tiny"), Tiny.IsBig());
+		TestTrue(TEXT("Predefined tiny comparison"), Tiny < FRealHybrid(1e-300) && Tiny > FRealHybrid(0.0));
+		TestFalse(TEXT("Predefined demoted result"), (Tiny - Tiny).IsBig());
+		FRealHybrid Accumulator = Tiny;
+		Accumulator *= FRealHybrid(2.0);
+		TestTrue(TEXT("Predefined compound operators"), Accumulator.IsBig());
+		Accumulator += FRealHybrid(1.5);
+		TestFalse(TEXT("Predefined demoted compound operators"), Accumulator.IsBig());
+		TestEqual(TEXT("Predefined demoted value"), Accumulator.ToDouble(), 1.5);
+	}
+
+	// At the limits of the fast path: the largest double, exact products on both sides of MinExactProduct, and an exact subnormal quotient
+	TestFalse(TEXT("Predefined largest double"), (FRealHybrid(MAX_dbl) * FRealHybrid(1.0)).IsBig());
+	TestTrue(TEXT("Predefined largest double overflow"), (FRealHybrid(MAX_dbl) + FRealHybrid(MAX_dbl)).IsBig());
+	const FRealHybrid AboveMinExactProduct = FRealHybrid(std::ldexp(1.0, -484)) * FRealHybrid(std::ldexp(1.0, -484));
+	TestTrue(TEXT("Predefined product above MinExactProduct"), !AboveMinExactProduct.IsBig() && AboveMinExactProduct.ToDouble() == std::ldexp(1.0, -968));
+	const FRealHybrid BelowMinExactProduct = FRealHybrid(std::ldexp(1.0, -485)) * FRealHybrid(std::ldexp(1.0, -485));
+	TestTrue(TEXT("Predefined product below MinExactProduct"), !BelowMinExactProduct.IsBig() && BelowMinExactProduct.ToDouble() == std::ldexp(1.0, -970));
+	const FRealHybrid Subnormal = FRealHybrid(MIN_dbl) / FRealHybrid(2.0);
+	TestTrue(TEXT("Predefined exact subnormal"), !Subnormal.IsBig() && Subnormal.ToDouble() == std::ldexp(1.0, -1023));
+
+	// FRealFloat values are demoted when a double is within the tolerance of them
+	FRealHybrid Mass;
+	Mass = 500.0_fl;
+	TestFalse(TEXT("Predefined demotion"), Mass.IsBig());
+	Mass = 0.1_fl;
+	TestEqual(TEXT("Predefined inexact demotion"), Mass.IsBig(), bExact);
+	TestTrue(TEXT("Predefined conversion"), bExact ? FRealFloat(Mass) == 0.1_fl : Mass.ToDouble() == (0.1_fl).ToDouble());
+
+	// Comparisons across representations
+	TestTrue(TEXT("Predefined comparison 1"), FRealHybrid(0.5) < FRealHybrid(1.0) / FRealHybrid(1.5));
+	TestTrue(TEXT("Predefined comparison 2"), FRealHybrid(1.0) / FRealHybrid(3.0) > FRealHybrid(0.3));
+	TestTrue(TEXT("Predefined comparison 3"), FRealHybrid(0.75_fl) == FRealHybrid(0.75));
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionHybridPrecisionTest, "SpaceKitPrecision.FloatingPointMath.HybridPrecision", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpacePrecisionHybridPrecisionTest::RunTest(const FString& Parameters)
+{
+	using HybridType = FRealHybrid::HybridType;
+	const bool bExact = HybridType::MaxRelativeError < HybridType::ConversionError;
+
+	// Small integers and binary fractions, whose results are often exact, and random doubles, whose results seldom are
+	FRandomStream Random(42);
+	const auto RandomValue = [&]()
+	{
+		const double Value = SpaceKitPrecisionTest::RandomDouble(Random, -10, 10);
+		return Random.GetFraction() < 0.5 ? FMath::FloorToDouble(Value * 16) / 16 : Value;
+	};
+
+	int32 NumSmall = 0;
+	int32 NumChecks = 0;
+	for (int32 Index = 0; Index < 1024; Index++)
+	{
+		const double x = RandomValue();
+		const double y = RandomValue();
+
+		// Without a tolerance, results are exactly FRealFloat's. With one, each rounding stays within it
+		const auto Check = [&](const TCHAR* Operation, const FRealHybrid& Value, const FRealFloat& Expected, int32 NumRoundings = 1)
+		{
+			NumSmall += Value.IsBig() ? 0 : 1;
+			NumChecks++;
+			const bool bAccurate = bExact
+				? FRealFloat(Value) == Expected
+				: FMath::Abs((FRealFloat(Value) - Expected).ToDouble()) <= NumRoundings * HybridType::MaxRelativeError * FMath::Abs(Expected.ToDouble());
+			if (!bAccurate)
+			{
+				AddError(FString::Printf(TEXT("%s of %.17g and %.17g: %s instead of %s"), Operation, x, y, *Value.ToString(), *Expected.ToString()));
+			}
+		};
+
+		Check(TEXT("Addition"), FRealHybrid(x) + FRealHybrid(y), FRealFloat(x) + FRealFloat(y));
+		Check(TEXT("Substraction"), FRealHybrid(x) - FRealHybrid(y), FRealFloat(x) - FRealFloat(y));
+		Check(TEXT("Multiplication"), FRealHybrid(x) * FRealHybrid(y), FRealFloat(x) * FRealFloat(y));
+		if (y != 0)
+		{
+			Check(TEXT("Division"), FRealHybrid(x) / FRealHybrid(y), FRealFloat(x) / FRealFloat(y));
+		}
+
+		FRealHybrid Accumulator(x);
+		Accumulator += FRealHybrid(y);
+		Accumulator *= FRealHybrid(y);
+		Check(TEXT("Compound operators"), Accumulator, (FRealFloat(x) + FRealFloat(y)) * FRealFloat(y), 2);
+	}
+
+	// Else the test doesn't cover the fast path. With a tolerance, these values never leave the range of doubles
+	TestTrue(TEXT("Some results stay doubles"), bExact ? NumSmall > 1024 : NumSmall == NumChecks);
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpacePrecisionHybridConversionsTest, "SpaceKitPrecision.FloatingPointMath.HybridConversions", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+
+#pragma optimize("", off)
+
+bool FSpacePrecisionHybridConversionsTest::RunTest(const FString& Parameters)
+{
+	// Text is FRealFloat's, whatever the representation
+	for (const FRealHybrid& Value : { FRealHybrid(-2.5), FRealHybrid(0.1_fl), FRealHybrid(1e50_fl) })
+	{
+		FString Text;
+		Value.ExportTextItem(Text, FRealHybrid(), nullptr, 0, nullptr);
+
+		FString FloatText;
+		FRealFloat(Value).ExportTextItem(FloatText, FRealFloat(), nullptr, 0, nullptr);
+		TestEqual(TEXT("Predefined export"), Text, FloatText);
+
+		FRealHybrid Imported;
+		const TCHAR* Buffer = *Text;
+		TestTrue(TEXT("Predefined import"), Imported.ImportTextItem(Buffer, 0, nullptr, nullptr));
+		TestTrue(TEXT("Predefined import value"), Imported == Value);
+		TestEqual(TEXT("Predefined import representation"), Imported.IsBig(), Value.IsBig());
+	}
+
+	// Only the active member is stored, over zeroed bytes: equal numbers have equal bytes, which UE4 serializes and compares with the defaults
+	{
+		uint8 Dirty[sizeof(FRealHybrid)];
+		FMemory::Memset(Dirty, 0xAB, sizeof(Dirty));
+		const FRealHybrid* const Small = new (Dirty) FRealHybrid(1.5);
+		const FRealHybrid Clean(1.5);
+		TestEqual(TEXT("Predefined bytes of a double"), FMemory::Memcmp(Small, &Clean, sizeof(FRealHybrid)), 0);
+
+		FRealHybrid Demoted(0.1_fl);
+		Demoted -= FRealHybrid(0.1_fl);
+		const FRealHybrid Zero;
+		TestEqual(TEXT("Predefined bytes of a demoted number"), FMemory::Memcmp(&Demoted, &Zero, sizeof(FRealHybrid)), 0);
+	}
+
+	// Vectors convert from and to FVectorFloat, component by component
+	FVectorHybrid Velocity;
+	Velocity = FVectorFloat(1.0, 0.5, -4.0);
+	TestFalse(TEXT("Predefined vector demotion"), Velocity.IsBig());
+	Velocity += FVectorHybrid(0.25, 0.25, 0.25) * FRealHybrid(2.0);
+	TestFalse(TEXT("Predefined vector exact math"), Velocity.IsBig());
+	TestTrue(TEXT("Predefined vector value"), Velocity == FVectorHybrid(1.5, 1.0, -3.5));
+	Velocity *= FRealHybrid(1e300);
+	Velocity *= FRealHybrid(1e300);
+	TestTrue(TEXT("Predefined vector promotion"), Velocity.X.IsBig() && Velocity.Y.IsBig() && Velocity.Z.IsBig());
+	const FVectorFloat Converted = Velocity;
+	TestTrue(TEXT("Predefined vector conversion"), Converted.Y == FRealFloat(1e300) * FRealFloat(1e300));
+
+	// Back in the range of doubles, for big types that can leave it
+	if (Converted.Y / FRealFloat(1e300) == FRealFloat(1e300))
+	{
+		Velocity /= FRealHybrid(1e300);
+		Velocity /= FRealHybrid(1e300);
+		TestTrue(TEXT("Predefined vector demotion of results"), !Velocity.IsBig() && Velocity.Y == FRealHybrid(1.0));
+	}
+
+	return true;
+}
+
+#pragma optimize("", on)
+
+#endif //WITH_DEV_AUTOMATION_TESTS
@@ -35,6 +35,8 @@ bool FCoreMathVectorFixedOperatorsTest::RunTest(const FString& Parameters)
 	TestEqual(TEXT("Predefined division 1"), x / y, FVectorFixed(3_fx, 4_fx, 5_fx));
 	TestEqual(TEXT("Predefined division 2"), x / (-y), FVectorFixed(-3_fx, -4_fx, -5_fx));
 	TestEqual(TEXT("Predefined division 3"), x / z, FVectorFixed(3_fx, 6_fx, 10_fx));
+	TestEqual(TEXT("Predefined division 4"), x / 7_fx, FVectorFixed(6_fx / 7_fx, 12_fx / 7_fx, 20_fx / 7_fx));
+	TestEqual(TEXT("Predefined division 5"), x / FRealFixedReciprocal(-0.3_fx), FVectorFixed(6_fx / -0.3_fx, 12_fx / -0.3_fx, 20_fx / -0.3_fx));
 
 	// Add assign
 	{
@@ -78,6 +80,15 @@ bool FCoreMathVectorFixedOperatorsTest::RunTest(const FString& Parameters)
 		TestEqual(TEXT("Predefined div assign real operator works"), a, FVectorFixed(3_fx, 6_fx, 10_fx));
 	}
 
+	// Chained and aliased assigns
+	{
+		FVectorFixed a = FVectorFixed(1_fx, 2_fx, 3_fx);
+		(a += a) *= 2_fx;
+		TestEqual(TEXT("Predefined chained assign operators work"), a, FVectorFixed(4_fx, 8_fx, 12_fx));
+		a -= a;
+		TestEqual(TEXT("Predefined aliased sub assign operator works"), a, FVectorFixed(0_fx, 0_fx, 0_fx));
+	}
+
 	TestEqual(TEXT("Predefined dot 1"), (FVectorFixed(4_fx, 5_fx, 12_fx) | FVectorFixed(16_fx, 4_fx, -7_fx)).ToFloat(), 0.f);
 	TestEqual(TEXT("Predefined dot 2"), (FVectorFixed(8_fx, -2_fx, 7_fx) | FVectorFixed(11_fx, 6_fx, -3_fx)).ToFloat(), 55.f);
 
@@ -89,6 +100,7 @@ bool FCoreMathVectorFixedOperatorsTest::RunTest(const FString& Parameters)
 	}
 
 	TestEqual(TEXT("Predefined size 1"), FVectorFixed(3_fx, 4_fx, 12_fx).Size().ToFloat(), 13.f);
+	TestEqual(TEXT("Predefined size 2"), FVectorFixed(1e22_fx, 0_fx, -1e22_fx).Size().ToDouble(), 1.4142135623730951e22, 1e7);
 	TestEqual(TEXT("Predefined size squared 1"), (FVectorFixed(3_fx, 4_fx, 12_fx).Size() * FVectorFixed(3_fx, 4_fx, 12_fx).Size()).ToFloat(), FVectorFixed(3_fx, 4_fx, 12_fx).SizeSquared().ToFloat());
 
 	{
@@ -102,6 +114,27 @@ bool FCoreMathVectorFixedOperatorsTest::RunTest(const FString& Parameters)
 	TestEqual(TEXT("Predefined axis 2"), x.GetAxis(EAxis::Y).ToFloat(), 12.f);
 	TestEqual(TEXT("Predefined axis 3"), x.GetAxis(EAxis::Z).ToFloat(), 20.f);
 
+	// Batch conversions give the same vectors as one by one
+	{
+		TArray<FVectorFixed> Vectors;
+		Vectors.Add(x);
+		Vectors.Add(FVectorFixed(-1e12_fx, 0.5_fx, 3_fx));
+		TArray<FVector> Converted;
+		FVectorFixed::ToFVectors(Vectors, Converted);
+		TestEqual(TEXT("Predefined batch conversion 1"), Converted.Num(), 2);
+		TestEqual(TEXT("Predefined batch conversion 2"), Converted[0], x.ToFVector());
+		TestEqual(TEXT("Predefined batch conversion 3"), Converted[1], FVector(-1e12f, 0.5f, 3.f));
+	}
+
+	// Far from the origin, where floats would have lost the offsets
+	{
+		const FVectorFixed From(1e18_fx, -1e18_fx, 1e15_fx);
+		TestEqual(TEXT("Predefined bearing 1"), UVectorFixedMath::BearingRad(From, From + FVectorFixed(-1_fx, 1_fx, 0_fx)).ToDouble(), 3 * DOUBLE_PI / 4, 1e-7);
+		TestEqual(TEXT("Predefined bearing 2"), UVectorFixedMath::BearingRad(From, From + FVectorFixed(0_fx, -2_fx, 5_fx)).ToDouble(), -DOUBLE_PI / 2, 1e-7);
+		TestEqual(TEXT("Predefined elevation 1"), UVectorFixedMath::ElevationRad(From, From + FVectorFixed(3_fx, 4_fx, 5_fx)).ToDouble(), DOUBLE_PI / 4, 1e-7);
+		TestEqual(TEXT("Predefined elevation 2"), UVectorFixedMath::ElevationRad(From, From + FVectorFixed(0_fx, 0_fx, -1_fx)).ToDouble(), -DOUBLE_PI / 2, 1e-7);
+	}
+
 	return true;
 }
 
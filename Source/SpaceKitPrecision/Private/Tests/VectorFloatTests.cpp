@@ -78,6 +78,15 @@ bool FCoreMathVectorFloatOperatorsTest::RunTest(const FString& Parameters)
 		TestEqual(TEXT("Predefined div assign real operator works"), a, FVectorFloat(3_fl, 6_fl, 10_fl));
 	}
 
+	// Chained and aliased assigns
+	{
+		FVectorFloat a = FVectorFloat(1_fl, 2_fl, 3_fl);
+		(a += a) *= 2_fl;
+		TestEqual(TEXT("Predefined chained assign operators work"), a, FVectorFloat(4_fl, 8_fl, 12_fl));
+		a -= a;
+		TestEqual(TEXT("Predefined aliased sub assign operator works"), a, FVectorFloat(0_fl, 0_fl, 0_fl));
+	}
+
 	TestEqual(TEXT("Predefined dot 1"), (FVectorFloat(4_fl, 5_fl, 12_fl) | FVectorFloat(16_fl, 4_fl, FRealFloat(-7.0))).ToFloat(), 0.f);
 	TestEqual(TEXT("Predefined dot 2"), (FVectorFloat(8_fl, FRealFloat(-2.0), 7_fl) | FVectorFloat(11_fl, 6_fl, FRealFloat(-3.0))).ToFloat(), 55.f);
 
@@ -96,6 +105,8 @@ bool FCoreMathVectorFloatOperatorsTest::RunTest(const FString& Parameters)
 		TestEqual(TEXT("Predefined normal 1"), Normal.Size().ToFloat(), 1.f);
 		TestEqual(TEXT("Predefined normal 2"), (Normal | x).ToFloat(), x.Size().ToFloat());
 		TestEqual(TEXT("Predefined normal 3"), (Normal ^ x).Size().ToFloat(), 0.f);
+		TestTrue(TEXT("Predefined normal 4"), URealFloatMath::RealEqualsReal(Normal.SizeSquared(), 1_fl, 1e-30_fl));
+		TestEqual(TEXT("Predefined normal 5"), FVectorFloat(0_fl, 0_fl, 0_fl).GetNormal(), FVectorFloat::Identity);
 	}
 
 	TestEqual(TEXT("Predefined axis 1"), x.GetAxis(EAxis::X).ToFloat(), 6.f);
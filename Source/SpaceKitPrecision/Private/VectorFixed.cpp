@@ -81,3 +81,16 @@ FVectorFixed UVectorFixedMath::ProjectOnTo(const FVectorFixed& B, const FVectorF
 {
 	return (B * ((A | B) / (B | B)));
 }
+
+FRealFixed UVectorFixedMath::BearingRad(const FVectorFixed& From, const FVectorFixed& To)
+{
+	const FVectorFixed Direction = To - From;
+	return URealFixedMath::Atan2Rad(Direction.Y, Direction.X);
+}
+
+FRealFixed UVectorFixedMath::ElevationRad(const FVectorFixed& From, const FVectorFixed& To)
+{
+	const FVectorFixed Direction = To - From;
+	const FRealFixed HorizontalSize = URealFixedMath::Hypot(Direction.X, Direction.Y, FRealFixed());
+	return URealFixedMath::Atan2Rad(Direction.Z, HorizontalSize);
+}
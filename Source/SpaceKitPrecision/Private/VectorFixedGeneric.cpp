@@ -0,0 +1,5 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+// This file's only purpose is to include VectorFixedGeneric.h, so it's systematically included, and checked for errors. Otherwise, it might not be included anywhere.
+
+#include "SpaceKitPrecision/Public/VectorFixedGeneric.h"
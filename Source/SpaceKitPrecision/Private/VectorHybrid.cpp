@@ -0,0 +1,67 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#include "SpaceKitPrecision/Public/VectorHybrid.h"
+
+#include "CoreUObject/Public/UObject/PropertyTag.h"
+
+FVectorHybrid FVectorHybrid::Identity = FVectorHybrid();
+
+bool FVectorHybrid::SerializeFromMismatchedTag(const FPropertyTag& Tag, FStructuredArchive::FSlot Slot)
+{
+	static const FName VectorFloatName(TEXT("VectorFloat"));
+	if (Tag.Type == NAME_StructProperty && Tag.StructName == VectorFloatName)
+	{
+		FVectorFloat Value;
+		FVectorFloat::StaticStruct()->SerializeItem(Slot, &Value, nullptr);
+		*this = Value;
+		return true;
+	}
+	return false;
+}
+
+FVectorFloat UVectorHybridMath::ConvVectorHybridToVectorFloat(const FVectorHybrid& InVec)
+{
+	return InVec;
+}
+
+FVectorHybrid UVectorHybridMath::ConvVectorFloatToVectorHybrid(const FVectorFloat& InVec)
+{
+	return FVectorHybrid(InVec);
+}
+
+FVector UVectorHybridMath::ConvVectorHybridToFVector(const FVectorHybrid& InVec)
+{
+	return InVec.ToFVector();
+}
+
+FVectorHybrid UVectorHybridMath::MakeVectorHybrid(const FRealHybrid& X, const FRealHybrid& Y, const FRealHybrid& Z)
+{
+	return FVectorHybrid(X, Y, Z);
+}
+
+void UVectorHybridMath::BreakVectorHybrid(const FVectorHybrid& Vec, FRealHybrid& X, FRealHybrid& Y, FRealHybrid& Z)
+{
+	X = Vec.X;
+	Y = Vec.Y;
+	Z = Vec.Z;
+}
+
+FVectorHybrid UVectorHybridMath::VecPlusVec(const FVectorHybrid& First, const FVectorHybrid& Second)
+{
+	return First + Second;
+}
+
+FVectorHybrid UVectorHybridMath::VecMinusVec(const FVectorHybrid& First, const FVectorHybrid& Second)
+{
+	return First - Second;
+}
+
+FVectorHybrid UVectorHybridMath::VecMultReal(const FVectorHybrid& First, const FRealHybrid& Second)
+{
+	return First * Second;
+}
+
+FVectorHybrid UVectorHybridMath::VecDivReal(const FVectorHybrid& First, const FRealHybrid& Second)
+{
+	return First / Second;
+}
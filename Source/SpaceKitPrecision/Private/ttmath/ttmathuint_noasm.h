@@ -48,6 +48,10 @@
 	this file is included at the end of ttmathuint.h
 */
 
+#if defined(TTMATH_NOASM_NATIVE_WORDS) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 
 namespace ttmath
 {
@@ -689,6 +693,21 @@ namespace ttmath
 		*result_high = res.u_.high;
 		*result_low  = res.u_.low;
 
+	#elif defined(TTMATH_NOASM_NATIVE_WORDS) && defined(__SIZEOF_INT128__)
+
+		// SpaceKit: the compiler has a native 128 bits type
+		const unsigned __int128 res = (unsigned __int128)a * b;
+
+		*result_high = uint(res >> 64);
+		*result_low  = uint(res);
+
+	#elif defined(TTMATH_NOASM_NATIVE_WORDS) && defined(_MSC_VER)
+
+		// SpaceKit: MSVC x64 intrinsic
+		unsigned __int64 res_high;
+		*result_low  = _umul128(a, b, &res_high);
+		*result_high = res_high;
+
 	#else
 
 		/*
@@ -797,6 +816,21 @@ namespace ttmath
 		*r    = uint(ab.u / c);
 		*rest = uint(ab.u % c);
 
+	#elif defined(TTMATH_NOASM_NATIVE_WORDS) && defined(__SIZEOF_INT128__)
+
+		// SpaceKit: the compiler has a native 128 bits type
+		const unsigned __int128 ab = ((unsigned __int128)a << 64) | b;
+
+		*r    = uint(ab / c);
+		*rest = uint(ab % c);
+
+	#elif defined(TTMATH_NOASM_NATIVE_WORDS) && defined(_MSC_VER) && _MSC_VER >= 1920
+
+		// SpaceKit: MSVC x64 intrinsic, available since Visual Studio 2019
+		unsigned __int64 remainder;
+		*r    = _udiv128(a, b, c, &remainder);
+		*rest = remainder;
+
 	#else
 
 		uint_ c_;
@@ -0,0 +1,788 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/TtmathConfig.h"
+
+#include "Core/Public/HAL/Platform.h"
+#include "CoreMinimal.h"
+
+
+// Conversions between numbers and their base 10 representations, that work on caller-provided character buffers instead of strings.
+// Numbers are written with the fewest digits that parse back to the same number, and parsing reads the characters in a single pass.
+// They are templated on the character type, so the same code reads TCHAR buffers and the char literals of _fl and _fx.
+namespace DecimalConversion
+{
+	// Number of decimal digits that always fit in a word, and the powers of 10 that fit in a word
+	static constexpr int32 WordDigits = 19;
+
+	static constexpr uint64 PowersOf10[WordDigits + 1] =
+	{
+		1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+		10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull, 1000000000000000ull,
+		10000000000000000ull, 100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull,
+	};
+
+	// Decimal exponents and digits counts read from a string are clamped to this, so they can't overflow
+	static constexpr int32 MaxParsedExponent = 100000000;
+
+	// floor(Power * log10(2)), for |Power| <= 1650
+	constexpr int32 Log10Pow2(int32 Power)
+	{
+		return int32((int64(Power) * 78913) >> 18);
+	}
+
+	// Bits of 10^Power, floor(Power * log2(10)) + 1, for 0 <= Power <= 1650
+	constexpr int32 Pow10Bits(int32 Power)
+	{
+		return int32((int64(Power) * 1741647) >> 19) + 1;
+	}
+
+	// Multiplies x by 10^Power, a word at a time. Returns false if the result doesn't fit
+	template<ttmath::uint N>
+	bool MulPow10(ttmath::UInt<N>& x, int32 Power)
+	{
+		for (; Power > 0; Power -= WordDigits)
+		{
+			if (x.MulInt(PowersOf10[Power < WordDigits ? Power : WordDigits]) != 0)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Divides x by a constant below 2^32, rounded down, and returns the remainder.
+	// Each word is divided by halves, so that every step divides 64 bits by a constant, which compiles to a multiplication instead of a 128 bits division
+	template<uint64 Divisor, ttmath::uint N>
+	uint64 DivSmall(ttmath::UInt<N>& x)
+	{
+		static_assert(Divisor > 0 && Divisor < (uint64(1) << 32), "The divisor must fit in half a word");
+
+		int32 top = int32(N) - 1;
+		while (top > 0 && x.table[top] == 0)
+		{
+			top--;
+		}
+
+		uint64 remainder = 0;
+		for (int32 word = top; word >= 0; word--)
+		{
+			const uint64 high = (remainder << 32) | (uint64(x.table[word]) >> 32);
+			const uint64 low = ((high % Divisor) << 32) | (uint64(x.table[word]) & 0xFFFFFFFFull);
+			x.table[word] = ttmath::uint(((high / Divisor) << 32) | (low / Divisor));
+			remainder = low % Divisor;
+		}
+		return remainder;
+	}
+
+	// Number of decimal digits that DivSmall divides by at once
+	static constexpr int32 HalfWordDigits = 9;
+
+	// Divides x by 10^Power, for Power from 1 to HalfWordDigits, rounded down, and returns the remainder
+	template<ttmath::uint N>
+	uint64 DivSmallPow10(ttmath::UInt<N>& x, int32 Power)
+	{
+		switch (Power)
+		{
+		case 1: return DivSmall<PowersOf10[1]>(x);
+		case 2: return DivSmall<PowersOf10[2]>(x);
+		case 3: return DivSmall<PowersOf10[3]>(x);
+		case 4: return DivSmall<PowersOf10[4]>(x);
+		case 5: return DivSmall<PowersOf10[5]>(x);
+		case 6: return DivSmall<PowersOf10[6]>(x);
+		case 7: return DivSmall<PowersOf10[7]>(x);
+		case 8: return DivSmall<PowersOf10[8]>(x);
+		default: return DivSmall<PowersOf10[9]>(x);
+		}
+	}
+
+	// Divides x by 10^Power, rounded down, nine digits at a time. Returns whether the division is exact
+	template<ttmath::uint N>
+	bool DivPow10(ttmath::UInt<N>& x, int32 Power)
+	{
+		bool bExact = true;
+		for (; Power > 0; Power -= HalfWordDigits)
+		{
+			bExact = DivSmallPow10(x, Power < HalfWordDigits ? Power : HalfWordDigits) == 0 && bExact;
+		}
+		return bExact;
+	}
+
+	// Shifts x right, rounded down. Returns whether the shift is exact, i.e. no set bit was shifted out
+	template<ttmath::uint N>
+	bool ShiftRight(ttmath::UInt<N>& x, int32 Shift)
+	{
+		const int32 wordCount = Shift / 64 < int32(N) ? Shift / 64 : int32(N);
+		bool bExact = true;
+		for (int32 word = 0; word < wordCount; word++)
+		{
+			bExact = bExact && x.table[word] == 0;
+		}
+		if (wordCount < int32(N) && Shift % 64 != 0)
+		{
+			bExact = bExact && (x.table[wordCount] << (64 - Shift % 64)) == 0;
+		}
+		x.Rcr(ttmath::uint(Shift));
+		return bExact;
+	}
+
+	// Copies the lowest words of x to a narrower (or wider) integer. The caller guarantees the value fits
+	template<ttmath::uint To, ttmath::uint From>
+	ttmath::UInt<To> Resize(const ttmath::UInt<From>& x)
+	{
+		ttmath::UInt<To> result;
+		for (ttmath::uint word = 0; word < To; word++)
+		{
+			result.table[word] = word < From ? x.table[word] : 0;
+		}
+		return result;
+	}
+
+	// Writes the MinDigits lowest digits of x, or all of them if there are more. Returns the number of characters written
+	template<typename CharType>
+	int32 WriteWord(CharType* Buffer, uint64 x, int32 MinDigits)
+	{
+		CharType digits[WordDigits + 1];
+		int32 count = 0;
+		do
+		{
+			digits[count++] = CharType('0' + x % 10);
+			x /= 10;
+		}
+		while (x != 0 || count < MinDigits);
+
+		for (int32 index = 0; index < count; index++)
+		{
+			Buffer[index] = digits[count - 1 - index];
+		}
+		return count;
+	}
+
+	// Writes the digits of x, without leading zeros. Returns the number of characters written
+	template<typename CharType, ttmath::uint N>
+	int32 WriteInteger(CharType* Buffer, ttmath::UInt<N> x)
+	{
+		// Splits x in chunks of 9 digits, lowest first. 64 bits are less than 20 digits, so there are at most 3 chunks per word
+		uint64 chunks[3 * N];
+		int32 chunkCount = 0;
+		do
+		{
+			chunks[chunkCount++] = DivSmall<PowersOf10[HalfWordDigits]>(x);
+		}
+		while (!x.IsZero());
+
+		int32 length = WriteWord(Buffer, chunks[chunkCount - 1], 1);
+		for (int32 chunk = chunkCount - 2; chunk >= 0; chunk--)
+		{
+			length += WriteWord(Buffer + length, chunks[chunk], HalfWordDigits);
+		}
+		return length;
+	}
+
+	// Buffer sizes, in characters, including the null terminator
+	// A fixed point number is a sign, its integral digits, a point and its fraction digits (see WriteFixed)
+	constexpr int32 FixedBufferSize(int32 TotalBits, int32 FractionBits)
+	{
+		return 1 + ((TotalBits - FractionBits) * 30103) / 100000 + 2 + 1 + (FractionBits * 30103) / 100000 + 3 + 1;
+	}
+
+	// A floating-point number is a sign, its significant digits, at most 15 leading zeros and a point, and an exponent (see WriteFloat)
+	constexpr int32 FloatBufferSize(int32 MantissaBits)
+	{
+		return 1 + (MantissaBits * 30103) / 100000 + 4 + 17 + 24 + 1;
+	}
+
+	// Writes a fixed point number, Magnitude * 2^-FractionBits, as [-]integral.fraction, and returns the number of characters written.
+	// The fraction has the fewest digits that parse back to the same magnitude (with ParseFixed, which rounds to nearest, the halves away from zero),
+	// and at least one. Buffer must hold FixedBufferSize characters. It is null terminated.
+	template<int32 FractionBits, typename CharType, ttmath::uint N>
+	int32 WriteFixed(CharType* Buffer, ttmath::UInt<N> Magnitude, bool bNegative)
+	{
+		// The fraction and the margin are in units of 2^-(FractionBits + 1), so that half a quantum is 1.
+		// After each digit, the remainder (the value minus the digits so far) is below 10 units of the scale 2^(FractionBits + 1) (see below)
+		using FractionType = ttmath::UInt<TTMATH_BITS(FractionBits + 5)>;
+		const int32 scaleBits = FractionBits + 1;
+
+		FractionType remainder = Resize<TTMATH_BITS(FractionBits + 5)>(Magnitude);
+		remainder.Rcl(ttmath::uint(TTMATH_BITS(FractionBits + 5) * TTMATH_BITS_PER_UINT - FractionBits));
+		remainder.Rcr(ttmath::uint(TTMATH_BITS(FractionBits + 5) * TTMATH_BITS_PER_UINT - scaleBits));
+		Magnitude.Rcr(ttmath::uint(FractionBits));
+
+		FractionType margin;
+		margin.SetOne();
+		FractionType scale;
+		scale.SetZero();
+		scale.SetBit(ttmath::uint(scaleBits));
+
+		// Digits are generated until the digits so far, or the digits so far with the last one incremented, are within half a quantum of the value.
+		// That's at the latest when the margin reaches half the scale, so after at most ceil(FractionBits * log10(2)) + 1 digits
+		uint8 digits[(FractionBits * 30103) / 100000 + 3];
+		int32 digitCount = 0;
+		for (;;)
+		{
+			remainder.MulInt(10);
+			margin.MulInt(10);
+
+			FractionType digit(remainder);
+			digit.Rcr(ttmath::uint(scaleBits));
+			remainder.table[scaleBits / 64] &= (uint64(1) << (scaleBits % 64)) - 1;
+			for (int32 word = scaleBits / 64 + 1; word < int32(TTMATH_BITS(FractionBits + 5)); word++)
+			{
+				remainder.table[word] = 0;
+			}
+
+			// The digits so far are at most half a quantum below the value, which parses back to it as the halves round away from zero
+			const bool bLow = remainder <= margin;
+			// The digits so far, with the last one incremented, are less than half a quantum above the value
+			FractionType above(scale);
+			above.Sub(remainder);
+			const bool bHigh = above < margin;
+
+			if (!bLow && !bHigh)
+			{
+				digits[digitCount++] = uint8(digit.table[0]);
+				continue;
+			}
+
+			// When both parse back to the value, take the nearest one
+			FractionType twice(remainder);
+			twice.Rcl(1);
+			const bool bRoundUp = bHigh && (!bLow || twice >= scale);
+			digits[digitCount++] = uint8(digit.table[0] + (bRoundUp ? 1 : 0));
+			break;
+		}
+
+		// Propagates the carry of the last digit, to the integral part if needed
+		int32 carried = digitCount - 1;
+		while (carried > 0 && digits[carried] == 10)
+		{
+			digits[carried] = 0;
+			digits[--carried]++;
+		}
+		if (digits[0] == 10)
+		{
+			digits[0] = 0;
+			Magnitude.AddInt(1);
+		}
+		while (digitCount > 1 && digits[digitCount - 1] == 0)
+		{
+			digitCount--;
+		}
+
+		int32 length = 0;
+		if (bNegative)
+		{
+			Buffer[length++] = CharType('-');
+		}
+		length += WriteInteger(Buffer + length, Magnitude);
+		Buffer[length++] = CharType('.');
+		for (int32 index = 0; index < digitCount; index++)
+		{
+			Buffer[length++] = CharType('0' + digits[index]);
+		}
+		Buffer[length] = CharType('\0');
+		return length;
+	}
+
+	// A base 10 number, as read from a string: Digits * 10^Exponent. Only the first MaxDigits significant digits are kept, and bTruncated tells whether non-zero ones were dropped
+	template<ttmath::uint DigitWords>
+	struct TDecimal
+	{
+		static constexpr int32 MaxDigits = WordDigits * int32(DigitWords);
+
+		ttmath::UInt<DigitWords> Digits;
+		int32 DigitCount;
+		int32 Exponent;
+		bool bNegative;
+		bool bTruncated;
+	};
+
+	template<typename CharType>
+	bool IsDigit(CharType Char)
+	{
+		return Char >= CharType('0') && Char <= CharType('9');
+	}
+
+	// Reads a base 10 number at Buffer, in a single pass: optional whitespace, an optional sign, digits with an optional point, and an optional exponent.
+	// On success, moves Buffer just past the number. Returns false, leaving Buffer unchanged, if there is no number there
+	template<typename CharType, ttmath::uint DigitWords>
+	bool ParseDecimal(const CharType*& Buffer, TDecimal<DigitWords>& Out)
+	{
+		const CharType* cursor = Buffer;
+		while (*cursor == CharType(' ') || *cursor == CharType('\t') || *cursor == CharType('\r') || *cursor == CharType('\n'))
+		{
+			cursor++;
+		}
+
+		Out.Digits.SetZero();
+		Out.DigitCount = 0;
+		Out.Exponent = 0;
+		Out.bNegative = *cursor == CharType('-');
+		Out.bTruncated = false;
+		if (*cursor == CharType('-') || *cursor == CharType('+'))
+		{
+			cursor++;
+		}
+
+		// The digits are gathered in words of 19 digits, so the wide integer is only updated once per word
+		uint64 chunk = 0;
+		int32 chunkDigits = 0;
+		bool bAnyDigit = false;
+		bool bPoint = false;
+		for (;; cursor++)
+		{
+			if (IsDigit(*cursor))
+			{
+				const uint64 digit = uint64(*cursor - CharType('0'));
+				bAnyDigit = true;
+				if (Out.DigitCount == 0 && digit == 0)
+				{
+					// Leading zeros are not significant
+					Out.Exponent -= bPoint && Out.Exponent > -MaxParsedExponent ? 1 : 0;
+				}
+				else if (Out.DigitCount < Out.MaxDigits)
+				{
+					chunk = chunk * 10 + digit;
+					chunkDigits++;
+					Out.DigitCount++;
+					Out.Exponent -= bPoint ? 1 : 0;
+					if (chunkDigits == WordDigits)
+					{
+						Out.Digits.MulInt(PowersOf10[WordDigits]);
+						Out.Digits.AddInt(chunk);
+						chunk = 0;
+						chunkDigits = 0;
+					}
+				}
+				else
+				{
+					Out.bTruncated = Out.bTruncated || digit != 0;
+					Out.Exponent += !bPoint && Out.Exponent < MaxParsedExponent ? 1 : 0;
+				}
+			}
+			else if (*cursor == CharType('.') && !bPoint)
+			{
+				bPoint = true;
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		if (!bAnyDigit)
+		{
+			return false;
+		}
+		if (chunkDigits != 0)
+		{
+			Out.Digits.MulInt(PowersOf10[chunkDigits]);
+			Out.Digits.AddInt(chunk);
+		}
+
+		// The exponent is only read if there are digits after the 'e' and its sign
+		if (*cursor == CharType('e') || *cursor == CharType('E'))
+		{
+			const CharType* exponentCursor = cursor + 1;
+			const bool bNegativeExponent = *exponentCursor == CharType('-');
+			if (*exponentCursor == CharType('-') || *exponentCursor == CharType('+'))
+			{
+				exponentCursor++;
+			}
+			if (IsDigit(*exponentCursor))
+			{
+				int32 exponent = 0;
+				for (; IsDigit(*exponentCursor); exponentCursor++)
+				{
+					exponent = exponent < MaxParsedExponent ? exponent * 10 + int32(*exponentCursor - CharType('0')) : exponent;
+				}
+				Out.Exponent += bNegativeExponent ? -exponent : exponent;
+				cursor = exponentCursor;
+			}
+		}
+
+		Buffer = cursor;
+		return true;
+	}
+
+	// Converts a decimal to a fixed point magnitude, round(|Decimal| * 2^FractionBits), with the halves rounded away from zero.
+	// Returns false if it doesn't fit in a signed integer of N words, i.e. if it must saturate
+	template<int32 FractionBits, ttmath::uint N, ttmath::uint DigitWords>
+	bool DecimalToFixed(const TDecimal<DigitWords>& Decimal, ttmath::UInt<N>& OutMagnitude)
+	{
+		OutMagnitude.SetZero();
+		if (Decimal.DigitCount == 0)
+		{
+			return true;
+		}
+
+		// Significant digits beyond the integral digits of the largest value overflow, and beyond the fraction digits of half a quantum round to zero
+		const int32 integralDigits = ((int32(N) * 64 - 1 - FractionBits) * 30103) / 100000 + 1;
+		const int32 fractionDigits = (FractionBits * 30103) / 100000 + 1;
+		const int32 leadingPower = Decimal.DigitCount + Decimal.Exponent;
+		if (leadingPower > integralDigits)
+		{
+			return false;
+		}
+		if (leadingPower < -fractionDigits)
+		{
+			return true;
+		}
+
+		// Twice the magnitude, so its lowest bit is the rounding bit. This is wide enough for the digits, the fraction bits, and the divisor
+		using WideType = ttmath::UInt<DigitWords + N + TTMATH_BITS(FractionBits) + 1>;
+		WideType wide = Resize<DigitWords + N + TTMATH_BITS(FractionBits) + 1>(Decimal.Digits);
+		if (Decimal.Exponent >= 0)
+		{
+			MulPow10(wide, Decimal.Exponent);
+			wide.Rcl(ttmath::uint(FractionBits + 1));
+		}
+		else
+		{
+			wide.Rcl(ttmath::uint(FractionBits + 1));
+			DivPow10(wide, -Decimal.Exponent);
+		}
+		wide.AddInt(1);
+		wide.Rcr(1);
+
+		// The magnitude must stay below the sign bit
+		ttmath::uint tableId, index;
+		if (wide.FindLeadingBit(tableId, index) && int32(tableId * TTMATH_BITS_PER_UINT + index) >= int32(N) * 64 - 1)
+		{
+			return false;
+		}
+		OutMagnitude = Resize<N>(wide);
+		return true;
+	}
+
+	// Reads a base 10 number at Buffer, like ParseDecimal, and converts it to a fixed point magnitude and sign (see DecimalToFixed).
+	// Sets bOutSaturated if the number doesn't fit
+	template<int32 FractionBits, typename CharType, ttmath::uint N>
+	bool ParseFixed(const CharType*& Buffer, ttmath::UInt<N>& OutMagnitude, bool& bOutNegative, bool& bOutSaturated)
+	{
+		TDecimal<N + 1> decimal;
+		if (!ParseDecimal(Buffer, decimal))
+		{
+			return false;
+		}
+		bOutNegative = decimal.bNegative;
+		bOutSaturated = !DecimalToFixed<FractionBits>(decimal, OutMagnitude);
+		return true;
+	}
+
+	// Binary exponents of the numbers WriteFloat writes with integer arithmetic. They fit in the integers below, with FloatExtraWords more words than the mantissa.
+	// Numbers beyond are left to ttmath, which doesn't round them exactly
+	static constexpr ttmath::uint FloatExtraWords = 16;
+	// Most numbers are written with narrower integers, that hold binary exponents up to MaxNarrowBinaryExponent (values from about 2^-48 to 2^304 with 128 bits mantissas)
+	static constexpr ttmath::uint FloatNarrowWords = 3;
+	static constexpr int32 MaxNarrowBinaryExponent = 176;
+	static constexpr int32 MaxExactBinaryExponent = 1000;
+
+	// Decimal exponents of the numbers DecimalToFloat reads with integer arithmetic. They cover the numbers WriteFloat writes exactly, from 2^-MaxExactBinaryExponent
+	// to 2^(MaxExactBinaryExponent + ManSize * 64), with any count of digits up to MaxDigits, so those read back exactly (ParseFloat's MaxDigits exceed the digits of ManSize * 64 bits)
+	template<ttmath::uint DigitWords>
+	constexpr int32 MaxExactDecimalExponent()
+	{
+		return Log10Pow2(MaxExactBinaryExponent) + 1 + TDecimal<DigitWords>::MaxDigits;
+	}
+
+	// Scales x (4m) and its midpoints (4m + 2 and 4m - 2, or 4m - 1) by 2^BinaryExponent / 10^q, rounded down, and tells which ones are exact (see WriteFloat).
+	// The products have about ManSize * 64 + |BinaryExponent| + 10 bits, so they must fit in ExtraWords more words than the mantissa
+	template<ttmath::uint ExtraWords, ttmath::uint ManSize>
+	void ScaleMidpoints(const ttmath::UInt<ManSize>& Mantissa, bool bLowerGapHalved, int32 BinaryExponent, int32 q, ttmath::UInt<ManSize + 1> (&OutScaled)[3], bool (&bOutExact)[3])
+	{
+		using WideType = ttmath::UInt<ManSize + ExtraWords>;
+		WideType wideMantissa = Resize<ManSize + ExtraWords>(Mantissa);
+		wideMantissa.Rcl(2);
+		WideType wideValues[3] = { wideMantissa, wideMantissa, wideMantissa };
+		wideValues[1].AddInt(2);
+		wideValues[2].SubInt(bLowerGapHalved ? 1 : 2);
+
+		for (int32 value = 0; value < 3; value++)
+		{
+			if (BinaryExponent >= 0)
+			{
+				wideValues[value].Rcl(ttmath::uint(BinaryExponent));
+				MulPow10(wideValues[value], -q);
+				bOutExact[value] = DivPow10(wideValues[value], q);
+			}
+			else
+			{
+				MulPow10(wideValues[value], -q);
+				bOutExact[value] = ShiftRight(wideValues[value], -BinaryExponent);
+			}
+			OutScaled[value] = Resize<ManSize + 1>(wideValues[value]);
+		}
+	}
+
+	// Writes a ttmath float with the fewest significant digits that parse back to it (with ParseFloat, which rounds to nearest),
+	// in plain notation for decimal exponents from -15 to 15, and in scientific notation beyond, like ttmath does.
+	// Returns the number of characters written. Buffer must hold FloatBufferSize characters. It is null terminated.
+	// This is Ryu's algorithm (Ulf Adams, 2018), with wide integers instead of tables of powers, so it works for any mantissa size
+	template<ttmath::uint ManSize, typename CharType>
+	int32 WriteFloat(CharType* Buffer, const ttmath::Big<1, ManSize>& x)
+	{
+		int32 length = 0;
+		if (x.IsNan() || x.IsZero())
+		{
+			const char* special = x.IsNan() ? "NaN" : "0";
+			for (; special[length] != '\0'; length++)
+			{
+				Buffer[length] = CharType(special[length]);
+			}
+			Buffer[length] = CharType('\0');
+			return length;
+		}
+
+		if (x.IsSign())
+		{
+			Buffer[length++] = CharType('-');
+		}
+
+		// x = m * 2^e, and m's highest bit is set
+		const int64 e = int64(ttmath::sint(x.exponent.table[0]));
+		if (e > MaxExactBinaryExponent || e < -MaxExactBinaryExponent)
+		{
+			const std::string fallback = x.ToString();
+			const int32 maxLength = FloatBufferSize(int32(ManSize * 64)) - 1;
+			for (size_t index = x.IsSign() ? 1 : 0; index < fallback.size() && length < maxLength; index++)
+			{
+				Buffer[length++] = CharType(fallback[index]);
+			}
+			Buffer[length] = CharType('\0');
+			return length;
+		}
+
+		// The numbers that round to x are between the midpoints to its neighbors. Below a power of 2, the lower neighbor is twice closer.
+		// In units of 2^(e - 2), x is 4m, and the midpoints are 4m + 2 and 4m - 2 (or 4m - 1)
+		bool bLowerGapHalved = x.mantissa.table[ManSize - 1] == (uint64(1) << 63);
+		for (ttmath::uint word = 0; word + 1 < ManSize; word++)
+		{
+			bLowerGapHalved = bLowerGapHalved && x.mantissa.table[word] == 0;
+		}
+
+		// They are scaled by 2^(e - 2) / 10^q, which is between 10 and 100, and truncated to integers. So there are at least 30 units between the midpoints
+		using ScaledType = ttmath::UInt<ManSize + 1>;
+		const int32 binaryExponent = int32(e) - 2;
+		const int32 q = Log10Pow2(binaryExponent) - 1;
+
+		bool bExact[3];
+		ScaledType scaled[3];
+		if (e <= MaxNarrowBinaryExponent && e >= -MaxNarrowBinaryExponent)
+		{
+			ScaleMidpoints<FloatNarrowWords>(x.mantissa, bLowerGapHalved, binaryExponent, q, scaled, bExact);
+		}
+		else
+		{
+			ScaleMidpoints<FloatExtraWords>(x.mantissa, bLowerGapHalved, binaryExponent, q, scaled, bExact);
+		}
+
+		ScaledType& vr = scaled[0];
+		ScaledType& vp = scaled[1];
+		ScaledType& vm = scaled[2];
+
+		// The upper midpoint itself rounds to the upper neighbor (or to x, but only half of the time), so it's excluded.
+		// As well as the lower one, see the increment below
+		if (bExact[1])
+		{
+			vp.SubInt(1);
+		}
+
+		// Removes the lowest digits while the upper and lower midpoints still differ once they are removed: that leaves the fewest digits.
+		// Eight at a time first, as the shortest representations of "round" numbers are much shorter than the scaled values
+		int32 removedDigits = 0;
+		uint64 lastRemovedDigit = 0;
+		int32 step = 8;
+		for (;;)
+		{
+			ScaledType nextVp(vp);
+			ScaledType nextVm(vm);
+			DivSmallPow10(nextVp, step);
+			DivSmallPow10(nextVm, step);
+			if (!(nextVp > nextVm))
+			{
+				if (step == 1)
+				{
+					break;
+				}
+				step = 1;
+				continue;
+			}
+
+			const uint64 removed = DivSmallPow10(vr, step);
+			lastRemovedDigit = removed / PowersOf10[step - 1];
+			vp = nextVp;
+			vm = nextVm;
+			removedDigits += step;
+		}
+
+		// Rounds the remaining digits to nearest. If they are the lower midpoint's, they are not above it, so they are incremented too
+		if (vr == vm || lastRemovedDigit >= 5)
+		{
+			vr.AddInt(1);
+		}
+
+		CharType digits[(ManSize * 64 * 30103) / 100000 + 4];
+		int32 digitCount = WriteInteger(digits, vr);
+		int32 decimalExponent = q + removedDigits;
+		while (digitCount > 1 && digits[digitCount - 1] == CharType('0'))
+		{
+			digitCount--;
+			decimalExponent++;
+		}
+
+		// The exponent of the leading digit, in scientific notation
+		const int32 scientificExponent = decimalExponent + digitCount - 1;
+		if (scientificExponent > 15 || scientificExponent < -15)
+		{
+			Buffer[length++] = digits[0];
+			if (digitCount > 1)
+			{
+				Buffer[length++] = CharType('.');
+				for (int32 index = 1; index < digitCount; index++)
+				{
+					Buffer[length++] = digits[index];
+				}
+			}
+			Buffer[length++] = CharType('e');
+			Buffer[length++] = CharType(scientificExponent < 0 ? '-' : '+');
+			length += WriteWord(Buffer + length, uint64(scientificExponent < 0 ? -scientificExponent : scientificExponent), 1);
+		}
+		else if (scientificExponent < 0)
+		{
+			Buffer[length++] = CharType('0');
+			Buffer[length++] = CharType('.');
+			for (int32 index = 0; index < -scientificExponent - 1; index++)
+			{
+				Buffer[length++] = CharType('0');
+			}
+			for (int32 index = 0; index < digitCount; index++)
+			{
+				Buffer[length++] = digits[index];
+			}
+		}
+		else
+		{
+			for (int32 index = 0; index < digitCount || index <= scientificExponent; index++)
+			{
+				if (index == scientificExponent + 1)
+				{
+					Buffer[length++] = CharType('.');
+				}
+				Buffer[length++] = index < digitCount ? digits[index] : CharType('0');
+			}
+		}
+		Buffer[length] = CharType('\0');
+		return length;
+	}
+
+	// Converts a decimal to the nearest ttmath float, with the halves rounded to even.
+	// The digits past TDecimal::MaxDigits only count as a sticky bit, so a string with more digits than that can be off by one unit in the last place,
+	// when the dropped digits cross a rounding boundary. So are the numbers beyond MaxExactDecimalExponent, that are left to ttmath's arithmetic
+	template<ttmath::uint ManSize, ttmath::uint DigitWords>
+	void DecimalToFloat(const TDecimal<DigitWords>& Decimal, ttmath::Big<1, ManSize>& Out)
+	{
+		if (Decimal.DigitCount == 0)
+		{
+			Out.SetZero();
+			return;
+		}
+
+		constexpr int32 maxExponent = MaxExactDecimalExponent<DigitWords>();
+		if (Decimal.Exponent > maxExponent || Decimal.Exponent < -maxExponent)
+		{
+			ttmath::Big<1, ManSize> scale(10);
+			scale.Pow(ttmath::UInt<1>(ttmath::uint(Decimal.Exponent < 0 ? -Decimal.Exponent : Decimal.Exponent)));
+			Out.SetZero();
+			Out.FromUInt(Decimal.Digits);
+			if (Decimal.Exponent < 0)
+			{
+				Out.Div(scale);
+			}
+			else
+			{
+				Out.Mul(scale);
+			}
+			if (Decimal.bNegative)
+			{
+				Out.SetSign();
+			}
+			return;
+		}
+
+		// The digits are either multiplied by 10^Exponent, or shifted left enough for the quotient by 10^-Exponent to have at least ManSize * 64 + 2 bits.
+		// The remainder of the division is a sticky bit. The digits have at most DigitWords * 64 bits, and 10^maxExponent at most Pow10Bits(maxExponent)
+		constexpr ttmath::uint WideWords = DigitWords + ManSize + TTMATH_BITS(Pow10Bits(maxExponent));
+		using WideType = ttmath::UInt<WideWords>;
+		const int32 mantissaBits = int32(ManSize) * 64;
+		WideType wide = Resize<WideWords>(Decimal.Digits);
+		int64 binaryExponent = 0;
+		bool bSticky = Decimal.bTruncated;
+		if (Decimal.Exponent >= 0)
+		{
+			MulPow10(wide, Decimal.Exponent);
+		}
+		else
+		{
+			ttmath::uint tableId, index;
+			wide.FindLeadingBit(tableId, index);
+			const int32 digitsBits = int32(tableId * TTMATH_BITS_PER_UINT + index) + 1;
+			const int32 divisorBits = Pow10Bits(-Decimal.Exponent);
+			const int32 shift = FMath::Max(0, mantissaBits + 2 + divisorBits - digitsBits);
+			wide.Rcl(ttmath::uint(shift));
+			binaryExponent = -shift;
+
+			// Chained floor divisions are the floor division by the product, and it's exact if they all are
+			bSticky = !DivPow10(wide, -Decimal.Exponent) || bSticky;
+		}
+
+		// Keeps the highest ManSize * 64 bits, rounded to nearest, the halves to even
+		ttmath::uint tableId, index;
+		wide.FindLeadingBit(tableId, index);
+		const int32 extraBits = int32(tableId * TTMATH_BITS_PER_UINT + index) + 1 - mantissaBits;
+		if (extraBits > 0)
+		{
+			const bool bRoundBit = ((wide.table[(extraBits - 1) / 64] >> ((extraBits - 1) % 64)) & 1) != 0;
+			bSticky = !ShiftRight(wide, extraBits - 1) || bSticky;
+			wide.Rcr(1);
+			binaryExponent += extraBits;
+			if (bRoundBit && (bSticky || (wide.table[0] & 1) != 0))
+			{
+				wide.AddInt(1);
+				// Rounding up can carry to a new bit, then the mantissa is a power of 2 again
+				if (wide.table[ManSize] != 0)
+				{
+					wide.Rcr(1);
+					binaryExponent++;
+				}
+			}
+		}
+		else
+		{
+			wide.Rcl(ttmath::uint(-extraBits));
+			binaryExponent += extraBits;
+		}
+
+		Out.mantissa = Resize<ManSize>(wide);
+		Out.exponent = ttmath::sint(binaryExponent);
+		Out.info = 0;
+		if (Decimal.bNegative)
+		{
+			Out.SetSign();
+		}
+	}
+
+	// Reads a base 10 number at Buffer, like ParseDecimal, and converts it to the nearest ttmath float (see DecimalToFloat)
+	template<ttmath::uint ManSize, typename CharType>
+	bool ParseFloat(const CharType*& Buffer, ttmath::Big<1, ManSize>& Out)
+	{
+		TDecimal<ManSize + 1> decimal;
+		if (!ParseDecimal(Buffer, decimal))
+		{
+			return false;
+		}
+		DecimalToFloat(decimal, Out);
+		return true;
+	}
+}
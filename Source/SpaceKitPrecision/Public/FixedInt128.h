@@ -0,0 +1,529 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/TtmathConfig.h"
+
+#include "Core/Public/HAL/Platform.h"
+#include "CoreMinimal.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+// Whether real_fixed may store mantissas of 65 to 128 bits in a fixed_int128 instead of a ttmath::Int<2>. Can be overridden in the Build.cs
+#ifndef REAL_FIXED_NATIVE_INT128
+#define REAL_FIXED_NATIVE_INT128 1
+#endif
+
+// Which native 128-bit arithmetic is available: the compiler's __int128 (GCC, Clang), or 64-bit intrinsics (MSVC x64)
+#if defined(TTMATH_PLATFORM64) && defined(__SIZEOF_INT128__)
+#define FIXED_INT128_COMPILER_INT128 1
+#define FIXED_INT128_MSVC_INTRINSICS 0
+#elif defined(TTMATH_PLATFORM64) && defined(_MSC_VER) && defined(_M_X64)
+#define FIXED_INT128_COMPILER_INT128 0
+#define FIXED_INT128_MSVC_INTRINSICS 1
+#else
+#define FIXED_INT128_COMPILER_INT128 0
+#define FIXED_INT128_MSVC_INTRINSICS 0
+#endif
+
+#define FIXED_INT128_SUPPORTED (REAL_FIXED_NATIVE_INT128 && (FIXED_INT128_COMPILER_INT128 || FIXED_INT128_MSVC_INTRINSICS))
+
+#if FIXED_INT128_SUPPORTED
+
+// Signed 128-bit two's complement integer, stored as two 64-bit limbs, lowest first.
+// This is the same memory layout as ttmath::Int<2>, so serialized real_fixed numbers don't change.
+// It implements the subset of ttmath::Int<2>'s interface that real_fixed uses, and gives bit-identical results (overflows included),
+// but each operation is a handful of native instructions instead of ttmath's generic limb loops.
+struct fixed_int128
+{
+	using ttIntType = ttmath::Int<2>;
+
+	uint64 lo;
+	uint64 hi;
+
+	fixed_int128()
+	{
+	}
+
+	fixed_int128(int64 value)
+		: lo((uint64)value), hi(value < 0 ? ~0ull : 0ull)
+	{
+	}
+
+	fixed_int128(const ttIntType& value)
+		: lo(value.table[0]), hi(value.table[1])
+	{
+	}
+
+	static fixed_int128 FromLimbs(uint64 inLo, uint64 inHi)
+	{
+		fixed_int128 result;
+		result.lo = inLo;
+		result.hi = inHi;
+		return result;
+	}
+
+	operator ttIntType() const
+	{
+		ttIntType result;
+		result.table[0] = lo;
+		result.table[1] = hi;
+		return result;
+	}
+
+	bool IsSign() const
+	{
+		return (hi >> 63) != 0;
+	}
+
+	bool IsZero() const
+	{
+		return (lo | hi) == 0;
+	}
+
+	void SetMax()
+	{
+		lo = ~0ull;
+		hi = ~0ull >> 1;
+	}
+
+	void SetMin()
+	{
+		lo = 0;
+		hi = 1ull << 63;
+	}
+
+	std::string ToString() const
+	{
+		return ttIntType(*this).ToString();
+	}
+
+	// Native unsigned primitives. Each of them works on the raw limbs, the signed semantics are built on top of them
+
+	static fixed_int128 AddRaw(const fixed_int128& x, const fixed_int128& y)
+	{
+#if FIXED_INT128_COMPILER_INT128
+		return FromNative(ToNative(x) + ToNative(y));
+#else
+		fixed_int128 result;
+		const unsigned char carry = _addcarry_u64(0, x.lo, y.lo, reinterpret_cast<unsigned long long*>(&result.lo));
+		_addcarry_u64(carry, x.hi, y.hi, reinterpret_cast<unsigned long long*>(&result.hi));
+		return result;
+#endif
+	}
+
+	static fixed_int128 SubRaw(const fixed_int128& x, const fixed_int128& y)
+	{
+#if FIXED_INT128_COMPILER_INT128
+		return FromNative(ToNative(x) - ToNative(y));
+#else
+		fixed_int128 result;
+		const unsigned char borrow = _subborrow_u64(0, x.lo, y.lo, reinterpret_cast<unsigned long long*>(&result.lo));
+		_subborrow_u64(borrow, x.hi, y.hi, reinterpret_cast<unsigned long long*>(&result.hi));
+		return result;
+#endif
+	}
+
+	static fixed_int128 NegRaw(const fixed_int128& x)
+	{
+		return SubRaw(fixed_int128(0), x);
+	}
+
+	// Lowest 128 bits of the unsigned product
+	static fixed_int128 MulRaw(const fixed_int128& x, const fixed_int128& y)
+	{
+#if FIXED_INT128_COMPILER_INT128
+		return FromNative(ToNative(x) * ToNative(y));
+#else
+		fixed_int128 result;
+		unsigned long long productHi;
+		result.lo = _umul128(x.lo, y.lo, &productHi);
+		result.hi = productHi + x.lo * y.hi + x.hi * y.lo;
+		return result;
+#endif
+	}
+
+	// Unsigned division. The divisor must not be zero
+	static void DivModRaw(const fixed_int128& x, const fixed_int128& y, fixed_int128& quotient, fixed_int128& remainder)
+	{
+#if FIXED_INT128_COMPILER_INT128
+		const unsigned __int128 nativeX = ToNative(x);
+		const unsigned __int128 nativeY = ToNative(y);
+		quotient = FromNative(nativeX / nativeY);
+		remainder = FromNative(nativeX % nativeY);
+#else
+		// MSVC has no 128 by 128 bits division, so use ttmath's one, on the same limbs
+		ttmath::UInt<2> ttQuotient = ttIntType(x);
+		ttmath::UInt<2> ttRemainder;
+		ttQuotient.Div(ttIntType(y), ttRemainder);
+		quotient = FromLimbs(ttQuotient.table[0], ttQuotient.table[1]);
+		remainder = FromLimbs(ttRemainder.table[0], ttRemainder.table[1]);
+#endif
+	}
+
+	// Unsigned comparison
+	static bool UnsignedLess(const fixed_int128& x, const fixed_int128& y)
+	{
+		return x.hi < y.hi || (x.hi == y.hi && x.lo < y.lo);
+	}
+
+	// Shifts, on the raw limbs. Bits must be lower than 128
+
+	static fixed_int128 ShiftLeftRaw(const fixed_int128& x, int32 bits)
+	{
+		if (bits == 0)
+		{
+			return x;
+		}
+		if (bits >= 64)
+		{
+			return FromLimbs(0, x.lo << (bits - 64));
+		}
+		return FromLimbs(x.lo << bits, (x.hi << bits) | (x.lo >> (64 - bits)));
+	}
+
+	static fixed_int128 ShiftRightRaw(const fixed_int128& x, int32 bits)
+	{
+		if (bits == 0)
+		{
+			return x;
+		}
+		if (bits >= 64)
+		{
+			return FromLimbs(x.hi >> (bits - 64), 0);
+		}
+		return FromLimbs((x.lo >> bits) | (x.hi << (64 - bits)), x.hi >> bits);
+	}
+
+	// Full 64 by 64 bits unsigned product
+	static uint64 Mul64(uint64 x, uint64 y, uint64& high)
+	{
+#if FIXED_INT128_COMPILER_INT128
+		const unsigned __int128 product = (unsigned __int128)x * y;
+		high = (uint64)(product >> 64);
+		return (uint64)product;
+#else
+		unsigned long long productHigh;
+		const uint64 productLow = _umul128(x, y, &productHigh);
+		high = productHigh;
+		return productLow;
+#endif
+	}
+
+	// Full 128 by 128 bits unsigned product, as a 256 bits number split in two halves
+	static void MulWideRaw(const fixed_int128& x, const fixed_int128& y, fixed_int128& low, fixed_int128& high)
+	{
+		uint64 ll1, lh1, hl1, hh1;
+		const uint64 ll0 = Mul64(x.lo, y.lo, ll1);
+		const uint64 lh0 = Mul64(x.lo, y.hi, lh1);
+		const uint64 hl0 = Mul64(x.hi, y.lo, hl1);
+		const uint64 hh0 = Mul64(x.hi, y.hi, hh1);
+
+		// Sum the partial products, column by column
+		const fixed_int128 middle = AddRaw(FromLimbs(lh0, lh1), FromLimbs(hl0, hl1));
+		const uint64 middleCarry = UnsignedLess(middle, FromLimbs(lh0, lh1)) ? 1 : 0;
+
+		low = AddRaw(FromLimbs(ll0, ll1), FromLimbs(0, middle.lo));
+		const uint64 lowCarry = UnsignedLess(low, FromLimbs(ll0, ll1)) ? 1 : 0;
+
+		high = AddRaw(AddRaw(FromLimbs(hh0, hh1), FromLimbs(middle.hi, middleCarry)), fixed_int128(lowCarry));
+	}
+
+	// x * y + a + b, as two 64-bit words. It never overflows
+	static uint64 MulAdd64(uint64 x, uint64 y, uint64 a, uint64 b, uint64& high)
+	{
+#if FIXED_INT128_COMPILER_INT128
+		const unsigned __int128 result = (unsigned __int128)x * y + a + b;
+		high = (uint64)(result >> 64);
+		return (uint64)result;
+#else
+		unsigned long long productHigh;
+		unsigned long long result = _umul128(x, y, &productHigh);
+		productHigh += _addcarry_u64(0, result, a, &result);
+		productHigh += _addcarry_u64(0, result, b, &result);
+		high = productHigh;
+		return result;
+#endif
+	}
+
+	// Absolute value, as an unsigned number. Like ttmath, the absolute value of the minimum is itself
+	static fixed_int128 AbsRaw(const fixed_int128& x)
+	{
+		return x.IsSign() ? NegRaw(x) : x;
+	}
+
+	// Same as ttmath::Int::SetSign: makes a positive number negative, and leaves negative numbers (including overflowed results) untouched
+	static fixed_int128 SetSignRaw(const fixed_int128& x)
+	{
+		return x.IsSign() ? x : NegRaw(x);
+	}
+
+#if FIXED_INT128_COMPILER_INT128
+	static unsigned __int128 ToNative(const fixed_int128& x)
+	{
+		return ((unsigned __int128)x.hi << 64) | x.lo;
+	}
+
+	static fixed_int128 FromNative(unsigned __int128 x)
+	{
+		return FromLimbs((uint64)x, (uint64)(x >> 64));
+	}
+#endif
+
+	// Operators, with ttmath::Int semantics
+
+	fixed_int128 operator-() const
+	{
+		return NegRaw(*this);
+	}
+
+	fixed_int128 operator+(const fixed_int128& y) const
+	{
+		return AddRaw(*this, y);
+	}
+
+	fixed_int128 operator-(const fixed_int128& y) const
+	{
+		return SubRaw(*this, y);
+	}
+
+	fixed_int128& operator+=(const fixed_int128& y)
+	{
+		return *this = AddRaw(*this, y);
+	}
+
+	fixed_int128& operator-=(const fixed_int128& y)
+	{
+		return *this = SubRaw(*this, y);
+	}
+
+	// ttmath multiplies the absolute values, then sets the sign, so an overflowing product doesn't wrap around like a two's complement one would
+	fixed_int128 operator*(const fixed_int128& y) const
+	{
+		const fixed_int128 product = MulRaw(AbsRaw(*this), AbsRaw(y));
+		return IsSign() != y.IsSign() ? SetSignRaw(product) : product;
+	}
+
+	fixed_int128& operator*=(const fixed_int128& y)
+	{
+		return *this = *this * y;
+	}
+
+	// Truncated division, as in ttmath. Like ttmath, dividing by zero leaves the dividend unchanged
+	fixed_int128 operator/(const fixed_int128& y) const
+	{
+		if (y.IsZero())
+		{
+			return *this;
+		}
+
+		fixed_int128 quotient, remainder;
+		DivModRaw(AbsRaw(*this), AbsRaw(y), quotient, remainder);
+		return IsSign() != y.IsSign() ? SetSignRaw(quotient) : quotient;
+	}
+
+	fixed_int128& operator/=(const fixed_int128& y)
+	{
+		return *this = *this / y;
+	}
+
+	// The remainder has the sign of the dividend, as in ttmath. The remainder of a division by zero is zero
+	fixed_int128 operator%(const fixed_int128& y) const
+	{
+		if (y.IsZero())
+		{
+			return fixed_int128(0);
+		}
+
+		fixed_int128 quotient, remainder;
+		DivModRaw(AbsRaw(*this), AbsRaw(y), quotient, remainder);
+		return IsSign() ? SetSignRaw(remainder) : remainder;
+	}
+
+	fixed_int128& operator%=(const fixed_int128& y)
+	{
+		return *this = *this % y;
+	}
+
+	// Fixed point operations. See MulShiftRound and ShiftDivRound in RealFixedGeneric.h, that give the same results on ttmath integers
+
+	// (x * y) >> shift, rounded to nearest, with the halves rounded away from zero. The product is 256 bits wide, so it doesn't overflow
+	friend fixed_int128 MulShiftRound(const fixed_int128& x, const fixed_int128& y, int32 shift)
+	{
+		fixed_int128 low, high;
+		MulWideRaw(AbsRaw(x), AbsRaw(y), low, high);
+
+		if (shift > 0)
+		{
+			const fixed_int128 half = ShiftLeftRaw(fixed_int128(1), shift - 1);
+			const fixed_int128 rounded = AddRaw(low, half);
+			if (UnsignedLess(rounded, low))
+			{
+				high = AddRaw(high, fixed_int128(1));
+			}
+			low = rounded;
+		}
+
+		const fixed_int128 result = shift > 0 ? (ShiftRightRaw(low, shift) + ShiftLeftRaw(high, 128 - shift)) : low;
+		return x.IsSign() != y.IsSign() ? NegRaw(result) : result;
+	}
+
+	// (x << shift) / y, rounded to nearest, with the halves rounded away from zero. The shifted dividend is 256 bits wide, so it doesn't overflow.
+	// Dividing by zero leaves the dividend unchanged
+	friend fixed_int128 ShiftDivRound(const fixed_int128& x, const fixed_int128& y, int32 shift)
+	{
+		if (y.IsZero())
+		{
+			return x;
+		}
+
+		const fixed_int128 absX = AbsRaw(x);
+		const fixed_int128 absY = AbsRaw(y);
+
+		// Divide the integral part first, then the shifted remainder. This only needs 128 bits divisions, as long as the shifted remainder fits in 128 bits
+		fixed_int128 quotient, remainder;
+		DivModRaw(absX, absY, quotient, remainder);
+
+		if (shift > 0 && !ShiftRightRaw(remainder, 128 - shift).IsZero())
+		{
+			// The divisor is too big for that, so fall back to a 256 bits division
+			ttmath::UInt<4> wideQuotient, wideRemainder;
+			wideQuotient.FromUInt(ttmath::UInt<2>(ttIntType(absX)));
+			wideQuotient.Rcl(shift);
+			ttmath::UInt<4> wideDivisor;
+			wideDivisor.FromUInt(ttmath::UInt<2>(ttIntType(absY)));
+			wideQuotient.Div(wideDivisor, wideRemainder);
+
+			quotient = FromLimbs(wideQuotient.table[0], wideQuotient.table[1]);
+			remainder = FromLimbs(wideRemainder.table[0], wideRemainder.table[1]);
+		}
+		else
+		{
+			fixed_int128 fractionQuotient;
+			DivModRaw(ShiftLeftRaw(remainder, shift), absY, fractionQuotient, remainder);
+			quotient = AddRaw(ShiftLeftRaw(quotient, shift), fractionQuotient);
+		}
+
+		// Round up if the remainder is at least half of the divisor
+		if (!UnsignedLess(remainder, SubRaw(absY, remainder)))
+		{
+			quotient = AddRaw(quotient, fixed_int128(1));
+		}
+
+		return x.IsSign() != y.IsSign() ? NegRaw(quotient) : quotient;
+	}
+
+	// floor(2^(128 + shift) / |y|), the reciprocal of y for ShiftDivRoundReciprocal, or zero if y is zero. Shift must be lower than 128
+	friend ttmath::UInt<4> ShiftReciprocal(const fixed_int128& y, int32 shift)
+	{
+		ttmath::UInt<4> reciprocal;
+		reciprocal.SetZero();
+		if (!y.IsZero())
+		{
+			ttmath::UInt<4> divisor, remainder;
+			divisor.FromUInt(ttmath::UInt<2>(ttIntType(AbsRaw(y))));
+			reciprocal.SetBit(128 + shift);
+			reciprocal.Div(divisor, remainder);
+		}
+		return reciprocal;
+	}
+
+	// Same result as ShiftDivRound(x, y, shift), given the reciprocal of y from ShiftReciprocal, but only with multiplications.
+	// The reciprocal gives the quotient, or one less, so the remainder of that estimate is below twice the divisor, and fits in 128 bits:
+	// one step corrects it, then it gives the rounding
+	friend fixed_int128 ShiftDivRoundReciprocal(const fixed_int128& x, const fixed_int128& y, const ttmath::UInt<4>& reciprocal, int32 shift)
+	{
+		if (y.IsZero())
+		{
+			return x;
+		}
+
+		const fixed_int128 absX = AbsRaw(x);
+		const fixed_int128 absY = AbsRaw(y);
+
+		// The estimated quotient is ((|x| << shift) * reciprocal) >> (128 + shift), i.e. the third and fourth words of |x| * reciprocal,
+		// so the words above them aren't computed
+		uint64 product[4];
+		uint64 carry = 0;
+		for (int32 j = 0; j < 4; j++)
+		{
+			product[j] = MulAdd64(absX.lo, reciprocal.table[j], 0, carry, carry);
+		}
+		carry = 0;
+		for (int32 j = 0; j < 3; j++)
+		{
+			product[j + 1] = MulAdd64(absX.hi, reciprocal.table[j], product[j + 1], carry, carry);
+		}
+
+		fixed_int128 quotient = FromLimbs(product[2], product[3]);
+		fixed_int128 remainder = SubRaw(ShiftLeftRaw(absX, shift), MulRaw(quotient, absY));
+		if (!UnsignedLess(remainder, absY))
+		{
+			quotient = AddRaw(quotient, fixed_int128(1));
+			remainder = SubRaw(remainder, absY);
+		}
+
+		// Round up if the remainder is at least half of the divisor
+		if (!UnsignedLess(remainder, SubRaw(absY, remainder)))
+		{
+			quotient = AddRaw(quotient, fixed_int128(1));
+		}
+
+		return x.IsSign() != y.IsSign() ? NegRaw(quotient) : quotient;
+	}
+
+	bool operator==(const fixed_int128& y) const
+	{
+		return lo == y.lo && hi == y.hi;
+	}
+
+	bool operator!=(const fixed_int128& y) const
+	{
+		return !(*this == y);
+	}
+
+	bool operator<(const fixed_int128& y) const
+	{
+		return (int64)hi < (int64)y.hi || (hi == y.hi && lo < y.lo);
+	}
+
+	bool operator>(const fixed_int128& y) const
+	{
+		return y < *this;
+	}
+
+	bool operator<=(const fixed_int128& y) const
+	{
+		return !(y < *this);
+	}
+
+	bool operator>=(const fixed_int128& y) const
+	{
+		return !(*this < y);
+	}
+
+	friend fixed_int128 Abs(const fixed_int128& x)
+	{
+		return AbsRaw(x);
+	}
+};
+
+#endif // FIXED_INT128_SUPPORTED
+
+// Selects the integer type that stores a real_fixed mantissa of a given size (in ttmath words).
+// By default, it's ttmath::Int. Two-words mantissas use fixed_int128 instead, when the platform supports it.
+template<ttmath::uint WordCount>
+struct real_fixed_mantissa
+{
+	using type = ttmath::Int<WordCount>;
+};
+
+#if FIXED_INT128_SUPPORTED
+template<>
+struct real_fixed_mantissa<2>
+{
+	using type = fixed_int128;
+};
+#endif
@@ -0,0 +1,357 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/VectorFixedGeneric.h"
+#include "SpaceKitPrecision/Public/PrecisionSettings.h"
+
+#include "CoreMinimal.h"
+
+// Whether TFixedVectorSoA may use its AVX2 kernels. Can be overridden in the Build.cs
+#ifndef FIXED_VECTOR_SOA_SIMD
+#define FIXED_VECTOR_SOA_SIMD 1
+#endif
+
+// The kernels are picked at compile time: they need the module to be compiled for AVX2 (-mavx2, /arch:AVX2, or higher), and 64-bit ttmath words
+#if FIXED_VECTOR_SOA_SIMD && defined(__AVX2__) && defined(TTMATH_PLATFORM64)
+#define FIXED_VECTOR_SOA_AVX2 1
+#include <immintrin.h>
+#else
+#define FIXED_VECTOR_SOA_AVX2 0
+#endif
+
+
+// Array of fixed-point vectors, stored as a structure of arrays: each word of each component's mantissa has its own plane
+// (X's lowest words, X's next words, ..., Z's highest words), so the batch operations below process several vectors at once.
+// It's meant for the many positions of ships, debris and projectiles that are integrated together, e.g. with AddScaled.
+// The operations give exactly the same results as real_fixed's operators, overflows included.
+template<int MantissaSize, int Exponent>
+class TFixedVectorSoA
+{
+public:
+
+	using RealType = real_fixed<MantissaSize, Exponent>;
+	using VectorType = TVectorFixed<MantissaSize, Exponent>;
+	using WordType = ttmath::uint;
+
+	// Number of words in a mantissa, and so of planes per component
+	static constexpr int32 WordCount = int32(TTMATH_BITS(MantissaSize + Exponent));
+
+	// Number of vectors processed at once by the SIMD kernels. The planes are aligned on their size
+	static constexpr int32 LaneCount = 4;
+
+	static_assert(sizeof(typename RealType::ttIntMantissaType) == WordCount * sizeof(WordType), "Mantissas must be made of their words only");
+
+	int32 Num() const
+	{
+		return NumElements;
+	}
+
+	// Resizes the array. New vectors are zero
+	void SetNum(int32 InNum)
+	{
+		for (PlaneType& Plane : Planes)
+		{
+			Plane.SetNumZeroed(InNum);
+		}
+		NumElements = InNum;
+	}
+
+	void Empty()
+	{
+		SetNum(0);
+	}
+
+	// The plane of a word of the mantissas of a component, to write kernels of one's own
+	WordType* GetPlane(int32 Axis, int32 Word)
+	{
+		return Planes[Axis * WordCount + Word].GetData();
+	}
+
+	const WordType* GetPlane(int32 Axis, int32 Word) const
+	{
+		return Planes[Axis * WordCount + Word].GetData();
+	}
+
+	RealType GetComponent(int32 Index, int32 Axis) const
+	{
+		RealType Result;
+		WordType* Words = reinterpret_cast<WordType*>(&Result.mantissa);
+		for (int32 Word = 0; Word < WordCount; Word++)
+		{
+			Words[Word] = GetPlane(Axis, Word)[Index];
+		}
+		return Result;
+	}
+
+	void SetComponent(int32 Index, int32 Axis, const RealType& Value)
+	{
+		const WordType* Words = reinterpret_cast<const WordType*>(&Value.mantissa);
+		for (int32 Word = 0; Word < WordCount; Word++)
+		{
+			GetPlane(Axis, Word)[Index] = Words[Word];
+		}
+	}
+
+	VectorType Get(int32 Index) const
+	{
+		return VectorType(GetComponent(Index, 0), GetComponent(Index, 1), GetComponent(Index, 2));
+	}
+
+	void Set(int32 Index, const VectorType& Vector)
+	{
+		SetComponent(Index, 0, Vector.X);
+		SetComponent(Index, 1, Vector.Y);
+		SetComponent(Index, 2, Vector.Z);
+	}
+
+	// Copies an array of vectors, TVectorFixed or FVectorFixed, into this one, replacing its content
+	template<typename InVectorType>
+	void Gather(const InVectorType* Vectors, int32 Count)
+	{
+		SetNum(Count);
+		for (int32 Index = 0; Index < Count; Index++)
+		{
+			SetComponent(Index, 0, RealType(Vectors[Index].X));
+			SetComponent(Index, 1, RealType(Vectors[Index].Y));
+			SetComponent(Index, 2, RealType(Vectors[Index].Z));
+		}
+	}
+
+	template<typename InVectorType>
+	void Gather(const TArray<InVectorType>& Vectors)
+	{
+		Gather(Vectors.GetData(), Vectors.Num());
+	}
+
+	// Copies this array into an array of vectors, TVectorFixed or FVectorFixed, that holds at least Num() of them
+	template<typename OutVectorType>
+	void Scatter(OutVectorType* Vectors) const
+	{
+		for (int32 Index = 0; Index < NumElements; Index++)
+		{
+			StoreComponent(Vectors[Index].X, GetComponent(Index, 0));
+			StoreComponent(Vectors[Index].Y, GetComponent(Index, 1));
+			StoreComponent(Vectors[Index].Z, GetComponent(Index, 2));
+		}
+	}
+
+	template<typename OutVectorType>
+	void Scatter(TArray<OutVectorType>& Vectors) const
+	{
+		Vectors.SetNum(NumElements);
+		Scatter(Vectors.GetData());
+	}
+
+	// Batch operations. The other arrays must have as many vectors as this one
+public:
+
+	// this[i] += Other[i]
+	void Add(const TFixedVectorSoA& Other)
+	{
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			int32 Index = 0;
+#if FIXED_VECTOR_SOA_AVX2
+			Index = AddPlanesAvx2(*this, Other, Axis, false);
+#endif
+			for (; Index < NumElements; Index++)
+			{
+				SetComponent(Index, Axis, GetComponent(Index, Axis) + Other.GetComponent(Index, Axis));
+			}
+		}
+	}
+
+	// this[i] -= Other[i]
+	void Sub(const TFixedVectorSoA& Other)
+	{
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			int32 Index = 0;
+#if FIXED_VECTOR_SOA_AVX2
+			Index = AddPlanesAvx2(*this, Other, Axis, true);
+#endif
+			for (; Index < NumElements; Index++)
+			{
+				SetComponent(Index, Axis, GetComponent(Index, Axis) - Other.GetComponent(Index, Axis));
+			}
+		}
+	}
+
+	// this[i] *= Scalar
+	void Scale(const RealType& Scalar)
+	{
+		MultiplyPlanes<false>(*this, Scalar);
+	}
+
+	// this[i] += Other[i] * Scalar, e.g. Positions.AddScaled(Velocities, DeltaTime).
+	// The products are scalar: AVX2 has no 64-bit multiplication. See mul_shift_round_factor
+	void AddScaled(const TFixedVectorSoA& Other, const RealType& Scalar)
+	{
+		MultiplyPlanes<true>(Other, Scalar);
+	}
+
+	// this[i] = Min(this[i], Other[i]), component by component
+	void Min(const TFixedVectorSoA& Other)
+	{
+		SelectPlanes(Other, false);
+	}
+
+	// this[i] = Max(this[i], Other[i]), component by component
+	void Max(const TFixedVectorSoA& Other)
+	{
+		SelectPlanes(Other, true);
+	}
+
+	// OutLess[i] = this[i] < Other[i], for one of the components
+	void Less(const TFixedVectorSoA& Other, int32 Axis, TArray<bool>& OutLess) const
+	{
+		OutLess.SetNum(NumElements);
+		int32 Index = 0;
+#if FIXED_VECTOR_SOA_AVX2
+		for (; Index + LaneCount <= NumElements; Index += LaneCount)
+		{
+			const int32 Mask = _mm256_movemask_pd(_mm256_castsi256_pd(LessAvx2(*this, Other, Axis, Index)));
+			for (int32 Lane = 0; Lane < LaneCount; Lane++)
+			{
+				OutLess[Index + Lane] = ((Mask >> Lane) & 1) != 0;
+			}
+		}
+#endif
+		for (; Index < NumElements; Index++)
+		{
+			OutLess[Index] = GetComponent(Index, Axis) < Other.GetComponent(Index, Axis);
+		}
+	}
+
+private:
+
+	using PlaneType = TArray<WordType, TAlignedHeapAllocator<LaneCount * sizeof(WordType)>>;
+
+	PlaneType Planes[3 * WordCount];
+
+	int32 NumElements = 0;
+
+	template<typename ComponentType>
+	static void StoreComponent(ComponentType& Component, const RealType& Value)
+	{
+		Component = ComponentType(Value);
+	}
+
+	// this[i] = Other[i] * Scalar, or this[i] += Other[i] * Scalar
+	template<bool bAccumulate>
+	void MultiplyPlanes(const TFixedVectorSoA& Other, const RealType& Scalar)
+	{
+		const mul_shift_round_factor<typename RealType::ttIntMantissaType> Factor(Scalar.mantissa);
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			for (int32 Index = 0; Index < NumElements; Index++)
+			{
+				const RealType Product = RealType::FromMantissa(Factor.template Multiply<Exponent>(Other.GetComponent(Index, Axis).mantissa));
+				SetComponent(Index, Axis, bAccumulate ? GetComponent(Index, Axis) + Product : Product);
+			}
+		}
+	}
+
+	// Keeps the lowest or the highest of both components, for each axis
+	void SelectPlanes(const TFixedVectorSoA& Other, bool bKeepHighest)
+	{
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			int32 Index = 0;
+#if FIXED_VECTOR_SOA_AVX2
+			for (; Index + LaneCount <= NumElements; Index += LaneCount)
+			{
+				// Lanes where the other component is kept: where this one is lower for the highest, and where it isn't for the lowest
+				const __m256i bOther = _mm256_xor_si256(LessAvx2(*this, Other, Axis, Index), bKeepHighest ? _mm256_setzero_si256() : _mm256_set1_epi64x(-1));
+				for (int32 Word = 0; Word < WordCount; Word++)
+				{
+					WordType* Plane = GetPlane(Axis, Word) + Index;
+					const __m256i Value = _mm256_load_si256(reinterpret_cast<const __m256i*>(Plane));
+					const __m256i OtherValue = _mm256_load_si256(reinterpret_cast<const __m256i*>(Other.GetPlane(Axis, Word) + Index));
+					_mm256_store_si256(reinterpret_cast<__m256i*>(Plane), _mm256_blendv_epi8(Value, OtherValue, bOther));
+				}
+			}
+#endif
+			for (; Index < NumElements; Index++)
+			{
+				const RealType Value = GetComponent(Index, Axis);
+				const RealType OtherValue = Other.GetComponent(Index, Axis);
+				if (bKeepHighest ? Value < OtherValue : OtherValue < Value)
+				{
+					SetComponent(Index, Axis, OtherValue);
+				}
+			}
+		}
+	}
+
+#if FIXED_VECTOR_SOA_AVX2
+
+	// AVX2 compares 64-bit lanes as signed integers only, so unsigned comparisons flip the sign bits first
+	static __m256i UnsignedLessAvx2(__m256i x, __m256i y)
+	{
+		const __m256i SignBit = _mm256_set1_epi64x(int64(1ull << 63));
+		return _mm256_cmpgt_epi64(_mm256_xor_si256(y, SignBit), _mm256_xor_si256(x, SignBit));
+	}
+
+	// x[Index..Index + LaneCount] < y[Index..Index + LaneCount], as lane masks. The highest words are signed, the lower ones decide the ties
+	static __m256i LessAvx2(const TFixedVectorSoA& x, const TFixedVectorSoA& y, int32 Axis, int32 Index)
+	{
+		__m256i Result = _mm256_setzero_si256();
+		for (int32 Word = 0; Word < WordCount; Word++)
+		{
+			const __m256i xWord = _mm256_load_si256(reinterpret_cast<const __m256i*>(x.GetPlane(Axis, Word) + Index));
+			const __m256i yWord = _mm256_load_si256(reinterpret_cast<const __m256i*>(y.GetPlane(Axis, Word) + Index));
+			const __m256i WordLess = Word == WordCount - 1 ? _mm256_cmpgt_epi64(yWord, xWord) : UnsignedLessAvx2(xWord, yWord);
+			Result = _mm256_or_si256(WordLess, _mm256_and_si256(_mm256_cmpeq_epi64(xWord, yWord), Result));
+		}
+		return Result;
+	}
+
+	// x += y, or x -= y, word by word, with the carries (or borrows) as lane masks: -1 where there is one.
+	// Returns the first index left to the scalar loop
+	static int32 AddPlanesAvx2(TFixedVectorSoA& x, const TFixedVectorSoA& y, int32 Axis, bool bSubtract)
+	{
+		const __m256i Zero = _mm256_setzero_si256();
+		int32 Index = 0;
+		for (; Index + LaneCount <= x.NumElements; Index += LaneCount)
+		{
+			__m256i Carry = Zero;
+			for (int32 Word = 0; Word < WordCount; Word++)
+			{
+				WordType* xPlane = x.GetPlane(Axis, Word) + Index;
+				const __m256i xWord = _mm256_load_si256(reinterpret_cast<const __m256i*>(xPlane));
+				const __m256i yWord = _mm256_load_si256(reinterpret_cast<const __m256i*>(y.GetPlane(Axis, Word) + Index));
+
+				__m256i Result;
+				if (bSubtract)
+				{
+					// Borrows from the difference, and from subtracting the incoming borrow from a zero difference
+					const __m256i Difference = _mm256_sub_epi64(xWord, yWord);
+					Result = _mm256_add_epi64(Difference, Carry);
+					Carry = _mm256_or_si256(UnsignedLessAvx2(xWord, yWord), _mm256_and_si256(_mm256_cmpeq_epi64(Difference, Zero), Carry));
+				}
+				else
+				{
+					// Carries from the sum, and from adding the incoming carry to a sum that is all ones
+					const __m256i Sum = _mm256_add_epi64(xWord, yWord);
+					Result = _mm256_sub_epi64(Sum, Carry);
+					Carry = _mm256_or_si256(UnsignedLessAvx2(Sum, xWord), _mm256_and_si256(_mm256_cmpeq_epi64(Result, Zero), Carry));
+				}
+				_mm256_store_si256(reinterpret_cast<__m256i*>(xPlane), Result);
+			}
+		}
+		return Index;
+	}
+
+#endif // FIXED_VECTOR_SOA_AVX2
+};
+
+template<int MantissaSize, int Exponent>
+constexpr int32 TFixedVectorSoA<MantissaSize, Exponent>::WordCount;
+
+template<int MantissaSize, int Exponent>
+constexpr int32 TFixedVectorSoA<MantissaSize, Exponent>::LaneCount;
+
+// Structure of arrays of FVectorFixed, at the precision set in PrecisionSettings.h. Gather and Scatter take FVectorFixed arrays as is
+using FFixedVectorSoA = TFixedVectorSoA<REAL_FIXED_MANTISSA_SIZE, REAL_FIXED_EXPONENT>;
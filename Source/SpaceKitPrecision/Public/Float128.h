@@ -0,0 +1,434 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/TtmathConfig.h"
+
+#include "Core/Public/HAL/Platform.h"
+#include "CoreMinimal.h"
+
+#include <cstring>
+#include <string>
+
+// Whether the compiler has the IEEE binary128 type __float128 (GCC and Clang on x86_64 Linux), and the native 128 bits integers the conversions below use.
+// Without it, FRealFloat falls back to its ttmath storage, even if USE_FLOAT128_BIG is set
+#if defined(__SIZEOF_FLOAT128__) && defined(__SIZEOF_INT128__) && !defined(_MSC_VER)
+#define SPACEKIT_HAS_FLOAT128 1
+#else
+#define SPACEKIT_HAS_FLOAT128 0
+#endif
+
+// Whether libquadmath is linked, for its transcendental functions (see SpaceKitPrecision.Build.cs).
+// Without it, __float128 numbers use the ttmath kernels of RealFloatTrigo, RealFloatExpLog and RealFloatSqrt
+#ifndef SPACEKIT_WITH_QUADMATH
+#define SPACEKIT_WITH_QUADMATH 0
+#endif
+
+#if SPACEKIT_HAS_FLOAT128
+
+#if SPACEKIT_WITH_QUADMATH
+extern "C"
+{
+#include <quadmath.h>
+}
+#endif
+
+// IEEE binary128 numbers: a 113 bits mantissa and a 15 bits exponent (about 1e+-4932), with arithmetic generated by the compiler in software.
+// FRealFloat is stored in them with USE_FLOAT128_BIG, on compilers that have __float128, see PrecisionSettings.h
+namespace f128math
+{
+	using NativeType = __float128;
+	using NativeUInt = unsigned __int128;
+
+	static constexpr int32 MantissaBits = 113;
+	static constexpr int32 ExponentBias = 16383;
+	// Binary exponent of the lowest bit of the smallest subnormal number, and of the highest bit of the largest number
+	static constexpr int32 MinLowestBitExponent = 1 - ExponentBias - (MantissaBits - 1);
+	static constexpr int32 MaxHighestBitExponent = ExponentBias;
+
+	static constexpr uint64 SignBit = uint64(1) << 63;
+	static constexpr uint64 HighFractionMask = (uint64(1) << 48) - 1;
+	static constexpr uint64 InfinityHighWord = uint64(0x7FFF) << 48;
+	static constexpr uint64 NanHighWord = InfinityHighWord | (uint64(1) << 47);
+
+	// Ttmath float type that stores any finite binary128 number exactly
+	using ExactBigType = ttmath::Big<1, TTMATH_BITS(128)>;
+
+	struct Float128
+	{
+		// The number's bits, lowest word first. They're stored as words, so the number only needs the alignment of a word, like FRealFloat's storage has
+		uint64 Words[2];
+
+		Float128()
+		{
+		}
+
+		Float128(double value)
+		{
+			SetNative(NativeType(value));
+		}
+
+		Float128(float value)
+		{
+			SetNative(NativeType(value));
+		}
+
+		Float128(int32 value)
+		{
+			SetNative(NativeType(value));
+		}
+
+		Float128(uint32 value)
+		{
+			SetNative(NativeType(value));
+		}
+
+		// 64-bits integers are exact, as the mantissa has 113 bits
+		Float128(int64 value)
+		{
+			SetNative(NativeType(value));
+		}
+
+		Float128(uint64 value)
+		{
+			SetNative(NativeType(value));
+		}
+
+		template<ttmath::uint Exponent, ttmath::uint Mantissa>
+		explicit Float128(const ttmath::Big<Exponent, Mantissa>& big)
+		{
+			*this = FromBig(big);
+		}
+
+		template<ttmath::uint Exponent, ttmath::uint Mantissa>
+		explicit operator ttmath::Big<Exponent, Mantissa>() const
+		{
+			return ToBig<ttmath::Big<Exponent, Mantissa>>();
+		}
+
+		FORCEINLINE NativeType ToNative() const
+		{
+			NativeType value;
+			std::memcpy(&value, Words, sizeof(value));
+			return value;
+		}
+
+		FORCEINLINE void SetNative(NativeType value)
+		{
+			std::memcpy(Words, &value, sizeof(value));
+		}
+
+		static FORCEINLINE Float128 FromNative(NativeType value)
+		{
+			Float128 result;
+			result.SetNative(value);
+			return result;
+		}
+
+		static Float128 FromWords(uint64 low, uint64 high)
+		{
+			Float128 result;
+			result.Words[0] = low;
+			result.Words[1] = high;
+			return result;
+		}
+
+		// Builds the nearest binary128 number from a ttmath float, with the halves rounded to even.
+		// Values beyond the largest number become infinities, and the ones below the smallest subnormal number become zeros
+		template<ttmath::uint Exponent, ttmath::uint Mantissa>
+		static Float128 FromBig(const ttmath::Big<Exponent, Mantissa>& big)
+		{
+			if (big.IsNan())
+			{
+				return FromWords(0, NanHighWord);
+			}
+			const uint64 sign = big.IsSign() ? SignBit : 0;
+			if (big.IsZero())
+			{
+				return FromWords(0, sign);
+			}
+
+			// The highest 128 bits of the mantissa, whose highest bit is set, and whether any lower bit is set
+			NativeUInt window = NativeUInt(big.mantissa.table[Mantissa - 1]) << 64;
+			bool bSticky = false;
+			if (Mantissa >= 2)
+			{
+				window |= NativeUInt(big.mantissa.table[Mantissa >= 2 ? Mantissa - 2 : 0]);
+				for (ttmath::uint word = 0; word + 2 < Mantissa; word++)
+				{
+					bSticky = bSticky || big.mantissa.table[word] != 0;
+				}
+			}
+
+			ttmath::sint exponent;
+			if (big.exponent.ToInt(exponent) != 0)
+			{
+				return FromWords(0, big.exponent.IsSign() ? sign : sign | InfinityHighWord);
+			}
+			const int64 highestBitExponent = int64(exponent) + int64(Mantissa) * 64 - 1;
+			if (highestBitExponent > MaxHighestBitExponent)
+			{
+				return FromWords(0, sign | InfinityHighWord);
+			}
+
+			// Normal numbers keep 113 bits, and subnormal ones down to the weight of the smallest one
+			const int64 keptBits = FMath::Min(int64(MantissaBits), highestBitExponent - MinLowestBitExponent + 1);
+			if (keptBits <= 0)
+			{
+				// Only the values above half the smallest subnormal number round up to it, the half itself rounds to the even zero
+				const bool bAboveHalf = keptBits == 0 && (bSticky || (window << 1) != 0);
+				return FromWords(bAboveHalf ? 1 : 0, sign);
+			}
+
+			const int32 droppedBits = 128 - int32(keptBits);
+			NativeUInt significand = window >> droppedBits;
+			const bool bRoundBit = ((window >> (droppedBits - 1)) & 1) != 0;
+			bSticky = bSticky || (window & ((NativeUInt(1) << (droppedBits - 1)) - 1)) != 0;
+			int64 lowestBitExponent = highestBitExponent - keptBits + 1;
+			if (bRoundBit && (bSticky || (significand & 1) != 0))
+			{
+				significand++;
+				// Rounding up can carry to a new bit. A subnormal number then becomes normal, or a normal one gets the next exponent
+				if ((significand >> MantissaBits) != 0)
+				{
+					significand >>= 1;
+					lowestBitExponent++;
+				}
+			}
+
+			// Normal numbers have an implicit highest bit, and subnormal ones the exponent field 0
+			const bool bNormal = ((significand >> (MantissaBits - 1)) & 1) != 0;
+			const int64 biasedExponent = bNormal ? lowestBitExponent + (MantissaBits - 1) + ExponentBias : 0;
+			if (biasedExponent >= 0x7FFF)
+			{
+				return FromWords(0, sign | InfinityHighWord);
+			}
+			return FromWords(uint64(significand), sign | (uint64(biasedExponent) << 48) | (uint64(significand >> 64) & HighFractionMask));
+		}
+
+		// Converts this number to a ttmath float, which is exact if BigType's mantissa has at least 113 bits, and else rounded to nearest.
+		// Infinities become NaNs, as ttmath has none
+		template<typename BigType>
+		BigType ToBig() const
+		{
+			BigType result;
+			WriteBig(result);
+			return result;
+		}
+
+		template<ttmath::uint Exponent, ttmath::uint Mantissa>
+		void WriteBig(ttmath::Big<Exponent, Mantissa>& result) const
+		{
+			const int32 biasedExponent = int32((Words[1] >> 48) & 0x7FFF);
+			if (biasedExponent == 0x7FFF)
+			{
+				result.SetNan();
+				return;
+			}
+
+			NativeUInt significand = (NativeUInt(Words[1] & HighFractionMask) << 64) | NativeUInt(Words[0]);
+			if (biasedExponent != 0)
+			{
+				significand |= NativeUInt(1) << (MantissaBits - 1);
+			}
+			if (significand == 0)
+			{
+				result.SetZero();
+				return;
+			}
+			const int64 lowestBitExponent = biasedExponent != 0 ? int64(biasedExponent) - ExponentBias - (MantissaBits - 1) : int64(MinLowestBitExponent);
+
+			// Moves the highest bit to the top of a 128 bits window, that becomes the highest words of the mantissa
+			const uint64 highWord = uint64(significand >> 64);
+			const int32 shift = highWord != 0 ? __builtin_clzll(highWord) : 64 + __builtin_clzll(uint64(significand));
+			significand <<= shift;
+			uint64 high = uint64(significand >> 64);
+			const uint64 low = uint64(significand);
+			int64 exponent = lowestBitExponent - shift - (int64(Mantissa) - 2) * 64;
+
+			result.mantissa.SetZero();
+			if (Mantissa >= 2)
+			{
+				result.mantissa.table[Mantissa - 1] = high;
+				result.mantissa.table[Mantissa >= 2 ? Mantissa - 2 : 0] = low;
+			}
+			else
+			{
+				// A single word mantissa is rounded to nearest, with the halves rounded to even
+				if ((low >> 63) != 0 && ((low << 1) != 0 || (high & 1) != 0))
+				{
+					high++;
+					if (high == 0)
+					{
+						high = SignBit;
+						exponent++;
+					}
+				}
+				result.mantissa.table[0] = high;
+			}
+			result.exponent = ttmath::sint(exponent);
+			result.info = 0;
+			if (IsSign())
+			{
+				result.SetSign();
+			}
+		}
+
+		double ToDouble() const
+		{
+			return double(ToNative());
+		}
+
+		float ToFloat() const
+		{
+			return float(ToNative());
+		}
+
+		// Converts this number to a base-10 string, through its exact ttmath value
+		std::string ToString() const
+		{
+			return ToBig<ExactBigType>().ToString();
+		}
+
+		bool IsSign() const
+		{
+			return (Words[1] & SignBit) != 0;
+		}
+
+		bool IsZero() const
+		{
+			return Words[0] == 0 && (Words[1] & ~SignBit) == 0;
+		}
+
+		bool IsNan() const
+		{
+			return (Words[1] & InfinityHighWord) == InfinityHighWord && (Words[0] != 0 || (Words[1] & HighFractionMask) != 0);
+		}
+	};
+
+	// Arithmetic, on the native numbers
+
+	FORCEINLINE Float128 operator-(const Float128& a)
+	{
+		return Float128::FromWords(a.Words[0], a.Words[1] ^ SignBit);
+	}
+
+	FORCEINLINE Float128 operator+(const Float128& a, const Float128& b)
+	{
+		return Float128::FromNative(a.ToNative() + b.ToNative());
+	}
+
+	FORCEINLINE Float128 operator-(const Float128& a, const Float128& b)
+	{
+		return Float128::FromNative(a.ToNative() - b.ToNative());
+	}
+
+	FORCEINLINE Float128 operator*(const Float128& a, const Float128& b)
+	{
+		return Float128::FromNative(a.ToNative() * b.ToNative());
+	}
+
+	FORCEINLINE Float128 operator/(const Float128& a, const Float128& b)
+	{
+		return Float128::FromNative(a.ToNative() / b.ToNative());
+	}
+
+	FORCEINLINE Float128& operator+=(Float128& a, const Float128& b)
+	{
+		a.SetNative(a.ToNative() + b.ToNative());
+		return a;
+	}
+
+	FORCEINLINE Float128& operator-=(Float128& a, const Float128& b)
+	{
+		a.SetNative(a.ToNative() - b.ToNative());
+		return a;
+	}
+
+	FORCEINLINE Float128& operator*=(Float128& a, const Float128& b)
+	{
+		a.SetNative(a.ToNative() * b.ToNative());
+		return a;
+	}
+
+	FORCEINLINE Float128& operator/=(Float128& a, const Float128& b)
+	{
+		a.SetNative(a.ToNative() / b.ToNative());
+		return a;
+	}
+
+	FORCEINLINE bool operator==(const Float128& a, const Float128& b)
+	{
+		return a.ToNative() == b.ToNative();
+	}
+
+	FORCEINLINE bool operator!=(const Float128& a, const Float128& b)
+	{
+		return a.ToNative() != b.ToNative();
+	}
+
+	FORCEINLINE bool operator<(const Float128& a, const Float128& b)
+	{
+		return a.ToNative() < b.ToNative();
+	}
+
+	FORCEINLINE bool operator>(const Float128& a, const Float128& b)
+	{
+		return a.ToNative() > b.ToNative();
+	}
+
+	FORCEINLINE bool operator<=(const Float128& a, const Float128& b)
+	{
+		return a.ToNative() <= b.ToNative();
+	}
+
+	FORCEINLINE bool operator>=(const Float128& a, const Float128& b)
+	{
+		return a.ToNative() >= b.ToNative();
+	}
+
+	// Math functions. The others are in RealFloatTrigo, RealFloatExpLog and RealFloatSqrt, next to the kernels they fall back to without libquadmath
+
+	inline Float128 Abs(const Float128& a)
+	{
+		return Float128::FromWords(a.Words[0], a.Words[1] & ~SignBit);
+	}
+
+	inline Float128 Sqrt(const Float128& a)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		return Float128::FromNative(sqrtq(a.ToNative()));
+#else
+		return Float128::FromBig(ttmath::Sqrt(a.ToBig<ExactBigType>()));
+#endif
+	}
+
+	inline Float128 Sin(const Float128& a)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		return Float128::FromNative(sinq(a.ToNative()));
+#else
+		return Float128::FromBig(ttmath::Sin(a.ToBig<ExactBigType>()));
+#endif
+	}
+
+	inline Float128 ASin(const Float128& a)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		return Float128::FromNative(asinq(a.ToNative()));
+#else
+		return Float128::FromBig(ttmath::ASin(a.ToBig<ExactBigType>()));
+#endif
+	}
+
+	inline Float128 ACos(const Float128& a)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		return Float128::FromNative(acosq(a.ToNative()));
+#else
+		return Float128::FromBig(ttmath::ACos(a.ToBig<ExactBigType>()));
+#endif
+	}
+}
+
+#endif
@@ -0,0 +1,1017 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/TtmathConfig.h"
+
+#include "Core/Public/HAL/Platform.h"
+#include "CoreMinimal.h"
+
+#include <cmath>
+#include <limits>
+#include <string>
+
+// Whether the CPU is known at compile time to have fused multiply-add instructions.
+// Without them, std::fma is a slow software routine, so products are split in halves instead (Dekker's algorithm).
+#if defined(__FMA__) || defined(__AVX2__)
+#define DDMATH_HARDWARE_FMA 1
+#else
+#define DDMATH_HARDWARE_FMA 0
+#endif
+
+// The error-free transformations below rely on each operation being rounded exactly as IEEE specifies it.
+// UE4 builds with /fp:fast on MSVC, which allows the compiler to simplify them away, so force precise semantics in this file.
+#if defined(_MSC_VER)
+#pragma float_control(precise, on, push)
+#endif
+
+// Multi-double numbers: floating-point numbers made of N hardware doubles, whose exact sum is the value.
+// MultiDouble<2> (double-double) has a 106 bits mantissa, MultiDouble<4> (quad-double) a 212 bits one, but both keep the exponent range of a double.
+// The operations are built on error-free transformations of hardware operations, so they are an order of magnitude faster than software floats.
+// FRealFloat is stored in them with USE_MULTI_DOUBLE_BIG, see PrecisionSettings.h
+namespace ddmath
+{
+	// Error-free transformations. Each of them returns the rounded result of the operation, and sets err so that result + err is the exact result
+
+	FORCEINLINE double TwoSum(double a, double b, double& err)
+	{
+		const double s = a + b;
+		const double bb = s - a;
+		err = (a - (s - bb)) + (b - bb);
+		return s;
+	}
+
+	// Same as TwoSum, but only valid if |a| >= |b|
+	FORCEINLINE double QuickTwoSum(double a, double b, double& err)
+	{
+		const double s = a + b;
+		err = b - (s - a);
+		return s;
+	}
+
+	// Splits a in two halves of 26 bits, so that their products are exact
+	FORCEINLINE void Split(double a, double& hi, double& lo)
+	{
+		const double t = 134217729.0 * a; // 2^27 + 1
+		hi = t - (t - a);
+		lo = a - hi;
+	}
+
+	FORCEINLINE double TwoProd(double a, double b, double& err)
+	{
+		const double p = a * b;
+#if DDMATH_HARDWARE_FMA
+		err = std::fma(a, b, -p);
+#else
+		double aHi, aLo, bHi, bLo;
+		Split(a, aHi, aLo);
+		Split(b, bHi, bLo);
+		err = ((aHi * bHi - p) + aHi * bLo + aLo * bHi) + aLo * bLo;
+#endif
+		return p;
+	}
+
+	template<int N>
+	struct MultiDouble
+	{
+		static_assert(N >= 2, "A multi-double number needs at least two components");
+
+		// Ttmath float type that can store any multi-double number without precision loss (as long as its components are not too far apart)
+		using ttBigType = ttmath::Big<1, TTMATH_BITS(53 * N)>;
+
+		// Components, by decreasing magnitude. Each component is smaller than half a unit in the last place of the previous one
+		double x[N];
+
+		MultiDouble()
+		{
+		}
+
+		MultiDouble(double value)
+		{
+			x[0] = value;
+			for (int32 i = 1; i < N; i++)
+			{
+				x[i] = 0.0;
+			}
+		}
+
+		MultiDouble(float value)
+			: MultiDouble(double(value))
+		{
+		}
+
+		MultiDouble(int32 value)
+			: MultiDouble(double(value))
+		{
+		}
+
+		MultiDouble(uint32 value)
+			: MultiDouble(double(value))
+		{
+		}
+
+		// 64-bits integers don't fit in a double, so split them in two exact halves
+		MultiDouble(int64 value)
+			: MultiDouble(double(value >> 32) * 4294967296.0)
+		{
+			x[0] = TwoSum(x[0], double(uint32(value)), x[1]);
+		}
+
+		MultiDouble(uint64 value)
+			: MultiDouble(double(value >> 32) * 4294967296.0)
+		{
+			x[0] = TwoSum(x[0], double(uint32(value)), x[1]);
+		}
+
+		// Parses a base-10 string representation, using ttmath
+		MultiDouble(const char* string)
+		{
+			*this = FromBig(ttmath::Big<1, TTMATH_BITS(53 * N) + 1>(string));
+		}
+
+		MultiDouble(const std::string& string)
+			: MultiDouble(string.c_str())
+		{
+		}
+
+		template<ttmath::uint Exponent, ttmath::uint Mantissa>
+		explicit MultiDouble(const ttmath::Big<Exponent, Mantissa>& big)
+		{
+			*this = FromBig(big);
+		}
+
+		template<ttmath::uint Exponent, ttmath::uint Mantissa>
+		explicit operator ttmath::Big<Exponent, Mantissa>() const
+		{
+			return ToBig<ttmath::Big<Exponent, Mantissa>>();
+		}
+
+		// Builds the nearest multi-double number from a ttmath float
+		template<ttmath::uint Exponent, ttmath::uint Mantissa>
+		static MultiDouble FromBig(ttmath::Big<Exponent, Mantissa> big)
+		{
+			double terms[N];
+			for (int32 i = 0; i < N; i++)
+			{
+				terms[i] = big.ToDouble();
+				big -= ttmath::Big<Exponent, Mantissa>(terms[i]);
+			}
+			return Renormalize(terms);
+		}
+
+		// Converts this number to a ttmath float, which is exact if BigType's mantissa is big enough
+		template<typename BigType>
+		BigType ToBig() const
+		{
+			BigType result(x[0]);
+			for (int32 i = 1; i < N; i++)
+			{
+				result += BigType(x[i]);
+			}
+			return result;
+		}
+
+		double ToDouble() const
+		{
+			return x[0];
+		}
+
+		float ToFloat() const
+		{
+			return float(x[0]);
+		}
+
+		// Converts this number to a base-10 string, rounded to the number of significant digits the mantissa can hold
+		std::string ToString() const
+		{
+			const ttBigType big = ToBig<ttBigType>();
+			if (x[0] == 0.0 || !std::isfinite(x[0]))
+			{
+				return big.ToString();
+			}
+
+			ttmath::Conv conv;
+			const int32 significantDigits = int32(53 * N * 0.30102999566398120) - 1;
+			const int32 exponent = int32(std::floor(std::log10(std::fabs(x[0]))));
+			// In scientific notation, ttmath rounds the digits after the mantissa's comma, else the ones after the number's comma
+			const bool bScientific = exponent > int32(conv.scient_from) || exponent < -int32(conv.scient_from);
+			conv.round = bScientific ? significantDigits - 1 : FMath::Max(0, significantDigits - 1 - exponent);
+			std::string result = big.ToString(conv);
+
+			// When rounding carries up to a new digit, ttmath doesn't move the exponent: 9.99e-21 becomes 10e-21 instead of 1e-20
+			const size_t mantissaStart = result[0] == '-' ? 1 : 0;
+			if (bScientific && result.compare(mantissaStart, 3, "10e") == 0)
+			{
+				const int32 scientificExponent = std::stoi(result.substr(mantissaStart + 3)) + 1;
+				result = result.substr(0, mantissaStart) + "1e" + (scientificExponent < 0 ? "" : "+") + std::to_string(scientificExponent);
+			}
+			return result;
+		}
+
+		bool IsSign() const
+		{
+			return x[0] < 0.0;
+		}
+
+		bool IsZero() const
+		{
+			return x[0] == 0.0;
+		}
+
+		// Sums terms, given by roughly decreasing magnitude, into a normalized multi-double number
+		template<int32 M>
+		static MultiDouble Renormalize(const double (&terms)[M])
+		{
+			MultiDouble result(0.0);
+			if (!std::isfinite(terms[0]))
+			{
+				result.x[0] = terms[0];
+				return result;
+			}
+
+			// Bottom-up, so every partial sum is exact
+			double partials[M];
+			double sum = terms[M - 1];
+			for (int32 i = M - 2; i >= 0; i--)
+			{
+				sum = QuickTwoSum(terms[i], sum, partials[i + 1]);
+			}
+			partials[0] = sum;
+
+			// Top-down, to make the components non-overlapping
+			int32 k = 0;
+			sum = partials[0];
+			for (int32 i = 1; i < M && k < N; i++)
+			{
+				double err;
+				sum = QuickTwoSum(sum, partials[i], err);
+				if (err != 0.0)
+				{
+					result.x[k++] = sum;
+					sum = err;
+				}
+			}
+			if (k < N)
+			{
+				result.x[k] = sum;
+			}
+			return result;
+		}
+
+		// Multiplies by 2^exponent. This is exact, barring overflow and underflow
+		MultiDouble LdExp(int32 exponent) const
+		{
+			MultiDouble result;
+			for (int32 i = 0; i < N; i++)
+			{
+				result.x[i] = std::ldexp(x[i], exponent);
+			}
+			return result;
+		}
+	};
+
+	using DoubleDouble = MultiDouble<2>;
+	using QuadDouble = MultiDouble<4>;
+
+	// Generic arithmetic, for any number of components
+
+	template<int N>
+	MultiDouble<N> operator-(const MultiDouble<N>& a)
+	{
+		MultiDouble<N> result;
+		for (int32 i = 0; i < N; i++)
+		{
+			result.x[i] = -a.x[i];
+		}
+		return result;
+	}
+
+	// Merges both numbers' components by decreasing magnitude, and accumulates them so cancellations don't lose precision
+	template<int N>
+	MultiDouble<N> operator+(const MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		double terms[N + 1] = {};
+		int32 i = 0, j = 0, k = 0;
+
+		const auto Next = [&]()
+		{
+			if (i >= N)
+			{
+				return b.x[j++];
+			}
+			if (j >= N || std::fabs(a.x[i]) > std::fabs(b.x[j]))
+			{
+				return a.x[i++];
+			}
+			return b.x[j++];
+		};
+
+		double u = Next();
+		double v = Next();
+		u = QuickTwoSum(u, v, v);
+
+		while (true)
+		{
+			if (k == N)
+			{
+				terms[N] = u + v;
+				break;
+			}
+			if (i >= N && j >= N)
+			{
+				terms[k] = u;
+				terms[k + 1] = v;
+				break;
+			}
+
+			// Accumulates the next term into u + v, and outputs the highest component once it can't change anymore
+			double t = Next();
+			double s = TwoSum(v, t, v);
+			s = TwoSum(u, s, u);
+			if (u != 0.0 && v != 0.0)
+			{
+				terms[k++] = s;
+			}
+			else if (v == 0.0)
+			{
+				v = u;
+				u = s;
+			}
+			else
+			{
+				u = s;
+			}
+		}
+
+		// The remaining components are too small to be represented, but their sum may round the last one
+		for (; i < N; i++)
+		{
+			terms[N] += a.x[i];
+		}
+		for (; j < N; j++)
+		{
+			terms[N] += b.x[j];
+		}
+		return MultiDouble<N>::Renormalize(terms);
+	}
+
+	template<int N>
+	MultiDouble<N> operator-(const MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		return a + (-b);
+	}
+
+	// Multiplication by a hardware double. As operator*, the errors of order k are carried to order k + 1
+	template<int N>
+	MultiDouble<N> MulDouble(const MultiDouble<N>& a, double b)
+	{
+		double terms[N + 1];
+		double carried[N + 1], next[N + 1];
+		int32 carriedCount = 0;
+		double productErr = 0.0;
+
+		for (int32 order = 0; order <= N; order++)
+		{
+			double nextProductErr = 0.0;
+			double sum = order < N ? TwoProd(a.x[order], b, nextProductErr) : 0.0;
+			carried[carriedCount++] = productErr;
+			productErr = nextProductErr;
+
+			int32 nextCount = 0;
+			for (int32 t = 0; t < carriedCount; t++)
+			{
+				if (order < N)
+				{
+					sum = TwoSum(sum, carried[t], next[nextCount++]);
+				}
+				else
+				{
+					sum += carried[t];
+				}
+			}
+			terms[order] = sum;
+
+			for (int32 t = 0; t < nextCount; t++)
+			{
+				carried[t] = next[t];
+			}
+			carriedCount = nextCount;
+		}
+
+		return MultiDouble<N>::Renormalize(terms);
+	}
+
+	// Sums the products of the components by order of magnitude: the products of order k are a.x[i] * b.x[k - i].
+	// The errors of the products and of the sums of order k are carried to order k + 1. Orders beyond N are negligible.
+	template<int N>
+	MultiDouble<N> operator*(const MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		const int32 MaxTerms = 2 * N * N + N;
+		double current[MaxTerms], next[MaxTerms];
+		int32 currentCount = 0, nextCount = 0;
+		double orders[N + 1];
+
+		for (int32 order = 0; order <= N; order++)
+		{
+			for (int32 i = 0; i <= order; i++)
+			{
+				if (i < N && order - i < N)
+				{
+					if (order < N)
+					{
+						current[currentCount++] = TwoProd(a.x[i], b.x[order - i], next[nextCount++]);
+					}
+					else
+					{
+						current[currentCount++] = a.x[i] * b.x[order - i];
+					}
+				}
+			}
+
+			double sum = current[0];
+			for (int32 t = 1; t < currentCount; t++)
+			{
+				if (order < N)
+				{
+					sum = TwoSum(sum, current[t], next[nextCount++]);
+				}
+				else
+				{
+					sum += current[t];
+				}
+			}
+			orders[order] = sum;
+
+			// The carried errors become the first terms of the next order
+			for (int32 t = 0; t < nextCount; t++)
+			{
+				current[t] = next[t];
+			}
+			currentCount = nextCount;
+			nextCount = 0;
+		}
+
+		return MultiDouble<N>::Renormalize(orders);
+	}
+
+	// Division by a hardware double, by long division: each quotient component is computed from the remainder of the previous ones
+	template<int N>
+	MultiDouble<N> DivDouble(const MultiDouble<N>& a, double b)
+	{
+		double quotients[N + 1];
+		MultiDouble<N> remainder = a;
+		for (int32 i = 0; i <= N; i++)
+		{
+			quotients[i] = remainder.x[0] / b;
+			if (i < N)
+			{
+				MultiDouble<N> product(0.0);
+				product.x[0] = TwoProd(quotients[i], b, product.x[1]);
+				remainder = remainder - product;
+			}
+		}
+		return MultiDouble<N>::Renormalize(quotients);
+	}
+
+	// Long division, as DivDouble
+	template<int N>
+	MultiDouble<N> operator/(const MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		double quotients[N + 1];
+		MultiDouble<N> remainder = a;
+		for (int32 i = 0; i <= N; i++)
+		{
+			quotients[i] = remainder.x[0] / b.x[0];
+			if (i < N)
+			{
+				remainder = remainder - MulDouble(b, quotients[i]);
+			}
+		}
+		return MultiDouble<N>::Renormalize(quotients);
+	}
+
+	template<int N>
+	MultiDouble<N>& operator+=(MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		return a = a + b;
+	}
+
+	template<int N>
+	MultiDouble<N>& operator-=(MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		return a = a - b;
+	}
+
+	template<int N>
+	MultiDouble<N>& operator*=(MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		return a = a * b;
+	}
+
+	template<int N>
+	MultiDouble<N>& operator/=(MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		return a = a / b;
+	}
+
+	// Double-double arithmetic. These are the classic algorithms (see Hida, Li and Bailey's QD library), much cheaper than the generic ones
+
+	inline DoubleDouble operator+(const DoubleDouble& a, const DoubleDouble& b)
+	{
+		double s2, t2;
+		double s1 = TwoSum(a.x[0], b.x[0], s2);
+		const double t1 = TwoSum(a.x[1], b.x[1], t2);
+		s2 += t1;
+		s1 = QuickTwoSum(s1, s2, s2);
+		s2 += t2;
+
+		DoubleDouble result;
+		result.x[0] = QuickTwoSum(s1, s2, result.x[1]);
+		return result;
+	}
+
+	inline DoubleDouble operator-(const DoubleDouble& a, const DoubleDouble& b)
+	{
+		return a + (-b);
+	}
+
+	inline DoubleDouble MulDouble(const DoubleDouble& a, double b)
+	{
+		double p2;
+		const double p1 = TwoProd(a.x[0], b, p2);
+		p2 += a.x[1] * b;
+
+		DoubleDouble result;
+		result.x[0] = QuickTwoSum(p1, p2, result.x[1]);
+		return result;
+	}
+
+	inline DoubleDouble operator*(const DoubleDouble& a, const DoubleDouble& b)
+	{
+		double p2;
+		const double p1 = TwoProd(a.x[0], b.x[0], p2);
+		p2 += a.x[0] * b.x[1] + a.x[1] * b.x[0];
+
+		DoubleDouble result;
+		result.x[0] = QuickTwoSum(p1, p2, result.x[1]);
+		return result;
+	}
+
+	inline DoubleDouble operator/(const DoubleDouble& a, const DoubleDouble& b)
+	{
+		const double q1 = a.x[0] / b.x[0];
+		DoubleDouble remainder = a - MulDouble(b, q1);
+		const double q2 = remainder.x[0] / b.x[0];
+		remainder = remainder - MulDouble(b, q2);
+		const double q3 = remainder.x[0] / b.x[0];
+
+		DoubleDouble result;
+		result.x[0] = QuickTwoSum(q1, q2, result.x[1]);
+		return result + DoubleDouble(q3);
+	}
+
+	// Quad-double multiplication, from the QD library too. The generic one is a long chain of dependent sums, this one computes the orders in parallel
+
+	// Sums a, b and c into a + b + c, so that a is the rounded sum and b and c the errors
+	FORCEINLINE void ThreeSum(double& a, double& b, double& c)
+	{
+		double t2, t3;
+		const double t1 = TwoSum(a, b, t2);
+		a = TwoSum(c, t1, t3);
+		b = TwoSum(t2, t3, c);
+	}
+
+	inline QuadDouble operator*(const QuadDouble& a, const QuadDouble& b)
+	{
+		double q0, q1, q2, q3, q4, q5, q6, q7, q8, q9;
+		const double p0 = TwoProd(a.x[0], b.x[0], q0);
+
+		double p1 = TwoProd(a.x[0], b.x[1], q1);
+		double p2 = TwoProd(a.x[1], b.x[0], q2);
+
+		double p3 = TwoProd(a.x[0], b.x[2], q3);
+		double p4 = TwoProd(a.x[1], b.x[1], q4);
+		double p5 = TwoProd(a.x[2], b.x[0], q5);
+
+		// Order 1
+		ThreeSum(p1, p2, q0);
+
+		// Order 2: p2, q1, q2, p3, p4 and p5 into s0, s1 and s2
+		double t0, t1;
+		ThreeSum(p2, q1, q2);
+		ThreeSum(p3, p4, p5);
+		const double s0 = TwoSum(p2, p3, t0);
+		double s1 = TwoSum(q1, p4, t1);
+		double s2 = q2 + p5;
+		s1 = TwoSum(s1, t0, t0);
+		s2 += t0 + t1;
+
+		// Order 3: q0, s1, q3, q4, q5 and the products of order 3 into t0 and t1
+		double p6 = TwoProd(a.x[0], b.x[3], q6);
+		double p7 = TwoProd(a.x[1], b.x[2], q7);
+		double p8 = TwoProd(a.x[2], b.x[1], q8);
+		double p9 = TwoProd(a.x[3], b.x[0], q9);
+
+		q0 = TwoSum(q0, q3, q3);
+		q4 = TwoSum(q4, q5, q5);
+		p6 = TwoSum(p6, p7, p7);
+		p8 = TwoSum(p8, p9, p9);
+
+		t0 = TwoSum(q0, q4, t1);
+		t1 += q3 + q5;
+		double r1;
+		const double r0 = TwoSum(p6, p8, r1);
+		r1 += p7 + p9;
+		q3 = TwoSum(t0, r0, q4);
+		q4 += t1 + r1;
+		t0 = TwoSum(q3, s1, t1);
+		t1 += q4;
+
+		// Order 4, without the errors
+		t1 += a.x[1] * b.x[3] + a.x[2] * b.x[2] + a.x[3] * b.x[1] + q6 + q7 + q8 + q9 + s2;
+
+		const double terms[5] = { p0, p1, s0, t0, t1 };
+		return QuadDouble::Renormalize(terms);
+	}
+
+	// Comparisons. Components are normalized, so they can be compared one by one
+
+	template<int N>
+	bool operator==(const MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		for (int32 i = 0; i < N; i++)
+		{
+			if (a.x[i] != b.x[i])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<int N>
+	bool operator!=(const MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		return !(a == b);
+	}
+
+	template<int N>
+	bool operator<(const MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		for (int32 i = 0; i < N; i++)
+		{
+			if (a.x[i] != b.x[i])
+			{
+				return a.x[i] < b.x[i];
+			}
+		}
+		return false;
+	}
+
+	template<int N>
+	bool operator>(const MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		return b < a;
+	}
+
+	template<int N>
+	bool operator<=(const MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		return !(b < a);
+	}
+
+	template<int N>
+	bool operator>=(const MultiDouble<N>& a, const MultiDouble<N>& b)
+	{
+		return !(a < b);
+	}
+
+	// Constants, computed once at full precision by ttmath
+
+	template<int N>
+	const MultiDouble<N>& PiConstant()
+	{
+		static const MultiDouble<N> Value = []()
+		{
+			ttmath::Big<1, TTMATH_BITS(53 * N) + 1> big;
+			big.SetPi();
+			return MultiDouble<N>::FromBig(big);
+		}();
+		return Value;
+	}
+
+	template<int N>
+	const MultiDouble<N>& Ln2Constant()
+	{
+		static const MultiDouble<N> Value = []()
+		{
+			ttmath::Big<1, TTMATH_BITS(53 * N) + 1> big;
+			big.SetLn2();
+			return MultiDouble<N>::FromBig(big);
+		}();
+		return Value;
+	}
+
+	// Relative precision of a multi-double number
+	template<int N>
+	double Epsilon()
+	{
+		return std::ldexp(1.0, -53 * N);
+	}
+
+	// Math functions. The reductions of Exp, Ln and SinCos use the constants above
+
+	template<int N>
+	MultiDouble<N> Abs(const MultiDouble<N>& a)
+	{
+		return a.IsSign() ? -a : a;
+	}
+
+	// Floors the components from the biggest one, until one isn't an integer: the smaller ones can't bring the sum to another integer then
+	template<int N>
+	MultiDouble<N> Floor(const MultiDouble<N>& a)
+	{
+		double terms[N];
+		bool bInteger = true;
+		for (int32 i = 0; i < N; i++)
+		{
+			terms[i] = bInteger ? std::floor(a.x[i]) : 0.0;
+			bInteger = bInteger && terms[i] == a.x[i];
+		}
+		return MultiDouble<N>::Renormalize(terms);
+	}
+
+	// Newton iterations from the hardware square root: each one doubles the number of correct bits
+	template<int N>
+	MultiDouble<N> Sqrt(const MultiDouble<N>& a)
+	{
+		if (a.IsZero())
+		{
+			return MultiDouble<N>(0.0);
+		}
+		if (a.IsSign())
+		{
+			return MultiDouble<N>(std::numeric_limits<double>::quiet_NaN());
+		}
+
+		// Iterate on the inverse square root, which doesn't need divisions: r = r + r * (1 - a * r^2) / 2
+		MultiDouble<N> r(1.0 / std::sqrt(a.x[0]));
+		for (int32 bits = 53; bits < 53 * N; bits *= 2)
+		{
+			r = r + MulDouble(r * (MultiDouble<N>(1.0) - a * r * r), 0.5);
+		}
+
+		// Then a last Karp-Markstein step to get the square root itself
+		const MultiDouble<N> root = a * r;
+		return root + MulDouble(r * (a - root * root), 0.5);
+	}
+
+	// Reduces a to r so that a = k * ln(2) + r, then computes e^r with a Taylor series on r / 2^10, and squares it back
+	template<int N>
+	MultiDouble<N> Exp(const MultiDouble<N>& a)
+	{
+		if (a.x[0] > 709.79)
+		{
+			return MultiDouble<N>(std::numeric_limits<double>::infinity());
+		}
+		if (a.x[0] < -745.2)
+		{
+			return MultiDouble<N>(0.0);
+		}
+
+		const double k = std::floor(a.x[0] / Ln2Constant<N>().x[0] + 0.5);
+		const int32 ScaleBits = 10;
+		const MultiDouble<N> r = (a - MulDouble(Ln2Constant<N>(), k)).LdExp(-ScaleBits);
+
+		// e^r - 1, to keep the precision when squaring back
+		MultiDouble<N> term = r;
+		MultiDouble<N> sum = r;
+		for (int32 i = 2; std::fabs(term.x[0]) > std::fabs(sum.x[0]) * Epsilon<N>(); i++)
+		{
+			term = DivDouble(term * r, double(i));
+			sum = sum + term;
+		}
+
+		// (1 + s)^2 - 1 = s * (s + 2)
+		for (int32 i = 0; i < ScaleBits; i++)
+		{
+			sum = sum * (sum + MultiDouble<N>(2.0));
+		}
+
+		return (sum + MultiDouble<N>(1.0)).LdExp(int32(k));
+	}
+
+	// Reduces a to m so that a = 2^k * m, with m close to 1, then does Newton iterations on e^y = m from the hardware logarithm.
+	// The error of each iteration is proportional to y^2, so the reduction is what lets them converge to the full precision
+	template<int N>
+	MultiDouble<N> Ln(const MultiDouble<N>& a)
+	{
+		if (a.IsZero())
+		{
+			return MultiDouble<N>(-std::numeric_limits<double>::infinity());
+		}
+		if (a.IsSign())
+		{
+			return MultiDouble<N>(std::numeric_limits<double>::quiet_NaN());
+		}
+
+		int32 k;
+		const double fraction = std::frexp(a.x[0], &k);
+		if (fraction < 0.70710678118654752)
+		{
+			k--;
+		}
+		const MultiDouble<N> m = a.LdExp(-k);
+
+		MultiDouble<N> y(std::log(m.x[0]));
+		for (int32 bits = 53; bits < 53 * N; bits *= 2)
+		{
+			y = y + m * Exp(-y) - MultiDouble<N>(1.0);
+		}
+		return y + MulDouble(Ln2Constant<N>(), double(k));
+	}
+
+	template<int N>
+	MultiDouble<N> Log(const MultiDouble<N>& a, const MultiDouble<N>& base)
+	{
+		return Ln(a) / Ln(base);
+	}
+
+	// Computes both the sine and the cosine of a.
+	// a is reduced modulo pi/2 to |r| <= pi/4, then both Taylor series are summed on r, and swapped according to the quadrant
+	template<int N>
+	void SinCos(const MultiDouble<N>& a, MultiDouble<N>& outSin, MultiDouble<N>& outCos)
+	{
+		if (a.IsZero())
+		{
+			outSin = MultiDouble<N>(0.0);
+			outCos = MultiDouble<N>(1.0);
+			return;
+		}
+
+		// Quadrants below 2^52 are exact in a double, and the reduction loses as many bits as they have
+		const double quadrant = std::floor(a.x[0] / (PiConstant<N>().x[0] * 0.5) + 0.5);
+		int64 quadrantModulo;
+		MultiDouble<N> r;
+		if (std::fabs(quadrant) < 4503599627370496.0)
+		{
+			r = a - MulDouble(PiConstant<N>(), 0.5 * quadrant);
+			quadrantModulo = int64(quadrant);
+		}
+		else
+		{
+			// Bigger ones need all the components of a, and would cancel most of a's bits, so reduce with twice as many components
+			MultiDouble<2 * N> wideA(0.0);
+			for (int32 i = 0; i < N; i++)
+			{
+				wideA.x[i] = a.x[i];
+			}
+			const MultiDouble<2 * N> wideHalfPi = MulDouble(PiConstant<2 * N>(), 0.5);
+			const MultiDouble<2 * N> wideQuadrant = Floor(wideA / wideHalfPi + MultiDouble<2 * N>(0.5));
+			const MultiDouble<2 * N> wideR = wideA - wideQuadrant * wideHalfPi;
+			for (int32 i = 0; i < N; i++)
+			{
+				r.x[i] = wideR.x[i];
+			}
+
+			// The quadrant's components are all integers, so its remainder modulo 4 is the sum of theirs
+			quadrantModulo = 0;
+			for (int32 i = 0; i < 2 * N; i++)
+			{
+				quadrantModulo += int64(std::fmod(wideQuadrant.x[i], 4.0));
+			}
+		}
+		const MultiDouble<N> r2 = r * r;
+
+		MultiDouble<N> sinTerm = r;
+		MultiDouble<N> sinSum = r;
+		MultiDouble<N> cosTerm(1.0);
+		MultiDouble<N> cosSum(1.0);
+		for (int32 i = 1; std::fabs(cosTerm.x[0]) > Epsilon<N>() * 0.5; i++)
+		{
+			sinTerm = -DivDouble(sinTerm * r2, double((2 * i) * (2 * i + 1)));
+			sinSum = sinSum + sinTerm;
+			cosTerm = -DivDouble(cosTerm * r2, double((2 * i - 1) * (2 * i)));
+			cosSum = cosSum + cosTerm;
+		}
+
+		switch (quadrantModulo & 3)
+		{
+		case 1:
+			outSin = cosSum;
+			outCos = -sinSum;
+			break;
+		case 2:
+			outSin = -sinSum;
+			outCos = -cosSum;
+			break;
+		case 3:
+			outSin = -cosSum;
+			outCos = sinSum;
+			break;
+		default:
+			outSin = sinSum;
+			outCos = cosSum;
+			break;
+		}
+	}
+
+	template<int N>
+	MultiDouble<N> Sin(const MultiDouble<N>& a)
+	{
+		MultiDouble<N> sin, cos;
+		SinCos(a, sin, cos);
+		return sin;
+	}
+
+	template<int N>
+	MultiDouble<N> Cos(const MultiDouble<N>& a)
+	{
+		MultiDouble<N> sin, cos;
+		SinCos(a, sin, cos);
+		return cos;
+	}
+
+	template<int N>
+	MultiDouble<N> Tan(const MultiDouble<N>& a)
+	{
+		MultiDouble<N> sin, cos;
+		SinCos(a, sin, cos);
+		return sin / cos;
+	}
+
+	// Newton iterations on the angle of the point (x, y) projected on the unit circle, from the hardware atan2
+	template<int N>
+	MultiDouble<N> ATan2(const MultiDouble<N>& y, const MultiDouble<N>& x)
+	{
+		if (x.IsZero())
+		{
+			if (y.IsZero())
+			{
+				return MultiDouble<N>(0.0);
+			}
+			return y.IsSign() ? -MulDouble(PiConstant<N>(), 0.5) : MulDouble(PiConstant<N>(), 0.5);
+		}
+		if (y.IsZero())
+		{
+			return x.IsSign() ? PiConstant<N>() : MultiDouble<N>(0.0);
+		}
+
+		// Scaled by a power of 2 to bring the largest of them around 1, so that the squares can't overflow, nor both underflow
+		int32 exponent;
+		std::frexp(std::fmax(std::fabs(x.x[0]), std::fabs(y.x[0])), &exponent);
+		const MultiDouble<N> scaledX = x.LdExp(-exponent);
+		const MultiDouble<N> scaledY = y.LdExp(-exponent);
+		const MultiDouble<N> radius = Sqrt(scaledX * scaledX + scaledY * scaledY);
+		const MultiDouble<N> unitX = scaledX / radius;
+		const MultiDouble<N> unitY = scaledY / radius;
+
+		MultiDouble<N> angle(std::atan2(y.x[0], x.x[0]));
+		for (int32 bits = 53; bits < 53 * N; bits *= 2)
+		{
+			MultiDouble<N> sin, cos;
+			SinCos(angle, sin, cos);
+
+			// Use the most precise of the two equations, sin(angle) = unitY or cos(angle) = unitX
+			if (std::fabs(unitX.x[0]) > std::fabs(unitY.x[0]))
+			{
+				angle = angle + (unitY - sin) / cos;
+			}
+			else
+			{
+				angle = angle - (unitX - cos) / sin;
+			}
+		}
+		return angle;
+	}
+
+	template<int N>
+	MultiDouble<N> ATan(const MultiDouble<N>& a)
+	{
+		return ATan2(a, MultiDouble<N>(1.0));
+	}
+
+	template<int N>
+	MultiDouble<N> ASin(const MultiDouble<N>& a)
+	{
+		if (std::fabs(a.x[0]) > 1.0)
+		{
+			return MultiDouble<N>(std::numeric_limits<double>::quiet_NaN());
+		}
+		return ATan2(a, Sqrt(MultiDouble<N>(1.0) - a * a));
+	}
+
+	template<int N>
+	MultiDouble<N> ACos(const MultiDouble<N>& a)
+	{
+		if (std::fabs(a.x[0]) > 1.0)
+		{
+			return MultiDouble<N>(std::numeric_limits<double>::quiet_NaN());
+		}
+		return ATan2(Sqrt(MultiDouble<N>(1.0) - a * a), a);
+	}
+}
+
+#if defined(_MSC_VER)
+#pragma float_control(pop)
+#endif
@@ -2,6 +2,9 @@
 #include "CoreMinimal.h"
 #include "RealFixedGeneric.h"
 
+// These settings are the precisions of the Blueprint-facing types (FRealFixed, FRealFloat, and the vectors built on them).
+// C++ code that needs a different precision for some values can use TRealFixed, TRealFloat and TVectorFixed side by side with them.
+
 // Parameters for real_fixed. Exponent size is 64 bits, which is the minimum
 // We want a 128 bits wide mantissa, as a 64 mantissa is too small, and 192 is overkill.
 // 102 bits mantissa and 26 exponent seems like a fair tradeoff between precision and upper bound:
@@ -17,5 +20,32 @@ using real_fixed_type = real_fixed<REAL_FIXED_MANTISSA_SIZE, REAL_FIXED_EXPONENT
 // Parameters for boost cpp_bin_float. Default is 192
 #define BOOST_REAL_FLOAT_SIZE 192
 
+// Whether boost numbers keep their expression templates (boost::multiprecision::et_on). Default is 0
+// Expressions on the storage are then evaluated when they are assigned, into the result's storage, instead of materializing every intermediate.
+// FRealFloat's operators evaluate them straight into the new FRealFloat. cpp_bin_float doesn't allocate, so intermediates are cheap, and the
+// BoostExpressionTemplates benchmark shows no measurable gain on vector and quaternion math at 192 bits: this is only worth trying at larger sizes
+#define BOOST_EXPRESSION_TEMPLATES 0
+
 // Parameters for ttmath Big float. Exponent size is 64 bits, which is the minimum
 #define TT_REAL_FLOAT_SIZE 128
+
+// Whether to use multi-double numbers (see MultiDouble.h) for FRealFloat instead of ttmath Big. Default is 0
+// They are several times faster, as they only use hardware floating-point operations, but keep the exponent range of a double (about 1e+-308).
+// Changing the storage changes the binary layout of FRealFloat, so values saved as binary have to be re-saved. Text exports are unaffected.
+#define USE_MULTI_DOUBLE_BIG 0
+
+// Number of doubles in a multi-double number: 2 (double-double) has 106 bits of mantissa, 4 (quad-double) 212 bits. Default is 2
+// Double-double is the fast one. Quad-double arithmetic is about as fast as ttmath's, only its square root and transcendental functions are faster.
+#define MULTI_DOUBLE_SIZE 2
+
+// Whether to use IEEE binary128 numbers (__float128) for FRealFloat instead of ttmath Big. Default is 0
+// They have a 113 bits mantissa (less than the default ttmath storage), and an exponent range of about 1e+-4932. GCC and Clang generate their arithmetic in software, which is about twice as fast as ttmath's.
+// Their transcendental functions come from libquadmath if it's linked (see SpaceKitPrecision.Build.cs), else from the ttmath kernels.
+// Compilers without __float128 (MSVC) keep the ttmath storage. Like multi-doubles, this changes the binary layout of FRealFloat
+#define USE_FLOAT128_BIG 0
+
+// Largest relative rounding error under which FRealHybrid keeps a double, for the results of operations and for the FRealFloat values it's set to (see RealHybridGeneric.h). Default is 0
+// With 0, FRealHybrid numbers are exactly the FRealFloat ones: a number is only a double if it's exact, and inexact results are promoted. Values that add up inexact results,
+// like velocities over time steps, are then promoted once and seldom come back, so they cost more than plain FRealFloat values.
+// Doubles are within 2^-52 of any number in their range, so from 2.2e-16 on, numbers are doubles unless they leave that range, and their rounding errors accumulate as with plain doubles.
+#define HYBRID_FLOAT_MAX_RELATIVE_ERROR 0
@@ -43,11 +43,10 @@ public:
     }
 
     // Builds a quaternion from a rotation axis, and the angle to rotate. Axis is expected to be normalized!
-    FQuatFloat(const FVectorFloat& Axis, FRealFloat AngleDeg)
+    FQuatFloat(const FVectorFloat& Axis, const FRealFloat& AngleDeg)
     {
-        const FRealFloat HalfAngle = 0.5_fl * AngleDeg;
-        const FRealFloat Cos = URealFloatMath::CosDeg(HalfAngle);
-        const FRealFloat Sin = URealFloatMath::SinDeg(HalfAngle);
+        FRealFloat Sin, Cos;
+        URealFloatMath::SinCosDeg(0.5_fl * AngleDeg, Sin, Cos);
 
         X = Sin * Axis.X;
         Y = Sin * Axis.Y;
@@ -67,41 +66,32 @@ public:
     // Rotates a given vector by this quaternion
     FVectorFloat RotateVector(const FVectorFloat& Vec) const
     {
-        const FVectorFloat Q(X, Y, Z);
-        const FVectorFloat T = FVectorFloat::CrossProduct(Q, Vec) * 2_fl;
-        return Vec + (T * W) + FVectorFloat::CrossProduct(Q, T);
+        return RotateVector(Vec, FVectorFloat(X, Y, Z));
     }
 
 	// Rotates backward a given vector by this quaternion, so that for a given quaternion Q and a given vector V, UnrotateVector(RotateVector(V)) = V
     FVectorFloat UnrotateVector(const FVectorFloat& Vec) const
     {
-        const FVectorFloat Q(-X, -Y, -Z);
-        const FVectorFloat T = FVectorFloat::CrossProduct(Q, Vec) * 2_fl;
-        return Vec + (T * W) + FVectorFloat::CrossProduct(Q, T);
+        return RotateVector(Vec, FVectorFloat(-X, -Y, -Z));
     }
 
 	// Normalizes this quaternion. Note that you can only apply a rotation to a vector using a normalized quaternion. Not normalized quaternion's results are undefined
     FQuatFloat GetNormalized()
     {
-        const FRealFloat Size = URealFloatMath::Sqrt(X * X + Y * Y + Z * Z + W * W);
-        return FQuatFloat(X / Size, Y / Size, Z / Size, W / Size);
+        const FRealFloat InvSize = URealFloatMath::InvSqrt(URealFloatMath::SumOfProducts(X, X, Y, Y, Z, Z, W, W));
+        return FQuatFloat(X * InvSize, Y * InvSize, Z * InvSize, W * InvSize);
     }
 
     // Combines two quaternions, so that for given quaternions Q1 and Q2, and QR = Q1*Q2, QR's rotation corresponds to applying the rotation of Q1, then the rotation of Q2
-    FQuatFloat operator*(const FQuatFloat& Other)
+    // Each component is rounded only once, see URealFloatMath::SumOfProducts
+    FQuatFloat operator*(const FQuatFloat& Other) const
     {
-        const FRealFloat T0 = (Z - Y) * (Other.Y - Other.Z);
-        const FRealFloat T1 = (W + X) * (Other.W + Other.X);
-        const FRealFloat T2 = (W - X) * (Other.Y + Other.Z);
-        const FRealFloat T3 = (Y + Z) * (Other.W - Other.X);
-        const FRealFloat T4 = (Z - X) * (Other.X - Other.Y);
-        const FRealFloat T5 = (Z + X) * (Other.X + Other.Y);
-        const FRealFloat T6 = (W + Y) * (Other.W - Other.Z);
-        const FRealFloat T7 = (W - Y) * (Other.W + Other.Z);
-        const FRealFloat T8 = T5 + T6 + T7;
-        const FRealFloat T9 = 0.5_fl * (T4 + T8);
-
-        return FQuatFloat(T1 + T9 - T8, T2 + T9 - T7, T3 + T9 - T6, T0 + T9 - T5);
+        return FQuatFloat(
+            URealFloatMath::SumOfProducts(W, Other.X, X, Other.W, Y, Other.Z, -Z, Other.Y),
+            URealFloatMath::SumOfProducts(W, Other.Y, -X, Other.Z, Y, Other.W, Z, Other.X),
+            URealFloatMath::SumOfProducts(W, Other.Z, X, Other.Y, -Y, Other.X, Z, Other.W),
+            URealFloatMath::SumOfProducts(W, Other.W, -X, Other.X, -Y, Other.Y, -Z, Other.Z)
+        );
     }
 
 	// Create a quaternion from a coordinate system, using two vectors (the third will be computed).
@@ -128,11 +118,12 @@ public:
         const int32 j = nxt[i];
         const int32 k = nxt[j];
 
-        const FRealFloat InvS = 1_fl / URealFloatMath::Sqrt(M[i][i] - M[j][j] - M[k][k] + 1_fl);
+        const FRealFloat Trace = M[i][i] - M[j][j] - M[k][k] + 1_fl;
+        const FRealFloat InvS = URealFloatMath::InvSqrt(Trace);
         const FRealFloat s = 0.5_fl * InvS;
 
         FRealFloat qt[4];
-        qt[i] = 0.5_fl / InvS;
+        qt[i] = Trace * s;
         qt[3] = (M[j][k] - M[k][j]) * s;
         qt[j] = (M[i][j] + M[j][i]) * s;
         qt[k] = (M[i][k] + M[k][i]) * s;
@@ -155,11 +146,12 @@ public:
     // Gets the axis and angle
     void ToAxisAndAngle(FVectorFloat& OutAxis, FRealFloat& OutAngle) const
     {
-        const FRealFloat Size = URealFloatMath::Sqrt(FMath::Max(1_fl - (W * W), 0_fl));
+        const FRealFloat SizeSquared = FMath::Max(1_fl - (W * W), 0_fl);
 
-        if (Size >= FRealFloat(1e-14))
+        if (SizeSquared >= FRealFloat(1e-28))
         {
-            OutAxis = FVectorFloat(X / Size, Y / Size, Z / Size);
+            const FRealFloat InvSize = URealFloatMath::InvSqrt(SizeSquared);
+            OutAxis = FVectorFloat(X * InvSize, Y * InvSize, Z * InvSize);
         }
         else
         {
@@ -173,6 +165,25 @@ public:
     {
         return FQuatFloat(-X, -Y, -Z, W);
     }
+
+private:
+
+    // Computes Vec + 2 * W * (Q ^ Vec) + 2 * Q ^ (Q ^ Vec), where Q is the vector part of this quaternion, or its opposite to unrotate
+    FVectorFloat RotateVector(const FVectorFloat& Vec, const FVectorFloat& Q) const
+    {
+        const FVectorFloat T = FVectorFloat::CrossProduct(Q, Vec) * 2_fl;
+        return FVectorFloat(
+            URealFloatMath::SumOfProducts(Vec.X, FRealFloat(1), T.X, W, Q.Y, T.Z, -Q.Z, T.Y),
+            URealFloatMath::SumOfProducts(Vec.Y, FRealFloat(1), T.Y, W, Q.Z, T.X, -Q.X, T.Z),
+            URealFloatMath::SumOfProducts(Vec.Z, FRealFloat(1), T.Z, W, Q.X, T.Y, -Q.Y, T.X)
+        );
+    }
+};
+
+template<>
+struct TIsPODType<FQuatFloat>
+{
+    enum { Value = true };
 };
 
 struct FRotatorFloat;
@@ -213,6 +224,6 @@ public:
     static bool QuatNotEqualsQuat(const FQuatFloat& First, const FQuatFloat& Second, const FRealFloat& Tolerance);
 
 	UFUNCTION(BlueprintPure, category = "QuatFloat", meta = (DisplayName = "QuatFloat != QuatFloat", CompactNodeTitle = "!="))
-    static FQuatFloat Slerp(FQuatFloat First, FQuatFloat Second, const FRealFloat& Alpha);
+    static FQuatFloat Slerp(const FQuatFloat& First, const FQuatFloat& Second, const FRealFloat& Alpha);
 
 };
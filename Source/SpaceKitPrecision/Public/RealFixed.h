@@ -23,21 +23,39 @@ struct SPACEKITPRECISION_API FRealFixed
  * After a LOT of trial and error, we chose this solution to interface big numbers to UE4:
  * It permits to serialize data automatically, in a way that works with all UE4 systems, including FProperty (only using a custom serializer is not sufficient for editor related stuff).
  * The idea here is to store the data in a c-style (stack allocated) array, that will be used by UE4 internally.
- * It's exposed, for *internal* C++ usage, with the Value reference, that is just a reinterpret_cast reference to the bytes of InternalValue.
+ * It's exposed, for *internal* C++ usage, with GetValue(), that just reinterpret_casts the bytes of InternalValue.
+ * There is no other member, so FRealFixed is exactly as big as real_fixed_type, and is trivially copyable: arrays of it can be memcpy'd and relocated in bulk.
+ * TIsPODType says so to UE4's containers, for FRealFixed and for the vectors made only of it.
  */
 protected:
     UPROPERTY()
     uint8 InternalValue[sizeof real_fixed_type];
+
 public:
-    real_fixed_type& Value;
+
+    FORCEINLINE real_fixed_type& GetValue()
+    {
+        return *reinterpret_cast<real_fixed_type*>(InternalValue);
+    }
+
+    FORCEINLINE const real_fixed_type& GetValue() const
+    {
+        return *reinterpret_cast<const real_fixed_type*>(InternalValue);
+    }
 
 public:
 
     FRealFixed();
 
-    FRealFixed(const FRealFixed& InValue);
+    FRealFixed(const FRealFixed& InValue) = default;
 
-	explicit FRealFixed(const real_fixed_type& InValue);
+    FRealFixed(FRealFixed&& InValue) = default;
+
+    // Inline, as every operator builds its result with it
+    explicit FRealFixed(const real_fixed_type& InValue)
+    {
+        GetValue() = InValue;
+    }
 
     explicit FRealFixed(int32 InValue);
 
@@ -53,11 +71,23 @@ public:
 
     explicit FRealFixed(const FString& InValue);
 
-    FRealFixed& operator=(const FRealFixed& Other)
+    // Converts a fixed-point number of any precision to this one's. See real_fixed's conversion constructor
+    template<int MantissaSize, int Exponent>
+    explicit FRealFixed(const TRealFixed<MantissaSize, Exponent>& InValue)
+        : FRealFixed(real_fixed_type(InValue))
     {
-        Value = Other.Value;
-        return *this;
-    };
+    }
+
+    FRealFixed& operator=(const FRealFixed& Other) = default;
+
+    FRealFixed& operator=(FRealFixed&& Other) = default;
+
+    // Converts this number to a fixed-point number of any precision
+    template<int MantissaSize, int Exponent>
+    explicit operator TRealFixed<MantissaSize, Exponent>() const
+    {
+        return TRealFixed<MantissaSize, Exponent>(GetValue());
+    }
 
     // Converts this number to a double number. Note that this can lead to huge precision loss
     double ToDouble() const;
@@ -68,6 +98,23 @@ public:
     // Converts this number to a floating-point big number. This may not lead to precision loss
     real_fixed_type::ttBigType ToBig() const;
 
+    // Size of the buffers ToChars writes to, in characters, including the null terminator
+    static constexpr int32 StringBufferSize = real_fixed_type::StringBufferSize;
+
+    // Writes this number in base 10 to Buffer, which must hold StringBufferSize characters, without allocating. Returns the number of characters written.
+    // See real_fixed::ToChars
+    int32 ToChars(TCHAR* Buffer) const
+    {
+        return GetValue().ToChars(Buffer);
+    }
+
+    // Reads a base 10 number at Buffer, without allocating, and moves Buffer past it. Returns false if there is no number there.
+    // See real_fixed::InitFromChars
+    bool InitFromChars(const TCHAR*& Buffer)
+    {
+        return GetValue().InitFromChars(Buffer);
+    }
+
     FString ToString() const;
 
     explicit operator int32() const
@@ -89,9 +136,31 @@ public:
     }
 };
 
-FRealFixed operator""_fx(const char* str);
+// Each literal is parsed once, the first time its expression runs: every literal has its own instantiation, and so its own static value
+template<char... Chars>
+FRealFixed operator""_fx()
+{
+    static const char String[] = { Chars..., '\0' };
+    static const FRealFixed Value(String);
+    return Value;
+}
+
+static_assert(sizeof(FRealFixed) == sizeof(real_fixed_type), "FRealFixed must not add any overhead to its storage");
 
-// Type traits, so UE4 knows FRealFixed implements ExportTextItem and ImportTextItem
+template<>
+struct TIsPODType<FRealFixed>
+{
+    enum { Value = true };
+};
+
+template<>
+struct TCanBulkSerialize<FRealFixed>
+{
+    enum { Value = true };
+};
+
+// Type traits, so UE4 knows FRealFixed implements ExportTextItem and ImportTextItem.
+// A zeroed mantissa is the number 0, so FRealFixed can also be zero-constructed.
 template<>
 struct TStructOpsTypeTraits<FRealFixed> : public TStructOpsTypeTraitsBase2<FRealFixed>
 {
@@ -99,22 +168,25 @@ struct TStructOpsTypeTraits<FRealFixed> : public TStructOpsTypeTraitsBase2<FReal
     {
         WithExportTextItem = true,
         WithImportTextItem = true,
+        WithZeroConstructor = true,
+        WithNoDestructor = true,
     };
 };
 
 inline FRealFixed operator+(const FRealFixed& x, const FRealFixed& y)
 {
-    return FRealFixed(x.Value + y.Value);
+    return FRealFixed(x.GetValue() + y.GetValue());
 }
 
-inline FRealFixed operator+=(FRealFixed& x, const FRealFixed& y)
+inline FRealFixed& operator+=(FRealFixed& x, const FRealFixed& y)
 {
-    return x = x + y;
+    x.GetValue() += y.GetValue();
+    return x;
 }
 
 inline FRealFixed operator-(const FRealFixed& x, const FRealFixed& y)
 {
-    return FRealFixed(x.Value - y.Value);
+    return FRealFixed(x.GetValue() - y.GetValue());
 }
 
 inline FRealFixed operator-(double x, const FRealFixed& y)
@@ -122,69 +194,102 @@ inline FRealFixed operator-(double x, const FRealFixed& y)
     return FRealFixed(x) - y;
 }
 
-inline FRealFixed operator-=(FRealFixed& x, const FRealFixed& y)
+inline FRealFixed& operator-=(FRealFixed& x, const FRealFixed& y)
 {
-    return x = FRealFixed(x - y);
+    x.GetValue() -= y.GetValue();
+    return x;
 }
 
 inline FRealFixed operator-(const FRealFixed& x)
 {
-    return FRealFixed(-x.Value);
+    return FRealFixed(-x.GetValue());
 }
 
 inline FRealFixed operator*(const FRealFixed& x, const FRealFixed& y)
 {
-    return FRealFixed(x.Value * y.Value);
+    return FRealFixed(x.GetValue() * y.GetValue());
 }
 
-inline FRealFixed operator*=(FRealFixed& x, const FRealFixed& y)
+inline FRealFixed& operator*=(FRealFixed& x, const FRealFixed& y)
 {
-    return x = x * y;
+    x.GetValue() *= y.GetValue();
+    return x;
 }
 
 inline FRealFixed operator/(const FRealFixed& x, const FRealFixed& y)
 {
-    return FRealFixed(x.Value / y.Value);
+    return FRealFixed(x.GetValue() / y.GetValue());
 }
 
-inline FRealFixed operator/=(FRealFixed& x, const FRealFixed& y)
+inline FRealFixed& operator/=(FRealFixed& x, const FRealFixed& y)
 {
-    return x = x / y;
+    x.GetValue() /= y.GetValue();
+    return x;
 }
 
 inline FRealFixed operator%(const FRealFixed& x, const FRealFixed& y)
 {
-    return FRealFixed(x.Value % y.Value);
+    return FRealFixed(x.GetValue() % y.GetValue());
 }
 
-inline FRealFixed operator%=(FRealFixed& x, const FRealFixed& y)
+inline FRealFixed& operator%=(FRealFixed& x, const FRealFixed& y)
 {
     return x = x % y;
 }
 
+// A divisor, with its reciprocal precomputed, to divide many numbers by the same one, e.g. by a body's mass or by a vector's size.
+// Dividing by it only takes multiplications, and gives exactly the same results as dividing by the number. See real_fixed_reciprocal
+// Vectors divided by a FRealFixed make one, so the division runs once, not per component
+struct FRealFixedReciprocal
+{
+    using ReciprocalType = real_fixed_reciprocal<REAL_FIXED_MANTISSA_SIZE, REAL_FIXED_EXPONENT>;
+
+    explicit FRealFixedReciprocal(const FRealFixed& InDivisor)
+        : Value(InDivisor.GetValue())
+    {
+    }
+
+    FRealFixed GetDivisor() const
+    {
+        return FRealFixed(Value.GetDivisor());
+    }
+
+    ReciprocalType Value;
+};
+
+inline FRealFixed operator/(const FRealFixed& x, const FRealFixedReciprocal& y)
+{
+    return FRealFixed(y.Value.Divide(x.GetValue()));
+}
+
+inline FRealFixed& operator/=(FRealFixed& x, const FRealFixedReciprocal& y)
+{
+    return x = x / y;
+}
+
 inline bool operator<(const FRealFixed& x, const FRealFixed& y)
 {
-    return x.Value < y.Value;
+    return x.GetValue() < y.GetValue();
 }
 
 inline bool operator<=(const FRealFixed& x, const FRealFixed& y)
 {
-    return x.Value <= y.Value;
+    return x.GetValue() <= y.GetValue();
 }
 
 inline bool operator>=(const FRealFixed& x, const FRealFixed& y)
 {
-    return x.Value >= y.Value;
+    return x.GetValue() >= y.GetValue();
 }
 
 inline bool operator>(const FRealFixed& x, const FRealFixed& y)
 {
-    return x.Value > y.Value;
+    return x.GetValue() > y.GetValue();
 }
 
 inline bool operator==(const FRealFixed& x, const FRealFixed& y)
 {
-    return x.Value == y.Value;
+    return x.GetValue() == y.GetValue();
 }
 
 inline bool operator==(const FRealFixed& x, double y)
@@ -199,7 +304,7 @@ inline bool operator==(double x, const FRealFixed& y)
 
 inline bool operator!=(const FRealFixed& x, const FRealFixed& y)
 {
-    return x.Value != y.Value;
+    return x.GetValue() != y.GetValue();
 }
 
 /**
@@ -276,6 +381,26 @@ public:
     UFUNCTION(BlueprintPure, category = "RealFixed", meta = (DisplayName = "Log10 RealFixed", CompactNodeTitle = "Log10"))
     static FRealFixed Log10(const FRealFixed& Val);
 
+    UFUNCTION(BlueprintPure, category = "RealFixed", meta = (DisplayName = "RealFixed sin (Radians)", CompactNodeTitle = "SINr"))
+    static FRealFixed SinRad(const FRealFixed& Val);
+
+    UFUNCTION(BlueprintPure, category = "RealFixed", meta = (DisplayName = "RealFixed cos (Radians)", CompactNodeTitle = "COSr"))
+    static FRealFixed CosRad(const FRealFixed& Val);
+
+    // Computes both the sine and the cosine, with a single CORDIC rotation
+    UFUNCTION(BlueprintPure, category = "RealFixed", meta = (DisplayName = "RealFixed sincos (Radians)"))
+    static void SinCosRad(const FRealFixed& Val, FRealFixed& OutSin, FRealFixed& OutCos);
+
+    UFUNCTION(BlueprintPure, category = "RealFixed", meta = (DisplayName = "RealFixed atan (Radians)", CompactNodeTitle = "ATANr"))
+    static FRealFixed AtanRad(const FRealFixed& Val);
+
+    UFUNCTION(BlueprintPure, category = "RealFixed", meta = (DisplayName = "RealFixed atan2 (Radians)", CompactNodeTitle = "ATAN2r"))
+    static FRealFixed Atan2Rad(const FRealFixed& Y, const FRealFixed& X);
+
+    // Computes sqrt(X^2 + Y^2 + Z^2), without overflowing when the squares would
+    UFUNCTION(BlueprintPure, category = "RealFixed", meta = (DisplayName = "Hypot RealFixed", CompactNodeTitle = "Hypot"))
+    static FRealFixed Hypot(const FRealFixed& X, const FRealFixed& Y, const FRealFixed& Z);
+
     UFUNCTION(BlueprintPure, category = "RealFixed", meta = (DisplayName = "Min RealFixed", CompactNodeTitle = "Min"))
     static FRealFixed Min(const FRealFixed& Val, const FRealFixed& Min);
 
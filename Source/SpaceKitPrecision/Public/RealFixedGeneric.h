@@ -2,19 +2,19 @@
 
 #pragma once
 
-// Include ttmath
-#pragma warning(push)
-#pragma warning(disable: 5051)
-#define TTMATH_NOASM // It doesn't seem to be possible to link to ASM in UE4, so, disable it
-#include "SpaceKitPrecision/Private/ttmath/ttmath.h"
-#pragma warning(pop)
+#include "SpaceKitPrecision/Public/TtmathConfig.h"
 
 #include "Core/Public/HAL/Platform.h"
 #include "CoreMinimal.h"
 
+#include "SpaceKitPrecision/Public/FixedInt128.h"
+#include "SpaceKitPrecision/Public/DecimalConversion.h"
+
+#include <cmath>
+
 
 // Helpers for pow big, as the default Pow function is inline
-template<int a, int b>
+template<ttmath::uint a, ttmath::uint b>
 constexpr ttmath::Big<a, b> PowBig(const ttmath::Big<a, b>& x, const ttmath::Big<a, b>& y)
 {
 	ttmath::Big<a, b> temp = x;
@@ -23,7 +23,7 @@ constexpr ttmath::Big<a, b> PowBig(const ttmath::Big<a, b>& x, const ttmath::Big
 }
 
 // Helpers for pow int, as the default Pow function is inline
-template<int a>
+template<ttmath::uint a>
 constexpr ttmath::Int<a> PowInt(const ttmath::Int<a>& x, const ttmath::Int<a>& y)
 {
 	ttmath::Int<a> temp = x;
@@ -31,6 +31,241 @@ constexpr ttmath::Int<a> PowInt(const ttmath::Int<a>& x, const ttmath::Int<a>& y
 	return temp;
 }
 
+// 2^Power, at compile time
+constexpr double Pow2Double(int32 Power)
+{
+	double result = 1.0;
+	for (int32 i = 0; i < Power; i++)
+	{
+		result *= 2.0;
+	}
+	for (int32 i = 0; i > Power; i--)
+	{
+		result *= 0.5;
+	}
+	return result;
+}
+
+// Helper to turn a ttmath number (integer or float) into an FString
+template<typename T>
+FString ttbigToString(T x)
+{
+	return FString(x.ToString().c_str());
+}
+
+// Fixed point multiplication of two ttmath integers: (x * y) >> Shift, rounded to nearest, with the halves rounded away from zero.
+// The product is computed at twice the integers width, so only a result that doesn't fit in WordCount words can overflow.
+template<ttmath::uint WordCount>
+ttmath::Int<WordCount> MulShiftRound(const ttmath::Int<WordCount>& x, const ttmath::Int<WordCount>& y, int32 Shift)
+{
+	ttmath::UInt<2 * WordCount> product, factor;
+	product.FromUInt(ttmath::UInt<WordCount>(ttmath::Abs(x)));
+	factor.FromUInt(ttmath::UInt<WordCount>(ttmath::Abs(y)));
+	product.Mul(factor);
+
+	if (Shift > 0)
+	{
+		ttmath::UInt<2 * WordCount> half;
+		half.SetZero();
+		half.SetBit(Shift - 1);
+		product.Add(half);
+		product.Rcr(Shift);
+	}
+
+	ttmath::Int<WordCount> result;
+	for (ttmath::uint i = 0; i < WordCount; i++)
+	{
+		result.table[i] = product.table[i];
+	}
+	if (x.IsSign() != y.IsSign())
+	{
+		result.ChangeSign();
+	}
+	return result;
+}
+
+// Fixed point division of two ttmath integers: (x << Shift) / y, rounded to nearest, with the halves rounded away from zero.
+// The shifted dividend is computed at twice the integers width, so only a result that doesn't fit in WordCount words can overflow.
+// Dividing by zero leaves the dividend unchanged
+template<ttmath::uint WordCount>
+ttmath::Int<WordCount> ShiftDivRound(const ttmath::Int<WordCount>& x, const ttmath::Int<WordCount>& y, int32 Shift)
+{
+	if (y.IsZero())
+	{
+		return x;
+	}
+
+	ttmath::UInt<2 * WordCount> quotient, divisor, remainder;
+	quotient.FromUInt(ttmath::UInt<WordCount>(ttmath::Abs(x)));
+	quotient.Rcl(Shift);
+	divisor.FromUInt(ttmath::UInt<WordCount>(ttmath::Abs(y)));
+	quotient.Div(divisor, remainder);
+
+	// Round up if the remainder is at least half of the divisor
+	remainder.Rcl(1);
+	if (remainder >= divisor)
+	{
+		quotient.AddOne();
+	}
+
+	ttmath::Int<WordCount> result;
+	for (ttmath::uint i = 0; i < WordCount; i++)
+	{
+		result.table[i] = quotient.table[i];
+	}
+	if (x.IsSign() != y.IsSign())
+	{
+		result.ChangeSign();
+	}
+	return result;
+}
+
+// floor(2^(WordCount * 64 + Shift) / |y|), the reciprocal of y for ShiftDivRoundReciprocal, or zero if y is zero
+template<ttmath::uint WordCount>
+ttmath::UInt<2 * WordCount> ShiftReciprocal(const ttmath::Int<WordCount>& y, int32 Shift)
+{
+	ttmath::UInt<2 * WordCount> reciprocal;
+	reciprocal.SetZero();
+	if (!y.IsZero())
+	{
+		ttmath::UInt<2 * WordCount> divisor, remainder;
+		divisor.FromUInt(ttmath::UInt<WordCount>(ttmath::Abs(y)));
+		reciprocal.SetBit(WordCount * TTMATH_BITS_PER_UINT + Shift);
+		reciprocal.Div(divisor, remainder);
+	}
+	return reciprocal;
+}
+
+// Same result as ShiftDivRound(x, y, Shift), given the reciprocal of y from ShiftReciprocal, but only with multiplications.
+// The shifted dividend is below 2^(WordCount * 64 + Shift), so the reciprocal gives the quotient, or one less.
+// The remainder of that estimate is then below twice the divisor: one step corrects it, then it gives the rounding
+template<ttmath::uint WordCount>
+ttmath::Int<WordCount> ShiftDivRoundReciprocal(const ttmath::Int<WordCount>& x, const ttmath::Int<WordCount>& y, const ttmath::UInt<2 * WordCount>& Reciprocal, int32 Shift)
+{
+	if (y.IsZero())
+	{
+		return x;
+	}
+
+	ttmath::UInt<2 * WordCount> dividend, divisor;
+	dividend.FromUInt(ttmath::UInt<WordCount>(ttmath::Abs(x)));
+	divisor.FromUInt(ttmath::UInt<WordCount>(ttmath::Abs(y)));
+
+	// ((|x| << Shift) * Reciprocal) >> (WordCount * 64 + Shift)
+	ttmath::UInt<4 * WordCount> product;
+	dividend.MulBig(Reciprocal, product);
+	product.Rcr(WordCount * TTMATH_BITS_PER_UINT);
+
+	ttmath::UInt<2 * WordCount> quotient;
+	for (ttmath::uint i = 0; i < 2 * WordCount; i++)
+	{
+		quotient.table[i] = product.table[i];
+	}
+
+	ttmath::UInt<2 * WordCount> remainder = dividend, estimate = quotient;
+	remainder.Rcl(Shift);
+	estimate.Mul(divisor);
+	remainder.Sub(estimate);
+	if (remainder >= divisor)
+	{
+		quotient.AddOne();
+		remainder.Sub(divisor);
+	}
+
+	// Round up if the remainder is at least half of the divisor
+	remainder.Rcl(1);
+	if (remainder >= divisor)
+	{
+		quotient.AddOne();
+	}
+
+	ttmath::Int<WordCount> result;
+	for (ttmath::uint i = 0; i < WordCount; i++)
+	{
+		result.table[i] = quotient.table[i];
+	}
+	if (x.IsSign() != y.IsSign())
+	{
+		result.ChangeSign();
+	}
+	return result;
+}
+
+// A factor, to multiply many fixed point integers by the same one with MulShiftRound, e.g. to scale many vectors by a time step.
+// Multiply<Shift>(x) gives exactly MulShiftRound(x, Factor, Shift)
+template<typename IntType>
+struct mul_shift_round_factor
+{
+	IntType factor;
+
+	explicit mul_shift_round_factor(const IntType& inFactor)
+		: factor(inFactor)
+	{
+	}
+
+	template<int32 Shift>
+	IntType Multiply(const IntType& x) const
+	{
+		return MulShiftRound(x, factor, Shift);
+	}
+};
+
+#if FIXED_INT128_SUPPORTED
+
+// For two-words mantissas, the factor's absolute value and sign are computed once, and the multiplication has no branches:
+// the signs of many numbers are unpredictable, and MulShiftRound's branches on them cost more than its multiplications
+template<>
+struct mul_shift_round_factor<fixed_int128>
+{
+	fixed_int128 factor;
+	fixed_int128 absFactor;
+	uint64 signMask; // All ones if the factor is negative
+
+	explicit mul_shift_round_factor(const fixed_int128& inFactor)
+		: factor(inFactor), absFactor(fixed_int128::AbsRaw(inFactor)), signMask(inFactor.IsSign() ? ~0ull : 0ull)
+	{
+	}
+
+	// x if mask is zero, -x if it's all ones: (x ^ mask) - mask, the borrow of the lowest word being a carry of one when it's zero
+	static fixed_int128 NegateIf(const fixed_int128& x, uint64 mask)
+	{
+		return fixed_int128::FromLimbs((x.lo ^ mask) - mask, (x.hi ^ mask) + (mask & uint64(x.lo == 0)));
+	}
+
+	template<int32 Shift>
+	fixed_int128 Multiply(const fixed_int128& x) const
+	{
+		if (Shift <= 0 || Shift >= 64)
+		{
+			return MulShiftRound(x, factor, Shift);
+		}
+		const int32 lowShift = Shift > 0 && Shift < 64 ? Shift : 1;
+
+		const uint64 xSignMask = uint64(int64(x.hi) >> 63);
+		const fixed_int128 absX = NegateIf(x, xSignMask);
+
+		// The three lowest words of the 256 bits product. The highest one is above the result
+		uint64 high00, high01, high10;
+		const uint64 low00 = fixed_int128::Mul64(absX.lo, absFactor.lo, high00);
+		const uint64 low01 = fixed_int128::Mul64(absX.lo, absFactor.hi, high01);
+		const uint64 low10 = fixed_int128::Mul64(absX.hi, absFactor.lo, high10);
+		const uint64 middleSum = high00 + low01;
+		const uint64 middle = middleSum + low10;
+		uint64 top = high01 + high10 + absX.hi * absFactor.hi + uint64(middleSum < low01) + uint64(middle < low10);
+
+		// Plus half of the result's unit, to round to nearest
+		const uint64 half = uint64(1) << (lowShift - 1);
+		const uint64 roundedLow = low00 + half;
+		const uint64 roundedMiddle = middle + uint64(roundedLow < half);
+		top += uint64(roundedMiddle < middle);
+
+		const fixed_int128 result = fixed_int128::FromLimbs((roundedLow >> lowShift) | (roundedMiddle << (64 - lowShift)), (roundedMiddle >> lowShift) | (top << (64 - lowShift)));
+		return NegateIf(result, xSignMask ^ signMask);
+	}
+};
+
+#endif // FIXED_INT128_SUPPORTED
+
 // Type for a number with fixed point. MantissaSize is the size of the mantissa, in bits, and exponent is the (negated) 2-powered exponent of the number.
 // Exponent has to be positive, as it is negated i.e. if the actual value is mantissa * 2^(-exponent).
 // The actual mantissa size is guaranteed to be at least MantissaSize, but can actually be bigger.
@@ -39,17 +274,33 @@ constexpr ttmath::Int<a> PowInt(const ttmath::Int<a>& x, const ttmath::Int<a>& y
 template<int MantissaSize, int Exponent>
 struct real_fixed
 {
-	using ttIntMantissaType = ttmath::Int<TTMATH_BITS(MantissaSize + Exponent)>; // Integer mantissa type
+	using ttIntType = ttmath::Int<TTMATH_BITS(MantissaSize + Exponent)>; // Ttmath integer type of the mantissa's size, used for conversions
+	using ttIntMantissaType = typename real_fixed_mantissa<TTMATH_BITS(MantissaSize + Exponent)>::type; // Integer mantissa type. Same as ttIntType, or its native equivalent
 	using ttBigType = ttmath::Big<1, TTMATH_BITS(MantissaSize + Exponent)>; // Float type that can store the mantissa fully, without precision loss
 
 	// The mantissa of this number
 	ttIntMantissaType mantissa;
 
-	// Cached value of the exponent. Aka these variables' values are 2^Exponent.
-	// These are helpful for conversions and operations, and pre-computing them enhances performance
-	static const ttIntMantissaType exponentiatedTtInt;
-	static const ttBigType exponentiatedTtBig;
-	static const double exponentiatedDouble;
+	// 2^Exponent, as a double. It's computed at compile time, so it's usable by other static initializers
+	static constexpr double exponentiatedDouble = Pow2Double(Exponent);
+
+	// 2^Exponent, as a mantissa and as a ttmath float. They are built from their bits in a few instructions,
+	// instead of being cached in statics that other static initializers could read before they are initialized
+	static ttIntMantissaType GetExponentiatedTtInt()
+	{
+		ttIntType result;
+		result.SetZero();
+		result.SetBit(Exponent);
+		return result;
+	}
+
+	static ttBigType GetExponentiatedTtBig()
+	{
+		ttBigType result;
+		result.SetOne();
+		result.exponent.Add(ttmath::Int<1>(ttmath::sint(Exponent)));
+		return result;
+	}
 	
 	// Default constructor
 	constexpr real_fixed()
@@ -70,6 +321,127 @@ private:
 	{
 	}
 
+	// Truncates a ttmath float number to an integer mantissa
+	static ttIntMantissaType BigToMantissa(const ttBigType& x)
+	{
+		ttIntType result;
+		x.ToInt(result);
+		return result;
+	}
+
+	// Converts a double to a mantissa, by shifting its IEEE-754 significand: x = significand * 2^(exponent - 1075).
+	// It's rounded to nearest, with the halves rounded away from zero. NaNs give 0, and values out of range saturate to the highest or lowest value
+	static ttIntMantissaType DoubleToMantissa(double x)
+	{
+		const int32 BitCount = int32(TTMATH_BITS(MantissaSize + Exponent) * TTMATH_BITS_PER_UINT);
+
+		uint64 bits;
+		FMemory::Memcpy(&bits, &x, sizeof(bits));
+		const bool bNegative = (bits >> 63) != 0;
+		const int32 biasedExponent = int32((bits >> 52) & 0x7FF);
+		uint64 significand = bits & ((uint64(1) << 52) - 1);
+
+		if (biasedExponent == 0x7FF && significand != 0)
+		{
+			return ttIntMantissaType(ttIntType(0));
+		}
+		if (biasedExponent != 0)
+		{
+			significand |= uint64(1) << 52;
+		}
+
+		// The mantissa is significand * 2^shift. Subnormals have the same exponent as the smallest normals
+		const int32 shift = (biasedExponent == 0 ? 1 : biasedExponent) - 1075 + Exponent;
+		ttmath::UInt<TTMATH_BITS(MantissaSize + Exponent)> magnitude;
+		magnitude.SetZero();
+		if (shift >= 0)
+		{
+			// The highest bit must stay below the sign bit
+			if (biasedExponent == 0x7FF || (significand != 0 && ttmath::UInt<1>::FindLeadingBitInWord(significand) + shift >= BitCount - 1))
+			{
+				ttIntType result;
+				if (bNegative) result.SetMin(); else result.SetMax();
+				return result;
+			}
+			const int32 word = shift / 64;
+			const int32 bit = shift % 64;
+			magnitude.table[word] = significand << bit;
+			if (bit != 0 && word + 1 < int32(TTMATH_BITS(MantissaSize + Exponent)))
+			{
+				magnitude.table[word + 1] = significand >> (64 - bit);
+			}
+		}
+		else if (shift > -54)
+		{
+			const int32 rightShift = -shift;
+			magnitude.table[0] = (significand >> rightShift) + ((significand >> (rightShift - 1)) & 1);
+		}
+
+		ttIntType result;
+		for (ttmath::uint i = 0; i < TTMATH_BITS(MantissaSize + Exponent); i++)
+		{
+			result.table[i] = magnitude.table[i];
+		}
+		if (bNegative)
+		{
+			result.ChangeSign();
+		}
+		return result;
+	}
+
+	// Converts a mantissa to a floating point number, keeping its highest Digits bits, correctly rounded (to nearest, with the halves rounded to even)
+	template<typename FloatType, int32 Digits>
+	static FloatType MantissaToFloating(const ttIntMantissaType& x)
+	{
+		// Like ttmath's, the absolute value of the lowest value is itself, which is still right as an unsigned number
+		ttIntType magnitude(x);
+		const bool bNegative = magnitude.IsSign();
+		if (bNegative)
+		{
+			magnitude.ChangeSign();
+		}
+
+		ttmath::uint tableId, index;
+		if (!magnitude.FindLeadingBit(tableId, index))
+		{
+			return FloatType(0);
+		}
+
+		// Gathers the 64 highest bits in a window, its highest bit being the leading bit. The bits below the window are only sticky bits
+		const int32 leadingBit = int32(tableId * TTMATH_BITS_PER_UINT + index);
+		const int32 lowestBit = leadingBit - 63;
+		uint64 window;
+		bool bStickyBits = false;
+		if (lowestBit <= 0)
+		{
+			window = magnitude.table[0] << -lowestBit;
+		}
+		else
+		{
+			const int32 word = lowestBit / 64;
+			const int32 bit = lowestBit % 64;
+			window = bit == 0 ? magnitude.table[word] : (magnitude.table[word] >> bit) | (magnitude.table[word + 1] << (64 - bit));
+			bStickyBits = bit != 0 && (magnitude.table[word] << (64 - bit)) != 0;
+			for (int32 lowerWord = 0; lowerWord < word; lowerWord++)
+			{
+				bStickyBits |= magnitude.table[lowerWord] != 0;
+			}
+		}
+
+		// Keeps the highest Digits bits of the window, and the bits below them decide the rounding
+		uint64 significand = window >> (64 - Digits);
+		const bool bRoundBit = ((window >> (63 - Digits)) & 1) != 0;
+		bStickyBits |= (window & ((uint64(1) << (63 - Digits)) - 1)) != 0;
+		if (bRoundBit && (bStickyBits || (significand & 1) != 0))
+		{
+			significand++;
+		}
+
+		// The significand has at most Digits + 1 bits, so it's exact in FloatType, and so is the scaling
+		const FloatType result = std::ldexp(FloatType(significand), lowestBit + 64 - Digits - Exponent);
+		return bNegative ? -result : result;
+	}
+
 public:
 
 	// Builds a fixed-size value using a given mantissa.
@@ -82,97 +454,169 @@ public:
 	// Creates a real_fixed number based on a ttmath float number
 	constexpr real_fixed(ttBigType inValue)
 	{
-		(inValue * exponentiatedTtBig).ToInt(mantissa);
+		mantissa = BigToMantissa(inValue * GetExponentiatedTtBig());
 	}
 
-	// Creates a real_fixed number based on a base-10 string representation
+	// Creates a real_fixed number based on a base-10 string representation. See InitFromChars
 	constexpr real_fixed(const std::string& initString)
+		: real_fixed(int64(0))
 	{
-		(ttBigType(initString) * exponentiatedTtBig).ToInt(mantissa);
+		const char* cursor = initString.c_str();
+		InitFromChars(cursor);
 	}
 
 	// See real_fixed(std::string initString)
 	constexpr real_fixed(const char* initString)
+		: real_fixed(int64(0))
 	{
-		(ttBigType(initString) * exponentiatedTtBig).ToInt(mantissa);
+		InitFromChars(initString);
 	}
 
 	// See real_fixed(std::string initString)
 	constexpr real_fixed(const FString& initString)
+		: real_fixed(int64(0))
 	{
-		(ttBigType(TCHAR_TO_ANSI(*initString)) * exponentiatedTtBig).ToInt(mantissa);
+		const TCHAR* cursor = *initString;
+		InitFromChars(cursor);
 	}
 
-	// Creates a real_fixed number based on a double number
+	// Creates a real_fixed number based on a double number, rounded to nearest. See DoubleToMantissa
 	constexpr real_fixed(double val)
 	{
-		(ttBigType(val) * exponentiatedDouble).ToInt(mantissa);
+		mantissa = DoubleToMantissa(val);
 	}
 
-	// Creates a real_fixed number based on a float number
+	// Creates a real_fixed number based on a float number, rounded to nearest. Floats are exact in doubles
 	constexpr real_fixed(float val)
 	{
-		(ttBigType(val) * exponentiatedDouble).ToInt(mantissa);
+		mantissa = DoubleToMantissa(double(val));
 	}
 
 	// Creates a real_fixed number based on an 32-bits integer number
 	constexpr real_fixed(int32 val)
+		: real_fixed(int64(val))
 	{
-		(ttBigType(val) * exponentiatedDouble).ToInt(mantissa);
 	}
 
-	// Creates a real_fixed number based on an 64-bits integer number
+	// Creates a real_fixed number based on an 64-bits integer number. The mantissa is only the integer, shifted
 	constexpr real_fixed(int64 val)
 	{
-		(ttBigType(val) * exponentiatedDouble).ToInt(mantissa);
+		ttIntType result(static_cast<ttmath::sint>(val));
+		result.Rcl(Exponent);
+		mantissa = result;
 	}
 
-	// Converts this number to a double number. Note that this can lead to huge precision loss
+	// Converts a real_fixed number of another precision. Only works on the mantissas, so it's much cheaper than a round trip through a float.
+	// If this exponent is smaller, the value is rounded to nearest, with the halves rounded away from zero. The value must fit in this mantissa
+	template<int OtherMantissaSize, int OtherExponent>
+	explicit real_fixed(const real_fixed<OtherMantissaSize, OtherExponent>& x)
+	{
+		using OtherType = real_fixed<OtherMantissaSize, OtherExponent>;
+		const int32 Shift = Exponent - OtherExponent;
+
+		// Wide enough for both mantissas, and for the other one shifted to this exponent
+		const int32 WideBits = (MantissaSize + Exponent > OtherMantissaSize + OtherExponent ? MantissaSize + Exponent : OtherMantissaSize + OtherExponent) + (Exponent > OtherExponent ? Exponent - OtherExponent : 0);
+		using WideUIntType = ttmath::UInt<TTMATH_BITS(WideBits)>;
+
+		const typename OtherType::ttIntType otherMantissa(x.mantissa);
+		WideUIntType magnitude;
+		magnitude.FromUInt(ttmath::UInt<TTMATH_BITS(OtherMantissaSize + OtherExponent)>(ttmath::Abs(otherMantissa)));
+
+		if (Shift > 0)
+		{
+			magnitude.Rcl(Shift);
+		}
+		else if (Shift < 0)
+		{
+			WideUIntType half;
+			half.SetZero();
+			half.SetBit(-Shift - 1);
+			magnitude.Add(half);
+			magnitude.Rcr(-Shift);
+		}
+
+		ttIntType result;
+		for (ttmath::uint i = 0; i < TTMATH_BITS(MantissaSize + Exponent); i++)
+		{
+			result.table[i] = magnitude.table[i];
+		}
+		if (otherMantissa.IsSign())
+		{
+			result.ChangeSign();
+		}
+		mantissa = result;
+	}
+
+	// Converts this number to a double number, correctly rounded. Note that this can lead to huge precision loss
 	constexpr double ToDouble() const
 	{
-		return ToBig().ToDouble();
+		return MantissaToFloating<double, 53>(mantissa);
 	}
 
-	// Converts this number to a float number. Note that this can lead to huge precision loss
+	// Converts this number to a float number, correctly rounded. Note that this can lead to huge precision loss
 	constexpr float ToFloat() const
 	{
-		return ToBig().ToFloat();
+		return MantissaToFloating<float, 24>(mantissa);
 	}
 
 	// Converts this number to a floating-point big number. This may not lead to precision loss
 	constexpr ttBigType ToBig() const
 	{
-		return ttBigType(mantissa) / exponentiatedDouble;
+		return ttBigType(ttIntType(mantissa)) / exponentiatedDouble;
 	}
 
-	// Converts this number to a base 10 string, with little to no precision loss
-	// The precision loss appears for small numbers, where the string is rounded:
-	// For a given x, then |x - real_fixed(x.ToString())| <= 10^(-floor(Exponent*ln(2)/ln(10)))
-	// However, if x is itself imported from an exported string, there will be no precision loss:
-	// For a given y, so that x=real_fixed(y.ToString()), then x = real_fixed(x.ToString())
-	FString ToString() const
-	{
-		// There is no built-in way to convert fixed point numbers to string, and it's too hard and error prone to code it manually,
-		// so we'll use some of the features ttmath has to offer, but with some modifications
+	// Size of the buffers ToChars writes to, in characters, including the null terminator
+	static constexpr int32 StringBufferSize = DecimalConversion::FixedBufferSize(int32(TTMATH_BITS(MantissaSize + Exponent) * TTMATH_BITS_PER_UINT), Exponent);
 
-		// First, extract the integral (left side of comma) and decimal (right side of the comma) parts
-		const ttBigType RightPart = ttBigType(Abs(mantissa) % exponentiatedTtInt) / exponentiatedTtBig;
-		const ttIntMantissaType LeftPart = mantissa / exponentiatedTtInt;
+	// Writes this number in base 10 to Buffer, which must hold StringBufferSize characters, and returns the number of characters written.
+	// It's written as [-]integral.fraction, with the fewest fraction digits that parse back to this number, so x = real_fixed(x.ToString()).
+	// Nothing is allocated, so it can be called in bulk when logging or exporting
+	template<typename CharType>
+	int32 ToChars(CharType* Buffer) const
+	{
+		const ttIntType value(mantissa);
+		return DecimalConversion::WriteFixed<Exponent>(Buffer, ttmath::UInt<TTMATH_BITS(MantissaSize + Exponent)>(ttmath::Abs(value)), value.IsSign());
+	}
 
-		// Convert the right side to string, using ttmath.
-		ttmath::Conv c;
-		// Also, tell ttmath about the maximum figures, so we don't get rounding errors (aka 0.1 that becomes 0.099999999)
-		c.round = FMath::FloorToInt((float)Exponent * FMath::Loge(2.0) / FMath::Loge(10.0));
-		FString RightPartString = FString(RightPart.ToString(c).c_str());
-		// Remove the "0." part, so we can append this to the left part, adding a comma in between
-		RightPartString.RemoveFromStart("0.");
+	// Reads a base 10 number at Buffer, in a single pass and without allocating, and moves Buffer past it. See DecimalConversion::ParseDecimal for the syntax.
+	// It's rounded to nearest, with the halves rounded away from zero, and values out of range saturate to the highest or lowest value.
+	// Returns false if there is no number at Buffer, and then leaves Buffer and this number unchanged
+	template<typename CharType>
+	bool InitFromChars(const CharType*& Buffer)
+	{
+		ttmath::UInt<TTMATH_BITS(MantissaSize + Exponent)> magnitude;
+		bool bNegative, bSaturated;
+		if (!DecimalConversion::ParseFixed<Exponent>(Buffer, magnitude, bNegative, bSaturated))
+		{
+			return false;
+		}
 
-		// Convert the left side to string, using ttmath.
-		const FString LeftPartString = ttbigToString(LeftPart);
+		ttIntType result;
+		if (bSaturated)
+		{
+			if (bNegative) result.SetMin(); else result.SetMax();
+		}
+		else
+		{
+			for (ttmath::uint i = 0; i < TTMATH_BITS(MantissaSize + Exponent); i++)
+			{
+				result.table[i] = magnitude.table[i];
+			}
+			if (bNegative)
+			{
+				result.ChangeSign();
+			}
+		}
+		mantissa = result;
+		return true;
+	}
 
-		// Compute the result, and return
-		const FString Result = LeftPartString + "." + RightPartString;
-		return Result;
+	// Converts this number to a base 10 string. See ToChars
+	FString ToString() const
+	{
+		TCHAR Buffer[StringBufferSize];
+		const int32 Length = ToChars(Buffer);
+		return FString(Length, Buffer);
 	}
 
 	static real_fixed<MantissaSize, Exponent> GetMaxValue()
@@ -188,22 +632,16 @@ public:
 	}
 };
 
-// Helper to turn a ttmath number (integer or float) into an FString
-template<typename T>
-FString ttbigToString(T x)
-{
-	return FString(x.ToString().c_str());
-}
-
-// Definitions exponentiatedTtInt, exponentiatedTtBig and exponentiatedDouble (Cached value of the exponent). See the declarations for more info
+// C++ name of the fixed point type of a given precision, to go along with TRealFloat and TVectorFixed. FRealFixed is its Blueprint-facing counterpart
 template<int MantissaSize, int Exponent>
-const ttmath::Int<TTMATH_BITS(MantissaSize + Exponent)> real_fixed<MantissaSize, Exponent>::exponentiatedTtInt = PowInt(ttIntMantissaType(2), ttIntMantissaType(Exponent));
+using TRealFixed = real_fixed<MantissaSize, Exponent>;
 
+// Definition of exponentiatedDouble, as it's odr-used. See the declaration for more info
 template<int MantissaSize, int Exponent>
-const ttmath::Big<1, TTMATH_BITS(MantissaSize + Exponent)> real_fixed<MantissaSize, Exponent>::exponentiatedTtBig = PowBig(ttBigType(2.0), ttBigType(Exponent));
+constexpr double real_fixed<MantissaSize, Exponent>::exponentiatedDouble;
 
 template<int MantissaSize, int Exponent>
-const double real_fixed<MantissaSize, Exponent>::exponentiatedDouble = pow(2.0, Exponent);
+constexpr int32 real_fixed<MantissaSize, Exponent>::StringBufferSize;
 
 // Operators for fixed point numbers
 
@@ -214,13 +652,14 @@ real_fixed<MantissaSize, Exponent> operator+(const real_fixed<MantissaSize, Expo
 }
 
 template<int MantissaSize, int Exponent>
-real_fixed<MantissaSize, Exponent> operator+=(real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y)
+real_fixed<MantissaSize, Exponent>& operator+=(real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y)
 {
-	return real_fixed<MantissaSize, Exponent>::FromMantissa(x.mantissa += y.mantissa);
+	x.mantissa += y.mantissa;
+	return x;
 }
 
 template<int MantissaSize, int Exponent>
-real_fixed<MantissaSize, Exponent> operator+=(real_fixed<MantissaSize, Exponent>& x, const float& y)
+real_fixed<MantissaSize, Exponent>& operator+=(real_fixed<MantissaSize, Exponent>& x, const float& y)
 {
 	return x += real_fixed<MantissaSize, Exponent>(y);
 }
@@ -232,9 +671,10 @@ real_fixed<MantissaSize, Exponent> operator-(const real_fixed<MantissaSize, Expo
 }
 
 template<int MantissaSize, int Exponent>
-real_fixed<MantissaSize, Exponent> operator-=(real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y)
+real_fixed<MantissaSize, Exponent>& operator-=(real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y)
 {
-	return real_fixed<MantissaSize, Exponent>::FromMantissa(x.mantissa -= y.mantissa);
+	x.mantissa -= y.mantissa;
+	return x;
 }
 
 template<int MantissaSize, int Exponent>
@@ -246,25 +686,27 @@ real_fixed<MantissaSize, Exponent> operator-(const real_fixed<MantissaSize, Expo
 template<int MantissaSize, int Exponent>
 real_fixed<MantissaSize, Exponent> operator*(const real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y)
 {
-	return real_fixed<MantissaSize, Exponent>::FromMantissa((x.mantissa * y.mantissa) / real_fixed<MantissaSize, Exponent>::exponentiatedTtInt);
+	return real_fixed<MantissaSize, Exponent>::FromMantissa(MulShiftRound(x.mantissa, y.mantissa, Exponent));
 }
 
 template<int MantissaSize, int Exponent>
-real_fixed<MantissaSize, Exponent> operator*=(real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y)
+real_fixed<MantissaSize, Exponent>& operator*=(real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y)
 {
-	return x = x * y;
+	x.mantissa = MulShiftRound(x.mantissa, y.mantissa, Exponent);
+	return x;
 }
 
 template<int MantissaSize, int Exponent>
 real_fixed<MantissaSize, Exponent> operator/(const real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y)
 {
-	return real_fixed<MantissaSize, Exponent>::FromMantissa((x.mantissa * real_fixed<MantissaSize, Exponent>::exponentiatedTtInt) / y.mantissa);
+	return real_fixed<MantissaSize, Exponent>::FromMantissa(ShiftDivRound(x.mantissa, y.mantissa, Exponent));
 }
 
 template<int MantissaSize, int Exponent>
-real_fixed<MantissaSize, Exponent> operator/=(real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y)
+real_fixed<MantissaSize, Exponent>& operator/=(real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y)
 {
-	return x = x / y;
+	x.mantissa = ShiftDivRound(x.mantissa, y.mantissa, Exponent);
+	return x;
 }
 
 template<int MantissaSize, int Exponent>
@@ -274,9 +716,10 @@ real_fixed<MantissaSize, Exponent> operator%(const real_fixed<MantissaSize, Expo
 }
 
 template<int MantissaSize, int Exponent>
-real_fixed<MantissaSize, Exponent> operator%=(real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y)
+real_fixed<MantissaSize, Exponent>& operator%=(real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y)
 {
-	return x = x % y;
+	x.mantissa %= y.mantissa;
+	return x;
 }
 
 template<int MantissaSize, int Exponent>
@@ -314,3 +757,311 @@ bool operator!=(const real_fixed<MantissaSize, Exponent>& x, const real_fixed<Ma
 {
 	return x.mantissa != y.mantissa;
 }
+
+// A divisor, with its reciprocal precomputed, to divide many numbers by the same one, e.g. by a mass or by a vector's size.
+// Dividing by it only takes multiplications, and gives exactly the same results as dividing by the number. See ShiftDivRoundReciprocal
+// TVectorFixed divides its components by one, when they're divided by the same number
+template<int MantissaSize, int Exponent>
+struct real_fixed_reciprocal
+{
+	using FixedType = real_fixed<MantissaSize, Exponent>;
+	using ttReciprocalType = ttmath::UInt<2 * TTMATH_BITS(MantissaSize + Exponent)>;
+
+	// Creates the reciprocal of a divisor. This is the only division
+	explicit real_fixed_reciprocal(const FixedType& inDivisor)
+		: divisor(inDivisor), reciprocal(ShiftReciprocal(inDivisor.mantissa, Exponent))
+	{
+	}
+
+	const FixedType& GetDivisor() const
+	{
+		return divisor;
+	}
+
+	// x / divisor, rounded to nearest, with the halves rounded away from zero. Like dividing by zero, dividing by the reciprocal of zero leaves x unchanged
+	FixedType Divide(const FixedType& x) const
+	{
+		return FixedType::FromMantissa(ShiftDivRoundReciprocal(x.mantissa, divisor.mantissa, reciprocal, Exponent));
+	}
+
+private:
+	FixedType divisor;
+	ttReciprocalType reciprocal;
+};
+
+template<int MantissaSize, int Exponent>
+real_fixed<MantissaSize, Exponent> operator/(const real_fixed<MantissaSize, Exponent>& x, const real_fixed_reciprocal<MantissaSize, Exponent>& y)
+{
+	return y.Divide(x);
+}
+
+template<int MantissaSize, int Exponent>
+real_fixed<MantissaSize, Exponent>& operator/=(real_fixed<MantissaSize, Exponent>& x, const real_fixed_reciprocal<MantissaSize, Exponent>& y)
+{
+	return x = y.Divide(x);
+}
+
+// Math functions for fixed point numbers. They work on the integer mantissas, without any conversion to a ttmath float
+
+// Integer square root of Square, rounded to nearest, by Newton iterations seeded from the hardware square root
+template<ttmath::uint WordCount>
+ttmath::UInt<WordCount> RoundedIntegerSqrt(const ttmath::UInt<WordCount>& Square)
+{
+	using UIntType = ttmath::UInt<WordCount>;
+
+	UIntType root;
+	root.SetZero();
+	if (Square.IsZero())
+	{
+		return root;
+	}
+
+	// Seed with the square root of the highest 62 bits or so, shifted by an even number of bits, and enlarged so that it's never below the integer square root
+	ttmath::uint tableId, index;
+	Square.FindLeadingBit(tableId, index);
+	const int32 leadingBit = int32(tableId * TTMATH_BITS_PER_UINT + index);
+	const int32 seedShift = leadingBit > 61 ? (leadingBit - 60) & ~1 : 0;
+	UIntType top = Square;
+	top.Rcr(seedShift);
+	root.table[0] = ttmath::uint(std::sqrt(double(top.table[0])) * (1.0 + 1.0 / 1125899906842624.0)) + 1;
+	root.Rcl(seedShift / 2);
+
+	// Newton iterations decrease from there, until they reach the integer square root
+	for (;;)
+	{
+		UIntType next = Square;
+		next.Div(root);
+		next.Add(root);
+		next.Rcr(1);
+		if (!(next < root)) break;
+		root = next;
+	}
+
+	// Round up if Square - root^2 > root, i.e. if Square >= (root + 1/2)^2
+	UIntType remainder = root;
+	remainder.Mul(root);
+	remainder = Square - remainder;
+	if (remainder > root)
+	{
+		root.AddOne();
+	}
+	return root;
+}
+
+// Square root, rounded to nearest: the integer square root of mantissa * 2^Exponent. Negative numbers have no square root, and give zero
+template<int MantissaSize, int Exponent>
+real_fixed<MantissaSize, Exponent> Sqrt(const real_fixed<MantissaSize, Exponent>& x)
+{
+	using FixedType = real_fixed<MantissaSize, Exponent>;
+	using IntType = typename FixedType::ttIntType;
+	const ttmath::uint WordCount = TTMATH_BITS(MantissaSize + Exponent);
+
+	const IntType mantissa(x.mantissa);
+	if (mantissa.IsSign())
+	{
+		return FixedType::FromMantissa(typename FixedType::ttIntMantissaType(0));
+	}
+
+	ttmath::UInt<2 * WordCount> square;
+	square.FromUInt(ttmath::UInt<WordCount>(mantissa));
+	square.Rcl(Exponent);
+	const ttmath::UInt<2 * WordCount> root = RoundedIntegerSqrt(square);
+
+	IntType result;
+	for (ttmath::uint i = 0; i < WordCount; i++)
+	{
+		result.table[i] = root.table[i];
+	}
+	return FixedType::FromMantissa(result);
+}
+
+// sqrt(x^2 + y^2 + z^2), rounded to nearest. The sum of squares is computed exactly on the mantissas, so it doesn't overflow even if the squares would.
+// The root itself can be up to sqrt(3) times the largest number, and saturates to it like the conversions do
+template<int MantissaSize, int Exponent>
+real_fixed<MantissaSize, Exponent> Hypot(const real_fixed<MantissaSize, Exponent>& x, const real_fixed<MantissaSize, Exponent>& y, const real_fixed<MantissaSize, Exponent>& z)
+{
+	using FixedType = real_fixed<MantissaSize, Exponent>;
+	using IntType = typename FixedType::ttIntType;
+	const ttmath::uint WordCount = TTMATH_BITS(MantissaSize + Exponent);
+	using WideUIntType = ttmath::UInt<2 * WordCount + 1>;
+
+	// |v| * 2^Exponent = sqrt(sum of the squared mantissas)
+	WideUIntType squares;
+	squares.SetZero();
+	const IntType mantissas[] = { IntType(x.mantissa), IntType(y.mantissa), IntType(z.mantissa) };
+	for (const IntType& mantissa : mantissas)
+	{
+		WideUIntType square, factor;
+		square.FromUInt(ttmath::UInt<WordCount>(ttmath::Abs(mantissa)));
+		factor = square;
+		square.Mul(factor);
+		squares.Add(square);
+	}
+	const WideUIntType root = RoundedIntegerSqrt(squares);
+
+	// The root must stay below the sign bit of the mantissa
+	ttmath::uint tableId, index;
+	root.FindLeadingBit(tableId, index);
+	if (tableId * TTMATH_BITS_PER_UINT + index >= WordCount * TTMATH_BITS_PER_UINT - 1)
+	{
+		return FixedType::GetMaxValue();
+	}
+
+	IntType result;
+	for (ttmath::uint i = 0; i < WordCount; i++)
+	{
+		result.table[i] = root.table[i];
+	}
+	return FixedType::FromMantissa(result);
+}
+
+// Binary logarithm of Magnitude * 2^-Exponent, for a non-zero Magnitude, split into its integral part and FractionBits bits (at most 62) of its fractional part.
+// The fractional part comes from the squaring algorithm, on the magnitude normalized to [1, 2): each squaring gives the next bit, that is 1 if the square is 2 or more.
+// Squares are truncated to 64 bits, which is the same as changing the input by less than 2^-62, so the result is accurate to about 2^-60
+template<ttmath::uint WordCount>
+void FixedLog2(const ttmath::UInt<WordCount>& Magnitude, int32 Exponent, int32 FractionBits, int32& OutIntegral, uint64& OutFraction)
+{
+	ttmath::uint tableId, index;
+	Magnitude.FindLeadingBit(tableId, index);
+	const int32 leadingBit = int32(tableId * TTMATH_BITS_PER_UINT + index);
+	OutIntegral = leadingBit - Exponent;
+
+	// Normalized magnitude, with 63 fractional bits
+	ttmath::UInt<WordCount> normalized = Magnitude;
+	if (leadingBit >= 63)
+	{
+		normalized.Rcr(leadingBit - 63);
+	}
+	else
+	{
+		normalized.Rcl(63 - leadingBit);
+	}
+	uint64 z = normalized.table[0];
+
+	OutFraction = 0;
+	for (int32 bit = 0; bit < FractionBits; bit++)
+	{
+		ttmath::uint high, low;
+		ttmath::UInt<1>::MulTwoWords(z, z, &high, &low);
+		OutFraction <<= 1;
+		if (high >> 63)
+		{
+			OutFraction |= 1;
+			z = high;
+		}
+		else
+		{
+			z = (high << 1) | (low >> 63);
+		}
+	}
+}
+
+// Logarithm of x, multiplied by Factor / 2^64, rounded to nearest. Non-positive numbers have no logarithm, and give the lowest number
+template<int MantissaSize, int Exponent>
+real_fixed<MantissaSize, Exponent> FixedLogTimes(const real_fixed<MantissaSize, Exponent>& x, uint64 Factor)
+{
+	static_assert(Exponent < 64, "The product is rounded from 64 fractional bits");
+
+	using FixedType = real_fixed<MantissaSize, Exponent>;
+	using IntType = typename FixedType::ttIntType;
+	const ttmath::uint WordCount = TTMATH_BITS(MantissaSize + Exponent);
+	const int32 FractionBits = Exponent + 8 < 62 ? Exponent + 8 : 62;
+
+	const IntType mantissa(x.mantissa);
+	if (mantissa.IsSign() || mantissa.IsZero())
+	{
+		IntType lowest;
+		lowest.SetMin();
+		return FixedType::FromMantissa(lowest);
+	}
+
+	int32 integral;
+	uint64 fraction;
+	FixedLog2(ttmath::UInt<WordCount>(mantissa), Exponent, FractionBits, integral, fraction);
+
+	// integral * Factor + fraction * Factor / 2^FractionBits, with 64 fractional bits
+	ttmath::UInt<2> fractionProduct;
+	ttmath::UInt<1>::MulTwoWords(fraction, Factor, &fractionProduct.table[1], &fractionProduct.table[0]);
+	fractionProduct.Rcr(FractionBits);
+	ttmath::UInt<2> integralProduct;
+	ttmath::UInt<1>::MulTwoWords(ttmath::uint(integral < 0 ? -integral : integral), Factor, &integralProduct.table[1], &integralProduct.table[0]);
+
+	// Then rounded to Exponent fractional bits, with the halves rounded away from zero
+	if (integral < 0)
+	{
+		integralProduct.Sub(fractionProduct);
+	}
+	else
+	{
+		integralProduct.Add(fractionProduct);
+	}
+	ttmath::UInt<2> half;
+	half.SetZero();
+	half.SetBit(63 - Exponent);
+	integralProduct.Add(half);
+	integralProduct.Rcr(64 - Exponent);
+	ttmath::Int<2> product;
+	product.FromUInt(integralProduct);
+	if (integral < 0)
+	{
+		product.ChangeSign();
+	}
+
+	IntType result;
+	result.FromInt(product);
+	return FixedType::FromMantissa(result);
+}
+
+// Binary logarithm, rounded to nearest, and exact for powers of two. Non-positive numbers have no logarithm, and give the lowest number
+template<int MantissaSize, int Exponent>
+real_fixed<MantissaSize, Exponent> Log2(const real_fixed<MantissaSize, Exponent>& x)
+{
+	using FixedType = real_fixed<MantissaSize, Exponent>;
+	using IntType = typename FixedType::ttIntType;
+	const ttmath::uint WordCount = TTMATH_BITS(MantissaSize + Exponent);
+	const int32 GuardBits = Exponent + 8 < 62 ? 8 : 62 - Exponent;
+
+	const IntType mantissa(x.mantissa);
+	if (mantissa.IsSign() || mantissa.IsZero())
+	{
+		IntType lowest;
+		lowest.SetMin();
+		return FixedType::FromMantissa(lowest);
+	}
+
+	int32 integral;
+	uint64 fraction;
+	FixedLog2(ttmath::UInt<WordCount>(mantissa), Exponent, Exponent + GuardBits, integral, fraction);
+
+	IntType fractionPart;
+	if (GuardBits > 0)
+	{
+		fractionPart = IntType(ttmath::sint((fraction + (uint64(1) << (GuardBits - 1))) >> GuardBits));
+	}
+	else
+	{
+		fractionPart = IntType(ttmath::sint(fraction));
+		fractionPart.Rcl(-GuardBits);
+	}
+
+	IntType result(integral);
+	result.Rcl(Exponent);
+	result.Add(fractionPart);
+	return FixedType::FromMantissa(result);
+}
+
+// Natural logarithm, rounded to nearest. Non-positive numbers have no logarithm, and give the lowest number
+template<int MantissaSize, int Exponent>
+real_fixed<MantissaSize, Exponent> Ln(const real_fixed<MantissaSize, Exponent>& x)
+{
+	// ln(2) * 2^64
+	return FixedLogTimes(x, 0xB17217F7D1CF79ACull);
+}
+
+// Base 10 logarithm, rounded to nearest. Non-positive numbers have no logarithm, and give the lowest number
+template<int MantissaSize, int Exponent>
+real_fixed<MantissaSize, Exponent> Log10(const real_fixed<MantissaSize, Exponent>& x)
+{
+	// log10(2) * 2^64
+	return FixedLogTimes(x, 0x4D104D427DE7FBCCull);
+}
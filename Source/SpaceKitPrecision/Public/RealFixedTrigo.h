@@ -0,0 +1,277 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/RealFixedGeneric.h"
+
+#include "CoreMinimal.h"
+
+
+// Trigonometry for fixed point numbers, in radians, with CORDIC. It never leaves the integer domain.
+// Angles are reduced modulo pi/2 on the mantissas, with a 256 bits pi/2, then rotated (sine, cosine) or vectored (arc tangent) with 64 bits integers,
+// with 61 fractional bits. Each iteration only shifts and adds, and adds one more correct bit: Exponent + 6 of them give results within 0.55 lsb of the exact value.
+namespace RealFixedTrigo
+{
+	// Fractional bits of the CORDIC integers. Rotated vectors stay below 8 in absolute value, so they fit in an int64
+	static const int32 WorkingBits = 61;
+	static const int32 MaxIterations = 61;
+
+	// atan(2^-i) * 2^61, rounded to nearest
+	static const int64 AngleTable[MaxIterations + 1] =
+	{
+		0x1921FB54442D1847ll, 0x0ED63382B0DDA7B4ll, 0x07D6DD7E4B203759ll,
+		0x03FAB7535585EDB9ll, 0x01FF55BB72CFDE9Cll, 0x00FFEAADDD4BB125ll,
+		0x007FFD556EEDCA6Bll, 0x003FFFAAAB77752Ell, 0x001FFFF5555BBBB7ll,
+		0x000FFFFEAAAADDDEll, 0x0007FFFFD55556EFll, 0x0003FFFFFAAAAAB7ll,
+		0x0001FFFFFF555556ll, 0x0000FFFFFFEAAAABll, 0x00007FFFFFFD5555ll,
+		0x00003FFFFFFFAAABll, 0x00001FFFFFFFF555ll, 0x00000FFFFFFFFEABll,
+		0x000007FFFFFFFFD5ll, 0x000003FFFFFFFFFBll, 0x000001FFFFFFFFFFll,
+		0x0000010000000000ll, 0x0000008000000000ll, 0x0000004000000000ll,
+		0x0000002000000000ll, 0x0000001000000000ll, 0x0000000800000000ll,
+		0x0000000400000000ll, 0x0000000200000000ll, 0x0000000100000000ll,
+		0x0000000080000000ll, 0x0000000040000000ll, 0x0000000020000000ll,
+		0x0000000010000000ll, 0x0000000008000000ll, 0x0000000004000000ll,
+		0x0000000002000000ll, 0x0000000001000000ll, 0x0000000000800000ll,
+		0x0000000000400000ll, 0x0000000000200000ll, 0x0000000000100000ll,
+		0x0000000000080000ll, 0x0000000000040000ll, 0x0000000000020000ll,
+		0x0000000000010000ll, 0x0000000000008000ll, 0x0000000000004000ll,
+		0x0000000000002000ll, 0x0000000000001000ll, 0x0000000000000800ll,
+		0x0000000000000400ll, 0x0000000000000200ll, 0x0000000000000100ll,
+		0x0000000000000080ll, 0x0000000000000040ll, 0x0000000000000020ll,
+		0x0000000000000010ll, 0x0000000000000008ll, 0x0000000000000004ll,
+		0x0000000000000002ll, 0x0000000000000001ll,
+	};
+
+	// 1 / prod(sqrt(1 + 2^-2i)), the inverse of the CORDIC gain, pi and pi/2, times 2^61
+	static const int64 InverseGain = 0x136E9DB5086BCB4Dll;
+	static const int64 Pi = 0x6487ED5110B4611All;
+	static const int64 HalfPi = 0x3243F6A8885A308Dll;
+
+	// pi/2 * 2^254, lowest word first
+	static const int32 ReductionBits = 254;
+	static const uint64 ReductionHalfPi[4] = { 0x0105DF531D89CD91ull, 0x948127044533E63Aull, 0x62633145C06E0E68ull, 0x6487ED5110B4611Aull };
+
+	// Iterations needed for a result correct to 2^-(Exponent + 4) before rounding
+	constexpr int32 NumIterations(int32 Exponent)
+	{
+		return Exponent + 6 < MaxIterations ? Exponent + 6 : MaxIterations;
+	}
+
+	// Rounds a CORDIC integer to a mantissa with Exponent fractional bits, with the halves rounded away from zero
+	template<typename IntType>
+	IntType ToMantissa(int64 Value, int32 Exponent)
+	{
+		const bool bNegative = Value < 0;
+		const uint64 Magnitude = bNegative ? uint64(0) - uint64(Value) : uint64(Value);
+		const int32 Shift = WorkingBits - Exponent;
+		IntType Result(ttmath::sint((Magnitude + (uint64(1) << (Shift - 1))) >> Shift));
+		if (bNegative)
+		{
+			Result.ChangeSign();
+		}
+		return Result;
+	}
+
+	// Splits |Magnitude * 2^-Exponent| into Quadrant * pi/2 + OutReduced, with OutReduced in [-pi/4, pi/4], with 61 fractional bits. Returns the quadrant, modulo 4.
+	// The 256 bits pi/2 keeps the reduction exact to 2^-61 for any magnitude up to 2^190
+	template<ttmath::uint WordCount>
+	int32 ReduceHalfPi(const ttmath::UInt<WordCount>& Magnitude, int32 Exponent, int64& OutReduced)
+	{
+		using WideUIntType = ttmath::UInt<WordCount + 4>;
+
+		// Angles below 4 already fit in the CORDIC integers, and only need a few subtractions of pi/2
+		ttmath::uint TableId, Index;
+		if (!Magnitude.FindLeadingBit(TableId, Index) || int32(TableId * TTMATH_BITS_PER_UINT + Index) < Exponent + 2)
+		{
+			OutReduced = int64(Magnitude.table[0] << (WorkingBits - Exponent));
+			int32 Quadrant = 0;
+			while (OutReduced > AngleTable[0])
+			{
+				OutReduced -= HalfPi;
+				Quadrant++;
+			}
+			return Quadrant;
+		}
+
+		WideUIntType Quotient, Divisor, Remainder;
+		Quotient.SetZero();
+		Divisor.SetZero();
+		for (ttmath::uint Index = 0; Index < WordCount; Index++)
+		{
+			Quotient.table[Index] = Magnitude.table[Index];
+		}
+		for (ttmath::uint Index = 0; Index < 4; Index++)
+		{
+			Divisor.table[Index] = ReductionHalfPi[Index];
+		}
+		Quotient.Rcl(ReductionBits - Exponent);
+		Quotient.Div(Divisor, Remainder);
+
+		// The remainder is in [0, pi/2), and below 2^255, so it's rounded to 61 bits in an int64
+		const int32 Shift = ReductionBits - WorkingBits;
+		WideUIntType Half;
+		Half.SetZero();
+		Half.SetBit(Shift - 1);
+		Remainder.Add(Half);
+		Remainder.Rcr(Shift);
+		OutReduced = int64(Remainder.table[0]);
+
+		int32 Quadrant = int32(Quotient.table[0] & 3);
+		if (OutReduced > AngleTable[0])
+		{
+			OutReduced -= HalfPi;
+			Quadrant = (Quadrant + 1) & 3;
+		}
+		return Quadrant;
+	}
+
+	// Rotates (1/gain, 0) by Angle, in [-pi/2, pi/2], giving (cos(Angle), sin(Angle))
+	inline void Rotate(int64 Angle, int32 Iterations, int64& OutCos, int64& OutSin)
+	{
+		int64 X = InverseGain;
+		int64 Y = 0;
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			const int64 ShiftedX = X >> Iteration;
+			const int64 ShiftedY = Y >> Iteration;
+			if (Angle >= 0)
+			{
+				X -= ShiftedY;
+				Y += ShiftedX;
+				Angle -= AngleTable[Iteration];
+			}
+			else
+			{
+				X += ShiftedY;
+				Y -= ShiftedX;
+				Angle += AngleTable[Iteration];
+			}
+		}
+		OutCos = X;
+		OutSin = Y;
+	}
+
+	// Rotates (X, Y), with X > 0, to the X axis, and returns the angle it was rotated by, i.e. atan(Y / X)
+	inline int64 Vector(int64 X, int64 Y, int32 Iterations)
+	{
+		int64 Angle = 0;
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			const int64 ShiftedX = X >> Iteration;
+			const int64 ShiftedY = Y >> Iteration;
+			if (Y > 0)
+			{
+				X += ShiftedY;
+				Y -= ShiftedX;
+				Angle += AngleTable[Iteration];
+			}
+			else
+			{
+				X -= ShiftedY;
+				Y += ShiftedX;
+				Angle -= AngleTable[Iteration];
+			}
+		}
+		return Angle;
+	}
+}
+
+// Sine and cosine of an angle in radians
+template<int MantissaSize, int Exponent>
+void SinCos(const real_fixed<MantissaSize, Exponent>& x, real_fixed<MantissaSize, Exponent>& OutSin, real_fixed<MantissaSize, Exponent>& OutCos)
+{
+	static_assert(Exponent < RealFixedTrigo::WorkingBits, "CORDIC integers have 61 fractional bits");
+
+	using FixedType = real_fixed<MantissaSize, Exponent>;
+	using IntType = typename FixedType::ttIntType;
+	const ttmath::uint WordCount = TTMATH_BITS(MantissaSize + Exponent);
+
+	const IntType mantissa(x.mantissa);
+	int64 reduced;
+	const int32 quadrant = RealFixedTrigo::ReduceHalfPi(ttmath::UInt<WordCount>(ttmath::Abs(mantissa)), Exponent, reduced);
+
+	int64 cos, sin;
+	RealFixedTrigo::Rotate(reduced, RealFixedTrigo::NumIterations(Exponent), cos, sin);
+
+	// sin(x + k pi/2) and cos(x + k pi/2), then sin(-x) = -sin(x)
+	const int64 sinSigned = quadrant == 0 ? sin : quadrant == 1 ? cos : quadrant == 2 ? -sin : -cos;
+	const int64 cosSigned = quadrant == 0 ? cos : quadrant == 1 ? -sin : quadrant == 2 ? -cos : sin;
+	OutSin = FixedType::FromMantissa(RealFixedTrigo::ToMantissa<IntType>(mantissa.IsSign() ? -sinSigned : sinSigned, Exponent));
+	OutCos = FixedType::FromMantissa(RealFixedTrigo::ToMantissa<IntType>(cosSigned, Exponent));
+}
+
+template<int MantissaSize, int Exponent>
+real_fixed<MantissaSize, Exponent> Sin(const real_fixed<MantissaSize, Exponent>& x)
+{
+	real_fixed<MantissaSize, Exponent> sin, cos;
+	SinCos(x, sin, cos);
+	return sin;
+}
+
+template<int MantissaSize, int Exponent>
+real_fixed<MantissaSize, Exponent> Cos(const real_fixed<MantissaSize, Exponent>& x)
+{
+	real_fixed<MantissaSize, Exponent> sin, cos;
+	SinCos(x, sin, cos);
+	return cos;
+}
+
+// Angle of (x, y) with the X axis, in radians, in [-pi, pi]. ATan2(0, 0) is 0
+template<int MantissaSize, int Exponent>
+real_fixed<MantissaSize, Exponent> ATan2(const real_fixed<MantissaSize, Exponent>& y, const real_fixed<MantissaSize, Exponent>& x)
+{
+	static_assert(Exponent < RealFixedTrigo::WorkingBits, "CORDIC integers have 61 fractional bits");
+
+	using FixedType = real_fixed<MantissaSize, Exponent>;
+	using IntType = typename FixedType::ttIntType;
+	const ttmath::uint WordCount = TTMATH_BITS(MantissaSize + Exponent);
+	using UIntType = ttmath::UInt<WordCount>;
+
+	const IntType xMantissa(x.mantissa);
+	const IntType yMantissa(y.mantissa);
+	if (xMantissa.IsZero() && yMantissa.IsZero())
+	{
+		return FixedType::FromMantissa(typename FixedType::ttIntMantissaType(0));
+	}
+
+	// Scale both magnitudes by the same power of two, so the biggest one is in [1, 2) with 60 fractional bits. Only their ratio matters
+	UIntType xMagnitude(ttmath::Abs(xMantissa));
+	UIntType yMagnitude(ttmath::Abs(yMantissa));
+	ttmath::uint tableId, index;
+	(xMagnitude > yMagnitude ? xMagnitude : yMagnitude).FindLeadingBit(tableId, index);
+	const int32 leadingBit = int32(tableId * TTMATH_BITS_PER_UINT + index);
+	if (leadingBit > 60)
+	{
+		xMagnitude.Rcr(leadingBit - 60);
+		yMagnitude.Rcr(leadingBit - 60);
+	}
+	else
+	{
+		xMagnitude.Rcl(60 - leadingBit);
+		yMagnitude.Rcl(60 - leadingBit);
+	}
+	int64 xScaled = int64(xMagnitude.table[0]);
+	int64 yScaled = int64(yMagnitude.table[0]);
+	if (xMantissa.IsSign()) xScaled = -xScaled;
+	if (yMantissa.IsSign()) yScaled = -yScaled;
+
+	// Vectoring needs X > 0: rotate by pi first, otherwise. The side comes from y's mantissa, as a y much smaller than x is scaled to 0
+	int64 angle = 0;
+	if (xScaled < 0)
+	{
+		angle = yMantissa.IsSign() ? -RealFixedTrigo::Pi : RealFixedTrigo::Pi;
+		xScaled = -xScaled;
+		yScaled = -yScaled;
+	}
+	angle += RealFixedTrigo::Vector(xScaled, yScaled, RealFixedTrigo::NumIterations(Exponent));
+
+	return FixedType::FromMantissa(RealFixedTrigo::ToMantissa<IntType>(angle, Exponent));
+}
+
+// Arc tangent, in radians, in [-pi/2, pi/2]
+template<int MantissaSize, int Exponent>
+real_fixed<MantissaSize, Exponent> ATan(const real_fixed<MantissaSize, Exponent>& x)
+{
+	using FixedType = real_fixed<MantissaSize, Exponent>;
+	return ATan2(x, FixedType::FromMantissa(FixedType::GetExponentiatedTtInt()));
+}
@@ -2,12 +2,11 @@
 
 #pragma once
 
-// Include ttmath
-#pragma warning(push)
-#pragma warning(disable: 5051)
-#define TTMATH_NOASM // That's super sad to not include ASM, but otherwise, it doesn't compile on MSVC/UE4
-#include "SpaceKitPrecision/Private/ttmath/ttmath.h"
-#pragma warning(pop)
+#include "SpaceKitPrecision/Public/TtmathConfig.h"
+#include "SpaceKitPrecision/Public/MultiDouble.h"
+#include "SpaceKitPrecision/Public/Float128.h"
+#include "SpaceKitPrecision/Public/RealFloatGeneric.h"
+#include "SpaceKitPrecision/Public/RealFloatConstants.h"
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "PrecisionSettings.h"
@@ -18,8 +17,29 @@
 
 #include "RealFloat.generated.h"
 
-using float256 = boost::multiprecision::number<boost::multiprecision::backends::cpp_bin_float<BOOST_REAL_FLOAT_SIZE,
-    boost::multiprecision::backends::digit_base_2>, boost::multiprecision::et_off>;
+// Boost numbers, with or without expression templates
+template<boost::multiprecision::expression_template_option ExpressionTemplates>
+using TBoostFloat = boost::multiprecision::number<boost::multiprecision::backends::cpp_bin_float<BOOST_REAL_FLOAT_SIZE,
+    boost::multiprecision::backends::digit_base_2>, ExpressionTemplates>;
+
+using float256 = TBoostFloat<BOOST_EXPRESSION_TEMPLATES ? boost::multiprecision::et_on : boost::multiprecision::et_off>;
+
+// Whether FRealFloat is stored in a __float128: it's selected, and the compiler has it. Else FRealFloat falls back to the ttmath storage
+#define USE_FLOAT128_STORAGE (USE_FLOAT128_BIG && SPACEKIT_HAS_FLOAT128)
+
+// The storages other than ttmath::Big and boost (multi-doubles and binary128 numbers) mirror the subset of ttmath::Big's interface that FRealFloat uses:
+// construction from integers, doubles and strings, ToDouble, ToString, IsSign, IsZero, and the arithmetic and comparison operators.
+// They also convert explicitly from and to any ttmath::Big, through FromBig and ToBig, so code can get a ttmath float out of FRealFloat whatever its storage is,
+// and their namespace has math functions named as ttmath's, so FRealFloat calls them the same way.
+
+// Namespace of the math functions (Sin, Sqrt, Exp...) that work on FRealFloat's storage
+#if USE_MULTI_DOUBLE_BIG
+namespace RealFloatBackend = ddmath;
+#elif USE_FLOAT128_STORAGE
+namespace RealFloatBackend = f128math;
+#else
+namespace RealFloatBackend = ttmath;
+#endif
 
 struct FRealFixed;
 /**
@@ -35,30 +55,61 @@ struct SPACEKITPRECISION_API FRealFloat
     // Typedef for the actual storage
 #if USE_BOOST_BIG
     using ttBigType = float256;
+#elif USE_MULTI_DOUBLE_BIG
+    using ttBigType = ddmath::MultiDouble<MULTI_DOUBLE_SIZE>;
+#elif USE_FLOAT128_STORAGE
+    using ttBigType = f128math::Float128;
 #else
     // Alternatively, if you prefer to use the ttmath numbers, you can use this
-    using ttBigType = ttmath::Big<TTMATH_BITS(64), TTMATH_BITS(TT_REAL_FLOAT_SIZE)>; 
+    using ttBigType = TRealFloat<TT_REAL_FLOAT_SIZE>::ttBigType;
 #endif
 
 /*
  * After a LOT of trial and error, we chose this solution to interface big numbers to UE4:
  * It permits to serialize data automatically, in a way that works with all UE4 systems, including FProperty (only using a custom serializer is not sufficient for editor related stuff).
  * The idea here is to store the data in a c-style (statically allocated) array, that will be used by UE4 internally.
- * It's exposed for *internal* C++ usage, so consider it private. The Value reference is just a reinterpret_cast reference to the bytes of InternalValue.
+ * It's exposed for *internal* C++ usage through GetValue(), that just reinterpret_casts the bytes of InternalValue.
+ * There is no other member, so FRealFloat is exactly as big as ttBigType, and is trivially copyable: arrays of it can be memcpy'd and relocated in bulk.
+ * TIsPODType says so to UE4's containers, for FRealFloat and for the vectors, rotators and quaternions made only of it.
  */
 protected:
     UPROPERTY()
     uint8 InternalValue[sizeof ttBigType];
+
 public:
-	ttBigType& Value = *reinterpret_cast<ttBigType*>(InternalValue);
+
+    FORCEINLINE ttBigType& GetValue()
+    {
+        return *reinterpret_cast<ttBigType*>(InternalValue);
+    }
+
+    FORCEINLINE const ttBigType& GetValue() const
+    {
+        return *reinterpret_cast<const ttBigType*>(InternalValue);
+    }
 
 public:
 
     FRealFloat();
 
-    FRealFloat(const FRealFloat& InValue);
+    FRealFloat(const FRealFloat& InValue) = default;
 
-    explicit FRealFloat(const ttBigType& InValue);
+    FRealFloat(FRealFloat&& InValue) = default;
+
+    // Inline, as every operator builds its result with it
+    explicit FRealFloat(const ttBigType& InValue)
+    {
+        GetValue() = InValue;
+    }
+
+#if USE_BOOST_BIG && BOOST_EXPRESSION_TEMPLATES
+    // With expression templates, the operators on the storage return expressions. They are evaluated here, straight into this number's storage
+    template<class Tag, class Arg1, class Arg2, class Arg3, class Arg4>
+    explicit FRealFloat(const boost::multiprecision::detail::expression<Tag, Arg1, Arg2, Arg3, Arg4>& InExpression)
+    {
+        GetValue() = InExpression;
+    }
+#endif
 
     explicit FRealFloat(int32 InValue);
 
@@ -78,11 +129,43 @@ public:
 
     explicit FRealFloat(const FString& InValue);
 
-    FRealFloat& operator=(const FRealFloat& Other)
+    // Builds a number from the words of its storage. This is constexpr, so static numbers built this way are constant-initialized
+    template<int32 NumWords>
+    explicit constexpr FRealFloat(const RealFloatConstants::TRawStorage<NumWords>& InStorage)
+        : InternalValue{}
     {
-        Value = Other.Value;
-        return *this;
-    };
+        static_assert(NumWords * sizeof(uint64) == sizeof(ttBigType), "The raw storage must be exactly as big as the number's storage");
+        for (int32 Index = 0; Index < int32(sizeof(ttBigType)); Index++)
+        {
+            InternalValue[Index] = uint8(InStorage.Words[Index / 8] >> (8 * (Index % 8)));
+        }
+    }
+
+    // Converts a floating-point number of any precision to this one's. The mantissa is rounded to nearest if this one is smaller
+    template<int Bits>
+    explicit FRealFloat(const TRealFloat<Bits>& InValue)
+    {
+#if USE_BOOST_BIG || USE_MULTI_DOUBLE_BIG || USE_FLOAT128_STORAGE
+        GetValue() = ttBigType(InValue.Value);
+#else
+        GetValue() = RoundBig<ttBigType>(InValue.Value);
+#endif
+    }
+
+    FRealFloat& operator=(const FRealFloat& Other) = default;
+
+    FRealFloat& operator=(FRealFloat&& Other) = default;
+
+    // Converts this number to a floating-point number of any precision. The mantissa is rounded to nearest if that one is smaller
+    template<int Bits>
+    explicit operator TRealFloat<Bits>() const
+    {
+#if USE_BOOST_BIG || USE_MULTI_DOUBLE_BIG || USE_FLOAT128_STORAGE
+        return TRealFloat<Bits>(typename TRealFloat<Bits>::ttBigType(GetValue()));
+#else
+        return TRealFloat<Bits>(RoundBig<typename TRealFloat<Bits>::ttBigType>(GetValue()));
+#endif
+    }
 
     // Converts this number to a double number. Note that this can lead to huge precision loss
     double ToDouble() const;
@@ -90,6 +173,17 @@ public:
     // Converts this number to a float number. Note that this can lead to huge precision loss
     float ToFloat() const;
 
+    // Size of the buffers ToChars writes to, in characters, including the null terminator
+    static constexpr int32 StringBufferSize = DecimalConversion::FloatBufferSize(int32(sizeof(ttBigType)) * 8);
+
+    // Writes this number in base 10 to Buffer, which must hold StringBufferSize characters, without allocating. Returns the number of characters written.
+    // It has the fewest significant digits that parse back to this number
+    int32 ToChars(TCHAR* Buffer) const;
+
+    // Reads a base 10 number at Buffer, in a single pass and without allocating, and moves Buffer past it. It's rounded to nearest.
+    // Returns false if there is no number at Buffer, and then leaves Buffer and this number unchanged. See DecimalConversion::ParseDecimal for the syntax
+    bool InitFromChars(const TCHAR*& Buffer);
+
     FString ToString() const;
 
     explicit operator int32() const
@@ -109,7 +203,28 @@ public:
     static FRealFloat DegToRad;
 };
 
-SPACEKITPRECISION_API FRealFloat operator""_fl(const char* str);
+// Each literal is parsed once, the first time its expression runs: every literal has its own instantiation, and so its own static value
+template<char... Chars>
+FRealFloat operator""_fl()
+{
+    static const char String[] = { Chars..., '\0' };
+    static const FRealFloat Value(String);
+    return Value;
+}
+
+static_assert(sizeof(FRealFloat) == sizeof(FRealFloat::ttBigType), "FRealFloat must not add any overhead to its storage");
+
+template<>
+struct TIsPODType<FRealFloat>
+{
+    enum { Value = true };
+};
+
+template<>
+struct TCanBulkSerialize<FRealFloat>
+{
+    enum { Value = true };
+};
 
 // Type traits, so UE4 knows FRealFloat implements ExportTextItem and ImportTextItem
 template<>
@@ -119,23 +234,25 @@ struct TStructOpsTypeTraits<FRealFloat> : public TStructOpsTypeTraitsBase2<FReal
     {
         WithExportTextItem = true,
         WithImportTextItem = true,
+        WithNoDestructor = true,
     };
 };
 
 
 inline FRealFloat operator+(const FRealFloat& x, const FRealFloat& y)
 {
-    return FRealFloat(x.Value + y.Value);
+    return FRealFloat(x.GetValue() + y.GetValue());
 }
 
-inline FRealFloat operator+=(FRealFloat& x, const FRealFloat& y)
+inline FRealFloat& operator+=(FRealFloat& x, const FRealFloat& y)
 {
-    return x = x + y;
+    x.GetValue() += y.GetValue();
+    return x;
 }
 
 inline FRealFloat operator-(const FRealFloat& x, const FRealFloat& y)
 {
-    return FRealFloat(x.Value - y.Value);
+    return FRealFloat(x.GetValue() - y.GetValue());
 }
 
 inline FRealFloat operator-(double x, const FRealFloat& y)
@@ -143,78 +260,117 @@ inline FRealFloat operator-(double x, const FRealFloat& y)
     return FRealFloat(x) - y;
 }
 
-inline FRealFloat operator-=(FRealFloat& x, const FRealFloat& y)
+inline FRealFloat& operator-=(FRealFloat& x, const FRealFloat& y)
 {
-    return x = FRealFloat(x - y);
+    x.GetValue() -= y.GetValue();
+    return x;
 }
 
 inline FRealFloat operator-(const FRealFloat& x)
 {
-    return FRealFloat(-x.Value);
+    return FRealFloat(-x.GetValue());
 }
 
 inline FRealFloat operator*(const FRealFloat& x, const FRealFloat& y)
 {
-    return FRealFloat(x.Value * y.Value);
+    return FRealFloat(x.GetValue() * y.GetValue());
 }
 
-inline FRealFloat operator*=(FRealFloat& x, const FRealFloat& y)
+inline FRealFloat& operator*=(FRealFloat& x, const FRealFloat& y)
 {
-    return x = x * y;
+    x.GetValue() *= y.GetValue();
+    return x;
 }
 
 inline FRealFloat operator/(const FRealFloat& x, const FRealFloat& y)
 {
-    return FRealFloat(x.Value / y.Value);
+    return FRealFloat(x.GetValue() / y.GetValue());
 }
 
-inline FRealFloat operator/=(FRealFloat& x, const FRealFloat& y)
+inline FRealFloat& operator/=(FRealFloat& x, const FRealFloat& y)
 {
-    return x = x / y;
+    x.GetValue() /= y.GetValue();
+    return x;
 }
 
 inline FRealFloat operator%(const FRealFloat& x, const FRealFloat& y)
 {
     FRealFloat a;
-    //FRealFloat::ttBigType Result = x.Value;
-    // Result %= y.Value;
+    //FRealFloat::ttBigType Result = x.GetValue();
+    // Result %= y.GetValue();
     // return FRealFloat(Result);
     return FRealFloat(0);
 }
 
-inline FRealFloat operator%=(FRealFloat&& x, const FRealFloat& y)
+inline FRealFloat& operator%=(FRealFloat& x, const FRealFloat& y)
 {
     return x = x % y;
 }
 
+// A divisor, with its inverse precomputed, to divide many numbers by the same one, e.g. by a body's mass or by a vector's size.
+// Dividing by it is a multiplication by the inverse, which is several times cheaper than a division.
+// The inverse is rounded once, so the quotients can differ from the actual division's in their last bit. Vectors and rotators divided by a FRealFloat make one, so the division runs once, not per component
+struct FRealFloatReciprocal
+{
+    explicit FRealFloatReciprocal(const FRealFloat& InDivisor)
+        : Divisor(InDivisor), Inverse(FRealFloat(1) / InDivisor)
+    {
+    }
+
+    const FRealFloat& GetDivisor() const
+    {
+        return Divisor;
+    }
+
+    const FRealFloat& GetInverse() const
+    {
+        return Inverse;
+    }
+
+private:
+    FRealFloat Divisor;
+    FRealFloat Inverse;
+};
+
+inline FRealFloat operator/(const FRealFloat& x, const FRealFloatReciprocal& y)
+{
+    return x * y.GetInverse();
+}
+
+inline FRealFloat& operator/=(FRealFloat& x, const FRealFloatReciprocal& y)
+{
+    x.GetValue() *= y.GetInverse().GetValue();
+    return x;
+}
+
 inline bool operator<(const FRealFloat& x, const FRealFloat& y)
 {
-    return x.Value < y.Value;
+    return x.GetValue() < y.GetValue();
 }
 
 inline bool operator<=(const FRealFloat& x, const FRealFloat& y)
 {
-    return x.Value <= y.Value;
+    return x.GetValue() <= y.GetValue();
 }
 
 inline bool operator>=(const FRealFloat& x, const FRealFloat& y)
 {
-    return x.Value >= y.Value;
+    return x.GetValue() >= y.GetValue();
 }
 
 inline bool operator>(const FRealFloat& x, const FRealFloat& y)
 {
-    return x.Value > y.Value;
+    return x.GetValue() > y.GetValue();
 }
 
 inline bool operator==(const FRealFloat& x, const FRealFloat& y)
 {
-    return x.Value == y.Value;
+    return x.GetValue() == y.GetValue();
 }
 
 inline bool operator!=(const FRealFloat& x, const FRealFloat& y)
 {
-    return x.Value != y.Value;
+    return x.GetValue() != y.GetValue();
 }
 
 /**
@@ -229,16 +385,16 @@ class SPACEKITPRECISION_API URealFloatMath : public UBlueprintFunctionLibrary
 public:
     // Makes a FRealFloat value. It's a custom type, because UE4 doesn't support it out of the box
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (BlueprintThreadSafe))
-    static FRealFloat Make(FRealFloat From) { return From; }
+    static FRealFloat Make(const FRealFloat& From) { return From; }
 
 // Basic conversions
 public:
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat to String", CompactNodeTitle = "->", BlueprintAutocast))
-    static FString ConvRealToString(FRealFloat InReal);
+    static FString ConvRealToString(const FRealFloat& InReal);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat to Float", CompactNodeTitle = "->", BlueprintAutocast))
-    static float ConvRealToFloat(FRealFloat InVal);
+    static float ConvRealToFloat(const FRealFloat& InVal);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "String to RealFloat", CompactNodeTitle = "->", BlueprintAutocast))
     static FRealFloat ConvStringToReal(const FString& InString);
@@ -250,120 +406,151 @@ public:
 public:
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta=(DisplayName = "RealFloat + RealFloat", CompactNodeTitle="+"))
-    static FRealFloat RealPlusReal(FRealFloat First, FRealFloat Second);
+    static FRealFloat RealPlusReal(const FRealFloat& First, const FRealFloat& Second);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta=(DisplayName = "RealFloat - RealFloat", CompactNodeTitle="-"))
-    static FRealFloat RealMinusReal(FRealFloat First, FRealFloat Second);
+    static FRealFloat RealMinusReal(const FRealFloat& First, const FRealFloat& Second);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta=(DisplayName = "RealFloat * RealFloat", CompactNodeTitle="*"))
-    static FRealFloat RealMultReal(FRealFloat First, FRealFloat Second);
+    static FRealFloat RealMultReal(const FRealFloat& First, const FRealFloat& Second);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta=(DisplayName = "RealFloat / RealFloat", CompactNodeTitle="/"))
-    static FRealFloat RealDivReal(FRealFloat First, FRealFloat Second);
+    static FRealFloat RealDivReal(const FRealFloat& First, const FRealFloat& Second);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat == RealFloat", CompactNodeTitle = "=="))
-    static bool RealEqualsReal(FRealFloat First, FRealFloat Second, FRealFloat Tolerance);
+    static bool RealEqualsReal(const FRealFloat& First, const FRealFloat& Second, const FRealFloat& Tolerance);
 
     UFUNCTION(BlueprintPure, category = "RealFixed", meta = (DisplayName = "RealFixed != RealFixed", CompactNodeTitle = "!="))
     static bool RealNotEqualsReal(const FRealFloat& First, const FRealFloat& Second, const FRealFloat& Tolerance);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat < RealFloat", CompactNodeTitle = "<"))
-    static bool RealInfReal(FRealFloat First, FRealFloat Second);
+    static bool RealInfReal(const FRealFloat& First, const FRealFloat& Second);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat <= RealFloat", CompactNodeTitle = "<="))
-    static bool RealInfEqReal(FRealFloat First, FRealFloat Second);
+    static bool RealInfEqReal(const FRealFloat& First, const FRealFloat& Second);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat > RealFloat", CompactNodeTitle = ">"))
-    static bool RealSupReal(FRealFloat First, FRealFloat Second);
+    static bool RealSupReal(const FRealFloat& First, const FRealFloat& Second);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat >= RealFloat", CompactNodeTitle = ">="))
-    static bool RealSupEqReal(FRealFloat First, FRealFloat Second);
+    static bool RealSupEqReal(const FRealFloat& First, const FRealFloat& Second);
+
+// Fused FRealFloat math: the products are summed exactly, and rounded only once. See SumOfProducts in RealFloatGeneric.h
+public:
+
+    UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat * RealFloat + RealFloat"))
+    static FRealFloat MultiplyAdd(const FRealFloat& X, const FRealFloat& Y, const FRealFloat& Z);
+
+    // Computes X0 * Y0 + X1 * Y1
+    static FRealFloat SumOfProducts(const FRealFloat& X0, const FRealFloat& Y0, const FRealFloat& X1, const FRealFloat& Y1);
+
+    // Computes X0 * Y0 + X1 * Y1 + X2 * Y2
+    static FRealFloat SumOfProducts(const FRealFloat& X0, const FRealFloat& Y0, const FRealFloat& X1, const FRealFloat& Y1, const FRealFloat& X2, const FRealFloat& Y2);
+
+    // Computes X0 * Y0 + X1 * Y1 + X2 * Y2 + X3 * Y3
+    static FRealFloat SumOfProducts(const FRealFloat& X0, const FRealFloat& Y0, const FRealFloat& X1, const FRealFloat& Y1, const FRealFloat& X2, const FRealFloat& Y2, const FRealFloat& X3, const FRealFloat& Y3);
 
 // Advanced FRealFloat math
 public:
     
     UFUNCTION(BlueprintPure, category = "RealFloat")
-    static FRealFloat NormalizeAngleRad(FRealFloat InVal);
+    static FRealFloat NormalizeAngleRad(const FRealFloat& InVal);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat sin (Radians)", CompactNodeTitle = "SINr"))
-    static FRealFloat SinRad(FRealFloat InVal);
+    static FRealFloat SinRad(const FRealFloat& InVal);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat cos (Radians)", CompactNodeTitle = "COSr"))
-    static FRealFloat CosRad(FRealFloat InVal);
+    static FRealFloat CosRad(const FRealFloat& InVal);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat sin (Radians)", CompactNodeTitle = "TANr"))
-    static FRealFloat TanRad(FRealFloat InVal);
+    static FRealFloat TanRad(const FRealFloat& InVal);
+
+    // Computes both the sine and the cosine, sharing the range reduction
+    UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat sincos (Radians)"))
+    static void SinCosRad(const FRealFloat& InVal, FRealFloat& OutSin, FRealFloat& OutCos);
     
     UFUNCTION(BlueprintPure, category = "RealFloat")
-    static FRealFloat NormalizeAngleDeg(FRealFloat InVal);
+    static FRealFloat NormalizeAngleDeg(const FRealFloat& InVal);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat sin (Degrees)", CompactNodeTitle = "SINd"))
-    static FRealFloat SinDeg(FRealFloat InVal);
+    static FRealFloat SinDeg(const FRealFloat& InVal);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat cos (Degrees)", CompactNodeTitle = "COSd"))
-    static FRealFloat CosDeg(FRealFloat InVal);
+    static FRealFloat CosDeg(const FRealFloat& InVal);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat sin (Degrees)", CompactNodeTitle = "TANd"))
-    static FRealFloat TanDeg(FRealFloat InVal);
+    static FRealFloat TanDeg(const FRealFloat& InVal);
+
+    // Computes both the sine and the cosine, sharing the range reduction. The reduction is exact in degrees, so e.g. the cosine of 90 is exactly 0
+    UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat sincos (Degrees)"))
+    static void SinCosDeg(const FRealFloat& InVal, FRealFloat& OutSin, FRealFloat& OutCos);
 
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat asin (Radians)", CompactNodeTitle = "ASINr"))
-    static FRealFloat AsinRad(FRealFloat InVal);
+    static FRealFloat AsinRad(const FRealFloat& InVal);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat acos (Radians)", CompactNodeTitle = "ACOSr"))
-    static FRealFloat AcosRad(FRealFloat InVal);
+    static FRealFloat AcosRad(const FRealFloat& InVal);
     
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat atan(Radians)", CompactNodeTitle = "ATANr"))
-    static FRealFloat AtanRad(FRealFloat InVal);
+    static FRealFloat AtanRad(const FRealFloat& InVal);
     
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat atan(Radians)", CompactNodeTitle = "ATANr"))
-    static FRealFloat Atan2Rad(FRealFloat Y, FRealFloat X);
+    static FRealFloat Atan2Rad(const FRealFloat& Y, const FRealFloat& X);
     
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat asin (Degrees)", CompactNodeTitle = "ASINd"))
-    static FRealFloat AsinDeg(FRealFloat InVal);
+    static FRealFloat AsinDeg(const FRealFloat& InVal);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat acos (Degrees)", CompactNodeTitle = "ACOSd"))
-    static FRealFloat AcosDeg(FRealFloat InVal);
+    static FRealFloat AcosDeg(const FRealFloat& InVal);
     
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat atan (Degrees)", CompactNodeTitle = "ATANd"))
-    static FRealFloat AtanDeg(FRealFloat InVal);
+    static FRealFloat AtanDeg(const FRealFloat& InVal);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "RealFloat atan (Degrees)", CompactNodeTitle = "ATANd"))
-    static FRealFloat Atan2Deg(FRealFloat Y, FRealFloat X);
+    static FRealFloat Atan2Deg(const FRealFloat& Y, const FRealFloat& X);
 
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "Pow FRealFloat", CompactNodeTitle = "Pow"))
-    static FRealFloat Pow(FRealFloat X, FRealFloat Y);
+    static FRealFloat Pow(const FRealFloat& X, const FRealFloat& Y);
+
+    // X^Power by square-and-multiply: exact as long as the result fits in the mantissa
+    UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "Pow (Integer) FRealFloat", CompactNodeTitle = "Pow"))
+    static FRealFloat PowInt(const FRealFloat& X, int32 Power);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "Sqrt FRealFloat", CompactNodeTitle = "Sqrt"))
-    static FRealFloat Sqrt(FRealFloat Val);
+    static FRealFloat Sqrt(const FRealFloat& Val);
+
+    // 1 / Sqrt(Val), without the division
+    UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "InvSqrt FRealFloat", CompactNodeTitle = "InvSqrt"))
+    static FRealFloat InvSqrt(const FRealFloat& Val);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "Exp RealFloat", CompactNodeTitle = "Pow"))
-    static FRealFloat Exp(FRealFloat Val);
+    static FRealFloat Exp(const FRealFloat& Val);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "LogE RealFloat", CompactNodeTitle = "LogE"))
-    static FRealFloat LogE(FRealFloat Val);
+    static FRealFloat LogE(const FRealFloat& Val);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "Log2 RealFloat", CompactNodeTitle = "Log2"))
-    static FRealFloat Log2(FRealFloat Val);
+    static FRealFloat Log2(const FRealFloat& Val);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "Log10 RealFloat", CompactNodeTitle = "Log10"))
-    static FRealFloat Log10(FRealFloat Val);
+    static FRealFloat Log10(const FRealFloat& Val);
 
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "Min RealFloat", CompactNodeTitle = "Min"))
-    static FRealFloat Min(FRealFloat First, FRealFloat Second);
+    static FRealFloat Min(const FRealFloat& First, const FRealFloat& Second);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "Max RealFloat", CompactNodeTitle = "Max"))
-    static FRealFloat Max(FRealFloat First, FRealFloat Second);
+    static FRealFloat Max(const FRealFloat& First, const FRealFloat& Second);
 	
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "Clamp RealFloat", CompactNodeTitle = "Clamp"))
-    static FRealFloat Clamp(FRealFloat Val, FRealFloat MinVal, FRealFloat MaxVal);
+    static FRealFloat Clamp(const FRealFloat& Val, const FRealFloat& MinVal, const FRealFloat& MaxVal);
     
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "Abs RealFloat", CompactNodeTitle = "Abs"))
-    static FRealFloat Abs(FRealFloat Val);
+    static FRealFloat Abs(const FRealFloat& Val);
 
     UFUNCTION(BlueprintPure, category = "RealFloat", meta = (DisplayName = "Sign RealFloat", CompactNodeTitle = "Sign"))
-    static FRealFloat Sign(FRealFloat Val);
+    static FRealFloat Sign(const FRealFloat& Val);
 
 };
@@ -0,0 +1,159 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/TtmathConfig.h"
+#include "SpaceKitPrecision/Public/MultiDouble.h"
+#include "SpaceKitPrecision/Public/Float128.h"
+
+#include "CoreMinimal.h"
+
+
+// Mathematical constants of FRealFloat, built from their bits at compile time.
+// Numbers built from a TRawStorage are constant-initialized, so other static initializers can read them whatever the initialization order is,
+// and the constants don't depend on a string parser at startup.
+namespace RealFloatConstants
+{
+	// The 64 bits words of a number's storage, lowest first
+	template<int32 NumWords>
+	struct TRawStorage
+	{
+		uint64 Words[NumWords];
+	};
+
+	// Binary expansions of the constants, highest word first. The first word's highest bit has the weight 2^LeadingPower
+	static constexpr int32 NumExpansionWords = 9;
+
+	static constexpr uint64 PiExpansion[NumExpansionWords] =
+	{
+		0xC90FDAA22168C234ull, 0xC4C6628B80DC1CD1ull, 0x29024E088A67CC74ull,
+		0x020BBEA63B139B22ull, 0x514A08798E3404DDull, 0xEF9519B3CD3A431Bull,
+		0x302B0A6DF25F1437ull, 0x4FE1356D6D51C245ull, 0xE485B576625E7EC6ull,
+	};
+	static constexpr int32 PiLeadingPower = 1;
+
+	static constexpr uint64 DegToRadExpansion[NumExpansionWords] =
+	{
+		0x8EFA351294E9C8AEull, 0x0EC5F66E9485C4D9ull, 0x00B7AEF501B5E6B8ull,
+		0xE502A9B4C94C8512ull, 0xB6F6116781911487ull, 0x10C50C969D5140C9ull,
+		0x60D4A6B49598F1EEull, 0x71B1370F3CABEADCull, 0x5E3CF2D157049E6Bull,
+	};
+	static constexpr int32 DegToRadLeadingPower = -6;
+
+	// The same constants as multi-doubles, as the bits of their components, by decreasing magnitude
+	static constexpr int32 NumComponents = 4;
+
+	static constexpr uint64 PiComponents[NumComponents] = { 0x400921FB54442D18ull, 0x3CA1A62633145C07ull, 0xB92F1976B7ED8FBCull, 0x35C4CF98E804177Dull };
+
+	static constexpr uint64 DegToRadComponents[NumComponents] = { 0x3F91DF46A2529D39ull, 0x3C15C1D8BECDD291ull, 0xB8B1D937FA428858ull, 0x352B5E6B8E502A9Bull };
+
+	// Storage of a constant, for a given storage type
+	template<typename StorageType>
+	struct TConstants;
+
+	// ttmath floats are an exponent word, the mantissa words, and the info byte, padded to a word.
+	// The mantissa is the expansion's highest words, rounded to nearest
+	template<ttmath::uint ManSize>
+	struct TConstants<ttmath::Big<1, ManSize>>
+	{
+		static constexpr int32 NumWords = int32(ManSize) + 2;
+		using StorageType = TRawStorage<NumWords>;
+
+		static_assert(sizeof(ttmath::Big<1, ManSize>) == NumWords * sizeof(uint64), "ttmath floats are expected to be an exponent word, the mantissa words and a padded info byte");
+		static_assert(ManSize < NumExpansionWords, "The expansions of the constants are too short for this precision");
+
+		static constexpr StorageType Make(const uint64 (&Expansion)[NumExpansionWords], int32 LeadingPower, int32 ExtraPower)
+		{
+			StorageType Result = {};
+
+			// value = mantissa * 2^exponent, and the mantissa's highest bit has the weight 2^LeadingPower
+			Result.Words[0] = uint64(int64(LeadingPower + ExtraPower) - int64(ManSize * 64 - 1));
+
+			bool bCarry = (Expansion[ManSize] >> 63) != 0;
+			for (int32 Index = 0; Index < int32(ManSize); Index++)
+			{
+				const uint64 Word = Expansion[ManSize - 1 - Index];
+				Result.Words[1 + Index] = Word + (bCarry ? 1 : 0);
+				bCarry = bCarry && Word == ~0ull;
+			}
+
+			// The info byte is 0, as the constants are positive
+			Result.Words[NumWords - 1] = 0;
+			return Result;
+		}
+
+		static constexpr StorageType Pi() { return Make(PiExpansion, PiLeadingPower, 0); }
+		static constexpr StorageType HalfPi() { return Make(PiExpansion, PiLeadingPower, -1); }
+		static constexpr StorageType DegToRad() { return Make(DegToRadExpansion, DegToRadLeadingPower, 0); }
+	};
+
+	// Multi-doubles are their components. Halving a multi-double only decrements the exponents of its components
+	template<int N>
+	struct TConstants<ddmath::MultiDouble<N>>
+	{
+		static constexpr int32 NumWords = N;
+		using StorageType = TRawStorage<NumWords>;
+
+		static_assert(sizeof(ddmath::MultiDouble<N>) == NumWords * sizeof(uint64), "Multi-doubles are expected to be only their components");
+		static_assert(N <= NumComponents, "The multi-double constants are too short for this precision");
+
+		static constexpr StorageType Make(const uint64 (&Components)[NumComponents], int32 ExtraPower)
+		{
+			StorageType Result = {};
+			for (int32 Index = 0; Index < N; Index++)
+			{
+				Result.Words[Index] = Components[Index] + (uint64(int64(ExtraPower)) << 52);
+			}
+			return Result;
+		}
+
+		static constexpr StorageType Pi() { return Make(PiComponents, 0); }
+		static constexpr StorageType HalfPi() { return Make(PiComponents, -1); }
+		static constexpr StorageType DegToRad() { return Make(DegToRadComponents, 0); }
+	};
+
+#if SPACEKIT_HAS_FLOAT128
+	// Binary128 numbers are the sign, the biased exponent and the 112 highest bits of the fraction in the high word, and the 64 lowest fraction bits in the low word.
+	// The fraction is the expansion's highest 113 bits, without the implicit leading bit, rounded to nearest
+	template<>
+	struct TConstants<f128math::Float128>
+	{
+		static constexpr int32 NumWords = 2;
+		using StorageType = TRawStorage<NumWords>;
+
+		static_assert(sizeof(f128math::Float128) == NumWords * sizeof(uint64), "Binary128 numbers are expected to be only their two words");
+
+		static constexpr StorageType Make(const uint64 (&Expansion)[NumExpansionWords], int32 LeadingPower, int32 ExtraPower)
+		{
+			StorageType Result = {};
+
+			// Fraction bits: 63 from the first word (after its leading bit), and 49 from the second one. Its 15 lowest bits are rounded away
+			uint64 Low = (Expansion[0] << 49) | (Expansion[1] >> 15);
+			uint64 High = (Expansion[0] >> 15) & f128math::HighFractionMask;
+			uint64 BiasedExponent = uint64(LeadingPower + ExtraPower + f128math::ExponentBias);
+			if (((Expansion[1] >> 14) & 1) != 0)
+			{
+				Low++;
+				if (Low == 0)
+				{
+					High++;
+					if (High > f128math::HighFractionMask)
+					{
+						High = 0;
+						BiasedExponent++;
+					}
+				}
+			}
+
+			// The sign bit is 0, as the constants are positive
+			Result.Words[0] = Low;
+			Result.Words[1] = (BiasedExponent << 48) | High;
+			return Result;
+		}
+
+		static constexpr StorageType Pi() { return Make(PiExpansion, PiLeadingPower, 0); }
+		static constexpr StorageType HalfPi() { return Make(PiExpansion, PiLeadingPower, -1); }
+		static constexpr StorageType DegToRad() { return Make(DegToRadExpansion, DegToRadLeadingPower, 0); }
+	};
+#endif
+}
@@ -0,0 +1,333 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/TtmathConfig.h"
+#include "SpaceKitPrecision/Public/MultiDouble.h"
+#include "SpaceKitPrecision/Public/Float128.h"
+#include "SpaceKitPrecision/Public/RealFloatGeneric.h"
+
+#include "CoreMinimal.h"
+
+#include <cmath>
+
+
+// Exponential and logarithm kernels for FRealFloat's and FRealFixed's storages.
+// For ttmath floats, exp reduces its argument modulo ln(2)/64 (Cody-Waite, with ln(2) split in three parts), and uses a table of 2^(j/64).
+// ln splits its argument into a power of two and a mantissa close to a table entry 1 + j/64, and evaluates a short atanh series on the rest.
+// ln(2), ln(10), log2(e) and log10(e) are computed once, instead of on every call to Log2 or Log10.
+// Multi-doubles already have their own reduced kernels, so only the constants are added on top of them.
+namespace RealFloatExpLog
+{
+	// ln(2) in parts, the 2^(j/64) and ln(1 + j/64) tables, the log constants and the series coefficients, for a ttmath float type. Built on first use, with ttmath's Exp and Ln one word wider, then rounded
+	template<ttmath::uint ExpSize, ttmath::uint ManSize>
+	struct TExpLogTables
+	{
+		using BigType = ttmath::Big<ExpSize, ManSize>;
+		using WideType = ttmath::Big<ExpSize, ManSize + 1>;
+
+		// Exp's argument is reduced to |r| <= ln(2) / (2 * TableSize), ln's mantissa to |m - (1 + j / TableSize)| <= 1 / (2 * TableSize)
+		static const int32 TableSize = 64;
+		static const int32 MaxTerms = 32;
+
+		// ln(2) / TableSize = Ln2OverTableSize[0] + Ln2OverTableSize[1] + Ln2OverTableSize[2], to three times the precision of BigType
+		BigType Ln2OverTableSize[3];
+		// ln(2) = Ln2[0] + Ln2[1], to twice the precision of BigType
+		BigType Ln2[2];
+		BigType Log2E;
+		BigType Log10E;
+		BigType Log10Of2;
+		BigType One;
+
+		// 2^(j / TableSize), for j in [0, TableSize)
+		BigType ExpTable[TableSize];
+		// ln(1 + j / TableSize), for j in [-TableSize / 2, TableSize / 2]
+		BigType LnTable[TableSize + 1];
+		BigType LnSteps[TableSize + 1];
+
+		// Taylor coefficients of exp(x), and of 2 atanh(x) / x in x^2
+		BigType ExpCoefficients[MaxTerms];
+		BigType AtanhCoefficients[MaxTerms];
+		int32 NumExpTerms;
+		int32 NumAtanhTerms;
+
+		static const TExpLogTables& Get()
+		{
+			static const TExpLogTables Tables;
+			return Tables;
+		}
+
+	private:
+
+		TExpLogTables()
+		{
+			using ThreeTimesType = ttmath::Big<ExpSize, 3 * ManSize + 1>;
+			ThreeTimesType ThreeTimesLn2;
+			ThreeTimesLn2.SetLn2();
+			SplitBig(ThreeTimesLn2, Ln2, 2);
+			ThreeTimesLn2.Div(ThreeTimesType(TableSize));
+			SplitBig(ThreeTimesLn2, Ln2OverTableSize, 3);
+
+			WideType WideLn2, WideLn10;
+			WideLn2.SetLn2();
+			WideLn10.SetLn10();
+			Log2E = RoundBig<BigType>(WideType(1) / WideLn2);
+			Log10E = RoundBig<BigType>(WideType(1) / WideLn10);
+			Log10Of2 = RoundBig<BigType>(WideLn2 / WideLn10);
+			One = BigType(1);
+
+			for (int32 Index = 0; Index < TableSize; Index++)
+			{
+				ExpTable[Index] = RoundBig<BigType>(ttmath::Exp(WideLn2 * WideType(Index) / WideType(TableSize)));
+			}
+			for (int32 Index = 0; Index <= TableSize; Index++)
+			{
+				const WideType Step = WideType(1) + WideType(Index - TableSize / 2) / WideType(TableSize);
+				LnSteps[Index] = BigType(Step);
+				LnTable[Index] = RoundBig<BigType>(ttmath::Ln(Step));
+			}
+
+			// Terms are kept while they can change the last bit of the result
+			const double Log2Precision = -double(ManSize * TTMATH_BITS_PER_UINT) - 2.0;
+			const double Log2MaxExpRemainder = std::log2(std::log(2.0) / (2.0 * TableSize));
+			// |m - Step| / (m + Step), with m >= sqrt(2) / 2
+			const double Log2MaxAtanhRemainder = std::log2(1.0 / (2.0 * TableSize * 1.4));
+
+			NumExpTerms = 0;
+			WideType Factorial(1);
+			double Log2Factorial = 0.0;
+			for (int32 Power = 0; Power < MaxTerms && Power * Log2MaxExpRemainder - Log2Factorial >= Log2Precision; Power++)
+			{
+				ExpCoefficients[NumExpTerms++] = RoundBig<BigType>(WideType(1) / Factorial);
+				Factorial.Mul(WideType(Power + 1));
+				Log2Factorial += std::log2(double(Power + 1));
+			}
+
+			NumAtanhTerms = 0;
+			for (int32 Term = 0; Term < MaxTerms && 2 * Term * Log2MaxAtanhRemainder - std::log2(2.0 * Term + 1.0) >= Log2Precision; Term++)
+			{
+				AtanhCoefficients[NumAtanhTerms++] = RoundBig<BigType>(WideType(2) / WideType(2 * Term + 1));
+			}
+		}
+	};
+
+	// exp(x) = 2^k * 2^(j / 64) * exp(r), with x = (64 k + j) ln(2) / 64 + r
+	template<ttmath::uint ExpSize, ttmath::uint ManSize>
+	ttmath::Big<ExpSize, ManSize> Exp(const ttmath::Big<ExpSize, ManSize>& Value)
+	{
+		using BigType = ttmath::Big<ExpSize, ManSize>;
+		using TablesType = TExpLogTables<ExpSize, ManSize>;
+		const TablesType& Tables = TablesType::Get();
+
+		if (Value.IsNan()) return Value;
+		if (Value.IsZero()) return Tables.One;
+
+		const double Quotient = std::floor(Value.ToDouble() * (TablesType::TableSize / 0.69314718055994531) + 0.5);
+		if (!(std::fabs(Quotient) < MaxReductionQuotient))
+		{
+			return ttmath::Exp(Value);
+		}
+
+		// Value - Quotient * ln(2) / 64, with exact products, rounded once
+		const BigType MinusQuotient(-Quotient);
+		const BigType* const X[] = { &Value, &MinusQuotient, &MinusQuotient, &MinusQuotient };
+		const BigType* const Y[] = { &Tables.One, &Tables.Ln2OverTableSize[0], &Tables.Ln2OverTableSize[1], &Tables.Ln2OverTableSize[2] };
+		const BigType Remainder = SumOfProducts(X, Y);
+
+		const int64 IntQuotient = int64(Quotient);
+		const int64 Index = IntQuotient & (TablesType::TableSize - 1);
+		const int64 PowerOfTwo = (IntQuotient - Index) / TablesType::TableSize;
+
+		BigType Result = EvaluatePolynomial(Remainder, Tables.ExpCoefficients, Tables.NumExpTerms);
+		Result.Mul(Tables.ExpTable[Index]);
+		if (Result.exponent.Add(ttmath::Int<ExpSize>(ttmath::sint(PowerOfTwo))))
+		{
+			Result.SetNan();
+		}
+		return Result;
+	}
+
+	// Splits Value into 2^PowerOfTwo * m, with m in [sqrt(2)/2, sqrt(2)), and computes ln(m) - ln(Step) = 2 atanh((m - Step) / (m + Step)).
+	// ln(Value) is then PowerOfTwo * ln(2) + LnTable[Index] + OutRemainder. Returns false if Value has no logarithm
+	template<ttmath::uint ExpSize, ttmath::uint ManSize>
+	bool LnReduced(const ttmath::Big<ExpSize, ManSize>& Value, ttmath::Big<ExpSize, ManSize>& OutPowerOfTwo, int32& OutIndex, ttmath::Big<ExpSize, ManSize>& OutRemainder)
+	{
+		using BigType = ttmath::Big<ExpSize, ManSize>;
+		using TablesType = TExpLogTables<ExpSize, ManSize>;
+		const TablesType& Tables = TablesType::Get();
+
+		if (Value.IsNan() || Value.IsZero() || Value.IsSign()) return false;
+
+		// Value = mantissa * 2^exponent, and the mantissa's highest bit is set
+		const ttmath::sint MantissaBits = ttmath::sint(ManSize * TTMATH_BITS_PER_UINT);
+		BigType Mantissa = Value;
+		Mantissa.exponent = ttmath::Int<ExpSize>(1 - MantissaBits);
+		ttmath::sint PowerOfTwo;
+		Value.exponent.ToInt(PowerOfTwo);
+		PowerOfTwo += MantissaBits - 1;
+		if (Mantissa.ToDouble() >= 1.4142135623730951)
+		{
+			Mantissa.exponent.SubOne();
+			PowerOfTwo++;
+		}
+		OutPowerOfTwo = BigType(PowerOfTwo);
+
+		OutIndex = FMath::Clamp(int32(std::floor((Mantissa.ToDouble() - 1.0) * TablesType::TableSize + 0.5)), -TablesType::TableSize / 2, TablesType::TableSize / 2) + TablesType::TableSize / 2;
+		const BigType& Step = Tables.LnSteps[OutIndex];
+
+		// ttmath's subtraction drops the bits shifted out of the smaller operand, even when the difference is exact: sum exact products instead
+		BigType MinusStep = Step;
+		MinusStep.ChangeSign();
+		const BigType* const X[] = { &Mantissa, &MinusStep };
+		const BigType* const Y[] = { &Tables.One, &Tables.One };
+		const BigType Reduced = SumOfProducts(X, Y) / (Mantissa + Step);
+		OutRemainder = EvaluatePolynomial(Reduced * Reduced, Tables.AtanhCoefficients, Tables.NumAtanhTerms);
+		OutRemainder.Mul(Reduced);
+		return true;
+	}
+
+	template<ttmath::uint ExpSize, ttmath::uint ManSize>
+	ttmath::Big<ExpSize, ManSize> Ln(const ttmath::Big<ExpSize, ManSize>& Value)
+	{
+		using BigType = ttmath::Big<ExpSize, ManSize>;
+		const TExpLogTables<ExpSize, ManSize>& Tables = TExpLogTables<ExpSize, ManSize>::Get();
+
+		BigType PowerOfTwo, Remainder;
+		int32 Index;
+		if (!LnReduced(Value, PowerOfTwo, Index, Remainder))
+		{
+			BigType Result;
+			Result.SetNan();
+			return Result;
+		}
+
+		const BigType* const X[] = { &PowerOfTwo, &PowerOfTwo, &Tables.LnTable[Index], &Remainder };
+		const BigType* const Y[] = { &Tables.Ln2[0], &Tables.Ln2[1], &Tables.One, &Tables.One };
+		return SumOfProducts(X, Y);
+	}
+
+	// Exact for powers of two
+	template<ttmath::uint ExpSize, ttmath::uint ManSize>
+	ttmath::Big<ExpSize, ManSize> Log2(const ttmath::Big<ExpSize, ManSize>& Value)
+	{
+		using BigType = ttmath::Big<ExpSize, ManSize>;
+		const TExpLogTables<ExpSize, ManSize>& Tables = TExpLogTables<ExpSize, ManSize>::Get();
+
+		BigType PowerOfTwo, Remainder;
+		int32 Index;
+		if (!LnReduced(Value, PowerOfTwo, Index, Remainder))
+		{
+			BigType Result;
+			Result.SetNan();
+			return Result;
+		}
+
+		const BigType* const X[] = { &PowerOfTwo, &Tables.LnTable[Index], &Remainder };
+		const BigType* const Y[] = { &Tables.One, &Tables.Log2E, &Tables.Log2E };
+		return SumOfProducts(X, Y);
+	}
+
+	template<ttmath::uint ExpSize, ttmath::uint ManSize>
+	ttmath::Big<ExpSize, ManSize> Log10(const ttmath::Big<ExpSize, ManSize>& Value)
+	{
+		using BigType = ttmath::Big<ExpSize, ManSize>;
+		const TExpLogTables<ExpSize, ManSize>& Tables = TExpLogTables<ExpSize, ManSize>::Get();
+
+		BigType PowerOfTwo, Remainder;
+		int32 Index;
+		if (!LnReduced(Value, PowerOfTwo, Index, Remainder))
+		{
+			BigType Result;
+			Result.SetNan();
+			return Result;
+		}
+
+		const BigType* const X[] = { &PowerOfTwo, &Tables.LnTable[Index], &Remainder };
+		const BigType* const Y[] = { &Tables.Log10Of2, &Tables.Log10E, &Tables.Log10E };
+		return SumOfProducts(X, Y);
+	}
+
+	// Integer powers, by square-and-multiply: exact for small results, and much faster than exp(y ln(x))
+	template<typename BigType>
+	BigType PowInt(const BigType& Value, int64 Power)
+	{
+		BigType Result(1);
+		BigType Square = Value;
+		uint64 Remaining = Power < 0 ? uint64(-(Power + 1)) + 1 : uint64(Power);
+		while (Remaining)
+		{
+			if (Remaining & 1) Result *= Square;
+			Remaining >>= 1;
+			if (Remaining) Square *= Square;
+		}
+		return Power < 0 ? BigType(1) / Result : Result;
+	}
+
+	// Multi-doubles
+
+	template<int N>
+	ddmath::MultiDouble<N> Exp(const ddmath::MultiDouble<N>& Value)
+	{
+		return ddmath::Exp(Value);
+	}
+
+	template<int N>
+	ddmath::MultiDouble<N> Ln(const ddmath::MultiDouble<N>& Value)
+	{
+		return ddmath::Ln(Value);
+	}
+
+	template<int N>
+	ddmath::MultiDouble<N> Log2(const ddmath::MultiDouble<N>& Value)
+	{
+		static const ddmath::MultiDouble<N> Log2E = ddmath::MultiDouble<N>(1.0) / ddmath::Ln2Constant<N>();
+		return ddmath::Ln(Value) * Log2E;
+	}
+
+	template<int N>
+	ddmath::MultiDouble<N> Log10(const ddmath::MultiDouble<N>& Value)
+	{
+		static const ddmath::MultiDouble<N> Log10E = ddmath::MultiDouble<N>(1.0) / ddmath::Ln(ddmath::MultiDouble<N>(10.0));
+		return ddmath::Ln(Value) * Log10E;
+	}
+
+#if SPACEKIT_HAS_FLOAT128
+	// Binary128 numbers: expq, logq, log2q and log10q with libquadmath. Without it, Exp and the logarithms above run on ExactBigType, which holds a Float128 exactly
+
+	inline f128math::Float128 Exp(const f128math::Float128& Value)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		return f128math::Float128::FromNative(expq(Value.ToNative()));
+#else
+		return f128math::Float128::FromBig(Exp(Value.ToBig<f128math::ExactBigType>()));
+#endif
+	}
+
+	inline f128math::Float128 Ln(const f128math::Float128& Value)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		return f128math::Float128::FromNative(logq(Value.ToNative()));
+#else
+		return f128math::Float128::FromBig(Ln(Value.ToBig<f128math::ExactBigType>()));
+#endif
+	}
+
+	inline f128math::Float128 Log2(const f128math::Float128& Value)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		return f128math::Float128::FromNative(log2q(Value.ToNative()));
+#else
+		return f128math::Float128::FromBig(Log2(Value.ToBig<f128math::ExactBigType>()));
+#endif
+	}
+
+	inline f128math::Float128 Log10(const f128math::Float128& Value)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		return f128math::Float128::FromNative(log10q(Value.ToNative()));
+#else
+		return f128math::Float128::FromBig(Log10(Value.ToBig<f128math::ExactBigType>()));
+#endif
+	}
+#endif
+}
@@ -0,0 +1,486 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/TtmathConfig.h"
+#include "SpaceKitPrecision/Public/DecimalConversion.h"
+
+#include "Core/Public/HAL/Platform.h"
+#include "CoreMinimal.h"
+
+
+// Converts a ttmath float to a smaller precision, rounding to nearest. Defined with the helpers for the kernels below
+template<typename BigType, ttmath::uint OtherExp, ttmath::uint OtherMan>
+BigType RoundBig(const ttmath::Big<OtherExp, OtherMan>& Value);
+
+// Type for a floating-point number, whose mantissa is at least Bits wide. Ttmath ceils it to the nearest multiple of 64, and the exponent is 64 bits wide.
+// It's the C++ counterpart of FRealFloat, for when values don't all need the same precision: e.g. 64 bits for velocities, 128 bits for positions.
+// FRealFloat stays the Blueprint-facing type. Conversions between precisions are explicit, as they can round.
+template<int Bits>
+struct TRealFloat
+{
+	using ttBigType = ttmath::Big<TTMATH_BITS(64), TTMATH_BITS(Bits)>;
+
+	ttBigType Value;
+
+	TRealFloat()
+	{
+		Value.SetZero();
+	}
+
+	explicit TRealFloat(const ttBigType& InValue)
+		: Value(InValue)
+	{
+	}
+
+	explicit TRealFloat(int32 InValue)
+		: Value(InValue)
+	{
+	}
+
+	explicit TRealFloat(int64 InValue)
+		: Value(InValue)
+	{
+	}
+
+	explicit TRealFloat(float InValue)
+		: Value(InValue)
+	{
+	}
+
+	explicit TRealFloat(double InValue)
+		: Value(InValue)
+	{
+	}
+
+	// Creates a number based on a base-10 string representation. See InitFromChars
+	explicit TRealFloat(const char* InValue)
+		: TRealFloat()
+	{
+		InitFromChars(InValue);
+	}
+
+	explicit TRealFloat(const FString& InValue)
+		: TRealFloat()
+	{
+		const TCHAR* Cursor = *InValue;
+		InitFromChars(Cursor);
+	}
+
+	// Converts a number of another precision. The mantissa is rounded to nearest if this one is smaller, ttmath's own conversion would truncate it
+	template<int OtherBits>
+	explicit TRealFloat(const TRealFloat<OtherBits>& Other)
+		: Value(RoundBig<ttBigType>(Other.Value))
+	{
+	}
+
+	FORCEINLINE ttBigType& GetValue()
+	{
+		return Value;
+	}
+
+	FORCEINLINE const ttBigType& GetValue() const
+	{
+		return Value;
+	}
+
+	// Converts this number to a double number. Note that this can lead to huge precision loss
+	double ToDouble() const
+	{
+		return Value.ToDouble();
+	}
+
+	// Converts this number to a float number. Note that this can lead to huge precision loss
+	float ToFloat() const
+	{
+		return Value.ToFloat();
+	}
+
+	// Size of the buffers ToChars writes to, in characters, including the null terminator
+	static constexpr int32 StringBufferSize = DecimalConversion::FloatBufferSize(int32(TTMATH_BITS(Bits) * TTMATH_BITS_PER_UINT));
+
+	// Writes this number in base 10 to Buffer, which must hold StringBufferSize characters, and returns the number of characters written.
+	// It has the fewest significant digits that parse back to this number. Nothing is allocated
+	template<typename CharType>
+	int32 ToChars(CharType* Buffer) const
+	{
+		return DecimalConversion::WriteFloat(Buffer, Value);
+	}
+
+	// Reads a base 10 number at Buffer, in a single pass and without allocating, and moves Buffer past it. It's rounded to nearest.
+	// Returns false if there is no number at Buffer, and then leaves Buffer and this number unchanged
+	template<typename CharType>
+	bool InitFromChars(const CharType*& Buffer)
+	{
+		return DecimalConversion::ParseFloat(Buffer, Value);
+	}
+
+	FString ToString() const
+	{
+		TCHAR Buffer[StringBufferSize];
+		const int32 Length = ToChars(Buffer);
+		return FString(Length, Buffer);
+	}
+};
+
+template<int Bits>
+constexpr int32 TRealFloat<Bits>::StringBufferSize;
+
+// Operators for floating-point numbers
+
+template<int Bits>
+TRealFloat<Bits> operator+(const TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	return TRealFloat<Bits>(x.Value + y.Value);
+}
+
+template<int Bits>
+TRealFloat<Bits>& operator+=(TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	x.Value += y.Value;
+	return x;
+}
+
+template<int Bits>
+TRealFloat<Bits> operator-(const TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	return TRealFloat<Bits>(x.Value - y.Value);
+}
+
+template<int Bits>
+TRealFloat<Bits>& operator-=(TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	x.Value -= y.Value;
+	return x;
+}
+
+template<int Bits>
+TRealFloat<Bits> operator-(const TRealFloat<Bits>& x)
+{
+	return TRealFloat<Bits>(-x.Value);
+}
+
+template<int Bits>
+TRealFloat<Bits> operator*(const TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	return TRealFloat<Bits>(x.Value * y.Value);
+}
+
+template<int Bits>
+TRealFloat<Bits>& operator*=(TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	x.Value *= y.Value;
+	return x;
+}
+
+template<int Bits>
+TRealFloat<Bits> operator/(const TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	return TRealFloat<Bits>(x.Value / y.Value);
+}
+
+template<int Bits>
+TRealFloat<Bits>& operator/=(TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	x.Value /= y.Value;
+	return x;
+}
+
+template<int Bits>
+bool operator<(const TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	return x.Value < y.Value;
+}
+
+template<int Bits>
+bool operator<=(const TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	return x.Value <= y.Value;
+}
+
+template<int Bits>
+bool operator>=(const TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	return x.Value >= y.Value;
+}
+
+template<int Bits>
+bool operator>(const TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	return x.Value > y.Value;
+}
+
+template<int Bits>
+bool operator==(const TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	return x.Value == y.Value;
+}
+
+template<int Bits>
+bool operator!=(const TRealFloat<Bits>& x, const TRealFloat<Bits>& y)
+{
+	return x.Value != y.Value;
+}
+
+// Math functions, at the precision of their argument
+
+template<int Bits>
+TRealFloat<Bits> Abs(const TRealFloat<Bits>& x)
+{
+	return TRealFloat<Bits>(ttmath::Abs(x.Value));
+}
+
+template<int Bits>
+TRealFloat<Bits> Sqrt(const TRealFloat<Bits>& x)
+{
+	return TRealFloat<Bits>(ttmath::Sqrt(x.Value));
+}
+
+template<int Bits>
+TRealFloat<Bits> Exp(const TRealFloat<Bits>& x)
+{
+	return TRealFloat<Bits>(ttmath::Exp(x.Value));
+}
+
+template<int Bits>
+TRealFloat<Bits> Ln(const TRealFloat<Bits>& x)
+{
+	return TRealFloat<Bits>(ttmath::Ln(x.Value));
+}
+
+template<int Bits>
+TRealFloat<Bits> Sin(const TRealFloat<Bits>& x)
+{
+	return TRealFloat<Bits>(ttmath::Sin(x.Value));
+}
+
+template<int Bits>
+TRealFloat<Bits> Cos(const TRealFloat<Bits>& x)
+{
+	return TRealFloat<Bits>(ttmath::Cos(x.Value));
+}
+
+template<int Bits>
+TRealFloat<Bits> Tan(const TRealFloat<Bits>& x)
+{
+	return TRealFloat<Bits>(ttmath::Tan(x.Value));
+}
+
+template<int Bits>
+TRealFloat<Bits> ASin(const TRealFloat<Bits>& x)
+{
+	return TRealFloat<Bits>(ttmath::ASin(x.Value));
+}
+
+template<int Bits>
+TRealFloat<Bits> ACos(const TRealFloat<Bits>& x)
+{
+	return TRealFloat<Bits>(ttmath::ACos(x.Value));
+}
+
+template<int Bits>
+TRealFloat<Bits> ATan(const TRealFloat<Bits>& x)
+{
+	return TRealFloat<Bits>(ttmath::ATan(x.Value));
+}
+
+// Fused products
+
+// Computes *X[0] * *Y[0] + ... + *X[Count - 1] * *Y[Count - 1], using the storage's own operators.
+// This is the fallback for storages that have no exact accumulator (boost, multi-doubles)
+template<typename BigType, int32 Count>
+BigType SumOfProducts(const BigType* const (&X)[Count], const BigType* const (&Y)[Count])
+{
+	BigType Result = *X[0] * *Y[0];
+	for (int32 i = 1; i < Count; i++)
+	{
+		Result += *X[i] * *Y[i];
+	}
+	return Result;
+}
+
+// Computes *X[0] * *Y[0] + ... + *X[Count - 1] * *Y[Count - 1], rounding only once, at the end.
+// Products of ttmath mantissas are exact in twice their width. They are summed in a fixed-point accumulator aligned on the biggest product,
+// with one more word below it, and one above it for carries. Products more than that word below the biggest one are dropped, which is far below the result's precision.
+// This skips the normalization and rounding that chaining operator* and operator+ does on every intermediate result.
+template<ttmath::uint Exp, ttmath::uint Man, int32 Count>
+ttmath::Big<Exp, Man> SumOfProducts(const ttmath::Big<Exp, Man>* const (&X)[Count], const ttmath::Big<Exp, Man>* const (&Y)[Count])
+{
+	using BigType = ttmath::Big<Exp, Man>;
+	using ExponentType = ttmath::Int<Exp>;
+	using AccumulatorType = ttmath::UInt<2 * Man + 2>;
+	const ttmath::uint AccumulatorBits = (2 * Man + 2) * TTMATH_BITS_PER_UINT;
+
+	BigType Result;
+
+	// Exact products: each one is Products[i] * 2^Exponents[i]
+	ttmath::UInt<2 * Man> Products[Count];
+	ExponentType Exponents[Count];
+	bool IsUsed[Count];
+	bool HasProducts = false;
+	ExponentType MaxExponent;
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		IsUsed[i] = false;
+		if (X[i]->IsNan() || Y[i]->IsNan())
+		{
+			Result.SetNan();
+			return Result;
+		}
+		if (X[i]->IsZero() || Y[i]->IsZero()) continue;
+
+		// MulBig isn't const in ttmath
+		ttmath::UInt<Man> Mantissa = X[i]->mantissa;
+		Mantissa.MulBig(Y[i]->mantissa, Products[i]);
+		Exponents[i] = X[i]->exponent;
+		if (Exponents[i].Add(Y[i]->exponent))
+		{
+			Result.SetNan();
+			return Result;
+		}
+
+		if (!HasProducts || Exponents[i] > MaxExponent) MaxExponent = Exponents[i];
+		HasProducts = true;
+		IsUsed[i] = true;
+	}
+
+	if (!HasProducts)
+	{
+		Result.SetZero();
+		return Result;
+	}
+
+	// The accumulator's value is Accumulator * 2^(MaxExponent - TTMATH_BITS_PER_UINT), in two's complement
+	AccumulatorType Accumulator;
+	Accumulator.SetZero();
+	for (int32 i = 0; i < Count; i++)
+	{
+		if (!IsUsed[i]) continue;
+
+		ExponentType ShiftExponent = MaxExponent;
+		ShiftExponent.Sub(Exponents[i]);
+		ttmath::uint Shift;
+		if (ShiftExponent.ToUInt(Shift) || Shift >= AccumulatorBits) continue;
+
+		AccumulatorType Term;
+		Term.table[0] = 0;
+		Term.table[2 * Man + 1] = 0;
+		for (ttmath::uint Word = 0; Word < 2 * Man; Word++)
+		{
+			Term.table[Word + 1] = Products[i].table[Word];
+		}
+		Term.Rcr(Shift);
+
+		if (X[i]->IsSign() != Y[i]->IsSign()) Accumulator.Sub(Term);
+		else Accumulator.Add(Term);
+	}
+
+	const bool IsNegative = Accumulator.IsTheHighestBitSet();
+	if (IsNegative)
+	{
+		Accumulator.BitNot();
+		Accumulator.AddOne();
+	}
+
+	if (Accumulator.IsZero())
+	{
+		Result.SetZero();
+		return Result;
+	}
+
+	// Normalizes, and keeps the highest words as the mantissa
+	const ttmath::uint Moved = Accumulator.CompensationToLeft();
+	for (ttmath::uint Word = 0; Word < Man; Word++)
+	{
+		Result.mantissa.table[Word] = Accumulator.table[Word + Man + 2];
+	}
+	Result.exponent = MaxExponent;
+	ttmath::uint Carry = Result.exponent.Add(ExponentType(ttmath::sint((Man + 1) * TTMATH_BITS_PER_UINT) - ttmath::sint(Moved)));
+	Result.info = 0;
+
+	// Rounds half to even, based on the words below the mantissa
+	const ttmath::uint HighestRest = Accumulator.table[Man + 1];
+	if (HighestRest & TTMATH_UINT_HIGHEST_BIT)
+	{
+		bool IsHalf = HighestRest == TTMATH_UINT_HIGHEST_BIT;
+		for (ttmath::uint Word = 0; IsHalf && Word < Man + 1; Word++)
+		{
+			IsHalf = Accumulator.table[Word] == 0;
+		}
+
+		if (!IsHalf || Result.mantissa.IsTheLowestBitSet())
+		{
+			if (Result.mantissa.AddOne())
+			{
+				Result.mantissa.Rcr(1, 1);
+				Carry += Result.exponent.AddOne();
+			}
+		}
+	}
+
+	if (IsNegative) Result.SetSign();
+	if (Carry) Result.SetNan();
+	return Result;
+}
+
+// Helpers for the kernels built on ttmath floats
+
+// Converts a ttmath float to a smaller precision, rounding to nearest. ttmath's own conversion truncates
+template<typename BigType, ttmath::uint OtherExp, ttmath::uint OtherMan>
+BigType RoundBig(const ttmath::Big<OtherExp, OtherMan>& Value)
+{
+	using OtherType = ttmath::Big<OtherExp, OtherMan>;
+
+	BigType Result(Value);
+	if (Result.IsZero() || Result.IsNan()) return Result;
+
+	OtherType Rest = Value;
+	Rest.Sub(OtherType(Result));
+	Rest.Abs();
+	Rest.exponent.AddOne();
+
+	BigType LastBit;
+	LastBit.mantissa.SetZero();
+	LastBit.mantissa.table[0] = 1;
+	LastBit.exponent = Result.exponent;
+	LastBit.info = 0;
+	LastBit.Standardizing();
+
+	if (Rest >= OtherType(LastBit))
+	{
+		if (Result.IsSign()) Result.Sub(LastBit);
+		else Result.Add(LastBit);
+	}
+	return Result;
+}
+
+// Splits Value into NumParts floats of BigType, whose sum is Value to NumParts times the precision of BigType, for Cody-Waite reductions.
+// ttmath's conversions truncate, so each part is exact, and what it drops is carried to the next one
+template<typename BigType, ttmath::uint OtherExp, ttmath::uint OtherMan>
+void SplitBig(ttmath::Big<OtherExp, OtherMan> Value, BigType* OutParts, int32 NumParts)
+{
+	using OtherType = ttmath::Big<OtherExp, OtherMan>;
+
+	for (int32 Part = 0; Part < NumParts; Part++)
+	{
+		OutParts[Part] = BigType(Value);
+		Value.Sub(OtherType(OutParts[Part]));
+	}
+}
+
+// Largest reduction quotient the kernels take: they compute it as a double, which holds every integer up to 2^52. Past it, they use ttmath's own functions
+static const double MaxReductionQuotient = 4503599627370496.0;
+
+// Evaluates Coefficients[0] + Coefficients[1] * X + ... with Horner's method
+template<ttmath::uint Exp, ttmath::uint Man>
+ttmath::Big<Exp, Man> EvaluatePolynomial(const ttmath::Big<Exp, Man>& X, const ttmath::Big<Exp, Man>* Coefficients, int32 NumTerms)
+{
+	ttmath::Big<Exp, Man> Result = Coefficients[NumTerms - 1];
+	for (int32 Term = NumTerms - 2; Term >= 0; Term--)
+	{
+		Result.Mul(X);
+		Result.Add(Coefficients[Term]);
+	}
+	return Result;
+}
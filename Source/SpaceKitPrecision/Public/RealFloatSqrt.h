@@ -0,0 +1,151 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/TtmathConfig.h"
+#include "SpaceKitPrecision/Public/MultiDouble.h"
+#include "SpaceKitPrecision/Public/Float128.h"
+#include "SpaceKitPrecision/Public/RealFloatGeneric.h"
+
+#include "CoreMinimal.h"
+
+#include <cmath>
+
+
+// Square root and inverse square root kernels for FRealFloat's storage.
+// For ttmath floats, the inverse square root is seeded from the hardware one, on the mantissa scaled to [1, 4), and refined with Newton iterations,
+// each of them doubling the number of correct bits. The square root is then one multiplication and a last Karp-Markstein correction.
+// Residuals like 1 - m * y^2 are computed from exact products (see SumOfProducts), so the iterations don't stall on rounding errors.
+// Multi-doubles already do the same in ddmath::Sqrt.
+namespace RealFloatSqrt
+{
+	// Number of correct bits of the hardware seed, with some margin
+	static const int32 SeedBits = 50;
+
+	// Splits Value into 2^(2 * OutHalfPowerOfTwo) * OutMantissa, with OutMantissa in [1, 4), and returns its inverse square root
+	template<ttmath::uint ExpSize, ttmath::uint ManSize>
+	ttmath::Big<ExpSize, ManSize> InvSqrtReduced(const ttmath::Big<ExpSize, ManSize>& Value, ttmath::Big<ExpSize, ManSize>& OutMantissa, ttmath::sint& OutHalfPowerOfTwo)
+	{
+		using BigType = ttmath::Big<ExpSize, ManSize>;
+		const ttmath::sint MantissaBits = ttmath::sint(ManSize * TTMATH_BITS_PER_UINT);
+
+		// Value = mantissa * 2^exponent, and the mantissa's highest bit is set
+		ttmath::sint PowerOfTwo;
+		Value.exponent.ToInt(PowerOfTwo);
+		PowerOfTwo += MantissaBits - 1;
+		const ttmath::sint OddPower = PowerOfTwo & 1;
+		OutMantissa = Value;
+		OutMantissa.exponent = ttmath::Int<ExpSize>(1 - MantissaBits + OddPower);
+		OutHalfPowerOfTwo = (PowerOfTwo - OddPower) / 2;
+
+		static const BigType One(1);
+		BigType Result(1.0 / std::sqrt(OutMantissa.ToDouble()));
+		for (int32 Bits = SeedBits; Bits < MantissaBits; Bits *= 2)
+		{
+			// y = y + y * (1 - m * y^2) / 2
+			BigType MinusProduct = OutMantissa * Result;
+			MinusProduct.ChangeSign();
+			const BigType* const X[] = { &One, &MinusProduct };
+			const BigType* const Y[] = { &One, &Result };
+			BigType Correction = SumOfProducts(X, Y);
+			Correction.Mul(Result);
+			Correction.exponent.SubOne();
+			Result.Add(Correction);
+		}
+		return Result;
+	}
+
+	template<ttmath::uint ExpSize, ttmath::uint ManSize>
+	ttmath::Big<ExpSize, ManSize> InvSqrt(const ttmath::Big<ExpSize, ManSize>& Value)
+	{
+		using BigType = ttmath::Big<ExpSize, ManSize>;
+
+		if (Value.IsNan() || Value.IsZero() || Value.IsSign())
+		{
+			BigType Result;
+			Result.SetNan();
+			return Result;
+		}
+
+		BigType Mantissa;
+		ttmath::sint HalfPowerOfTwo;
+		BigType Result = InvSqrtReduced(Value, Mantissa, HalfPowerOfTwo);
+		if (Result.exponent.Sub(ttmath::Int<ExpSize>(HalfPowerOfTwo)))
+		{
+			Result.SetNan();
+		}
+		return Result;
+	}
+
+	template<ttmath::uint ExpSize, ttmath::uint ManSize>
+	ttmath::Big<ExpSize, ManSize> Sqrt(const ttmath::Big<ExpSize, ManSize>& Value)
+	{
+		using BigType = ttmath::Big<ExpSize, ManSize>;
+
+		if (Value.IsNan() || Value.IsZero()) return Value;
+		if (Value.IsSign())
+		{
+			BigType Result;
+			Result.SetNan();
+			return Result;
+		}
+
+		BigType Mantissa;
+		ttmath::sint HalfPowerOfTwo;
+		const BigType Inverse = InvSqrtReduced(Value, Mantissa, HalfPowerOfTwo);
+
+		// s = m * y, then s = s + y * (m - s^2) / 2
+		BigType Result = Mantissa * Inverse;
+		BigType MinusResult = Result;
+		MinusResult.ChangeSign();
+		static const BigType One(1);
+		const BigType* const X[] = { &Mantissa, &MinusResult };
+		const BigType* const Y[] = { &One, &Result };
+		BigType Correction = SumOfProducts(X, Y);
+		Correction.Mul(Inverse);
+		Correction.exponent.SubOne();
+		Result.Add(Correction);
+
+		if (Result.exponent.Add(ttmath::Int<ExpSize>(HalfPowerOfTwo)))
+		{
+			Result.SetNan();
+		}
+		return Result;
+	}
+
+	// Multi-doubles
+
+	template<int N>
+	ddmath::MultiDouble<N> InvSqrt(const ddmath::MultiDouble<N>& Value)
+	{
+		return ddmath::MultiDouble<N>(1.0) / ddmath::Sqrt(Value);
+	}
+
+	template<int N>
+	ddmath::MultiDouble<N> Sqrt(const ddmath::MultiDouble<N>& Value)
+	{
+		return ddmath::Sqrt(Value);
+	}
+
+#if SPACEKIT_HAS_FLOAT128
+	// Binary128 numbers: libquadmath's correctly rounded square root if it's linked, else the ttmath kernels above, on their exact ttmath value
+
+	inline f128math::Float128 InvSqrt(const f128math::Float128& Value)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		return f128math::Float128::FromNative(1 / sqrtq(Value.ToNative()));
+#else
+		return f128math::Float128::FromBig(InvSqrt(Value.ToBig<f128math::ExactBigType>()));
+#endif
+	}
+
+	inline f128math::Float128 Sqrt(const f128math::Float128& Value)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		return f128math::Float128::FromNative(sqrtq(Value.ToNative()));
+#else
+		return f128math::Float128::FromBig(Sqrt(Value.ToBig<f128math::ExactBigType>()));
+#endif
+	}
+#endif
+}
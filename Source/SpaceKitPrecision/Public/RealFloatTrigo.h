@@ -0,0 +1,346 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/TtmathConfig.h"
+#include "SpaceKitPrecision/Public/MultiDouble.h"
+#include "SpaceKitPrecision/Public/Float128.h"
+#include "SpaceKitPrecision/Public/RealFloatConstants.h"
+#include "SpaceKitPrecision/Public/RealFloatGeneric.h"
+
+#include "CoreMinimal.h"
+
+#include <cmath>
+
+
+// Trigonometry kernels for FRealFloat's storages.
+// For ttmath floats, angles are reduced to [-pi/4, pi/4] (Cody-Waite, with pi/2 split in three parts), then split into a table entry and a remainder below 1/128,
+// on which short polynomials are evaluated. This replaces ttmath's series, that need tens of terms, and a division for each one.
+// Multi-doubles already have their own reduced kernels, so they are only forwarded.
+namespace RealFloatTrigo
+{
+	// Pi/2 in three parts, and sin, cos and atan at the table's steps, for a ttmath float type. Built on first use, from ttmath's functions one word wider, then rounded
+	template<ttmath::uint Exp, ttmath::uint Man>
+	struct TTrigoTables
+	{
+		using BigType = ttmath::Big<Exp, Man>;
+		using WideType = ttmath::Big<Exp, Man + 1>;
+
+		// Reduced values are split into Index / TableSize + Remainder, with |Remainder| <= 1 / (2 * TableSize)
+		static const int32 TableSize = 64;
+		// Covers [0, 1], that contains both reduced angles (up to pi/4) and reduced tangents (up to 1)
+		static const int32 NumEntries = TableSize + 1;
+		static const int32 MaxTerms = 32;
+
+		// Pi/2 = PiOverTwo[0] + PiOverTwo[1] + PiOverTwo[2], to three times the precision of BigType
+		BigType PiOverTwo[3];
+		BigType DegToRad;
+		BigType Ninety;
+		BigType One;
+
+		// Index / TableSize, and the functions at these points
+		BigType Steps[NumEntries];
+		BigType Sin[NumEntries];
+		BigType Cos[NumEntries];
+		BigType ATan[NumEntries];
+
+		// Taylor coefficients, for x, x^3, x^5... and 1, x^2, x^4...
+		// On |x| <= 1/128, they're as good as minimax ones at this precision, and are computed exactly
+		BigType SinCoefficients[MaxTerms];
+		BigType CosCoefficients[MaxTerms];
+		BigType ATanCoefficients[MaxTerms];
+		int32 NumSinTerms;
+		int32 NumCosTerms;
+		int32 NumATanTerms;
+
+		static const TTrigoTables& Get()
+		{
+			static const TTrigoTables Tables;
+			return Tables;
+		}
+
+	private:
+
+		TTrigoTables()
+		{
+			using ThreeTimesType = ttmath::Big<Exp, 3 * Man + 1>;
+			ThreeTimesType ThreeTimesPiOverTwo;
+			ThreeTimesPiOverTwo.SetPi();
+			ThreeTimesPiOverTwo.exponent.SubOne();
+			SplitBig(ThreeTimesPiOverTwo, PiOverTwo, 3);
+
+			WideType WidePi;
+			WidePi.SetPi();
+			DegToRad = RoundBig<BigType>(WidePi / WideType(180));
+			Ninety = BigType(90);
+			One = BigType(1);
+
+			for (int32 Index = 0; Index < NumEntries; Index++)
+			{
+				const WideType Step = WideType(Index) / WideType(TableSize);
+				Steps[Index] = BigType(Step);
+				Sin[Index] = RoundBig<BigType>(ttmath::Sin(Step));
+				Cos[Index] = RoundBig<BigType>(ttmath::Cos(Step));
+				ATan[Index] = RoundBig<BigType>(ttmath::ATan(Step));
+			}
+
+			// Terms are kept while they can change the last bit of the result, for |x| <= 1 / (2 * TableSize)
+			const double Log2MaxRemainder = -std::log2(2.0 * TableSize);
+			const double Log2Precision = -double(Man * TTMATH_BITS_PER_UINT) - 2.0;
+			double Log2Factorial = 0.0;
+
+			NumSinTerms = 0;
+			NumCosTerms = 0;
+			NumATanTerms = 0;
+			for (int32 Term = 0; Term < MaxTerms; Term++)
+			{
+				const int32 CosPower = 2 * Term;
+				const int32 SinPower = 2 * Term + 1;
+				if (CosPower > 0) Log2Factorial += std::log2(double(CosPower));
+
+				// Relative to the function's magnitude: 1 for cos, |x| for sin and atan
+				if (CosPower * Log2MaxRemainder - Log2Factorial >= Log2Precision)
+				{
+					CosCoefficients[NumCosTerms++] = RoundBig<BigType>(WideType(Term % 2 ? -1 : 1) / Factorial(CosPower));
+				}
+				Log2Factorial += std::log2(double(SinPower));
+				if ((SinPower - 1) * Log2MaxRemainder - Log2Factorial >= Log2Precision)
+				{
+					SinCoefficients[NumSinTerms++] = RoundBig<BigType>(WideType(Term % 2 ? -1 : 1) / Factorial(SinPower));
+				}
+				if ((SinPower - 1) * Log2MaxRemainder - std::log2(double(SinPower)) >= Log2Precision)
+				{
+					ATanCoefficients[NumATanTerms++] = RoundBig<BigType>(WideType(Term % 2 ? -1 : 1) / WideType(SinPower));
+				}
+			}
+		}
+
+		static WideType Factorial(int32 N)
+		{
+			WideType Result(1);
+			for (int32 Factor = 2; Factor <= N; Factor++)
+			{
+				Result.Mul(WideType(Factor));
+			}
+			return Result;
+		}
+	};
+
+	// Sine and cosine of an angle in [-pi/4, pi/4], through the tables: sin(Step + t) = sin(Step) cos(t) + cos(Step) sin(t)
+	template<ttmath::uint Exp, ttmath::uint Man>
+	void SinCosReduced(const ttmath::Big<Exp, Man>& Angle, ttmath::Big<Exp, Man>& OutSin, ttmath::Big<Exp, Man>& OutCos)
+	{
+		using BigType = ttmath::Big<Exp, Man>;
+		using TablesType = TTrigoTables<Exp, Man>;
+		const TablesType& Tables = TablesType::Get();
+
+		BigType Absolute = Angle;
+		Absolute.Abs();
+		const int32 Index = FMath::Min(int32(Absolute.ToDouble() * TablesType::TableSize + 0.5), TablesType::NumEntries - 1);
+
+		// Exact, as both are close to each other
+		BigType Remainder = Absolute;
+		Remainder.Sub(Tables.Steps[Index]);
+		BigType RemainderSquared = Remainder;
+		RemainderSquared.Mul(Remainder);
+
+		BigType SinRemainder = EvaluatePolynomial(RemainderSquared, Tables.SinCoefficients, Tables.NumSinTerms);
+		SinRemainder.Mul(Remainder);
+		const BigType CosRemainder = EvaluatePolynomial(RemainderSquared, Tables.CosCoefficients, Tables.NumCosTerms);
+
+		const BigType NegativeSin = -Tables.Sin[Index];
+		const BigType* const SinX[] = { &Tables.Sin[Index], &Tables.Cos[Index] };
+		const BigType* const SinY[] = { &CosRemainder, &SinRemainder };
+		const BigType* const CosX[] = { &Tables.Cos[Index], &NegativeSin };
+		const BigType* const CosY[] = { &CosRemainder, &SinRemainder };
+		OutSin = SumOfProducts(SinX, SinY);
+		OutCos = SumOfProducts(CosX, CosY);
+
+		if (Angle.IsSign()) OutSin.ChangeSign();
+	}
+
+	// Maps the sine and cosine of the reduced angle back to the quadrant of the original angle
+	template<typename BigType>
+	void ApplyQuadrant(int64 Quadrant, BigType& InOutSin, BigType& InOutCos)
+	{
+		switch (Quadrant & 3)
+		{
+		case 1:
+			Swap(InOutSin, InOutCos);
+			InOutCos = -InOutCos;
+			break;
+		case 2:
+			InOutSin = -InOutSin;
+			InOutCos = -InOutCos;
+			break;
+		case 3:
+			Swap(InOutSin, InOutCos);
+			InOutSin = -InOutSin;
+			break;
+		default:
+			break;
+		}
+	}
+
+	static const double HalfPi = 1.5707963267948966;
+
+	template<ttmath::uint Exp, ttmath::uint Man>
+	void SinCos(const ttmath::Big<Exp, Man>& Angle, ttmath::Big<Exp, Man>& OutSin, ttmath::Big<Exp, Man>& OutCos)
+	{
+		using BigType = ttmath::Big<Exp, Man>;
+		const TTrigoTables<Exp, Man>& Tables = TTrigoTables<Exp, Man>::Get();
+
+		const double Quadrant = std::floor(Angle.ToDouble() / HalfPi + 0.5);
+		if (Quadrant == 0.0)
+		{
+			SinCosReduced(Angle, OutSin, OutCos);
+			return;
+		}
+		if (!(std::fabs(Quadrant) < MaxReductionQuotient))
+		{
+			OutSin = ttmath::Sin(Angle);
+			OutCos = ttmath::Cos(Angle);
+			return;
+		}
+
+		// Angle - Quadrant * pi/2, with exact products, rounded once
+		const BigType MinusQuadrant(-Quadrant);
+		const BigType* const X[] = { &Angle, &MinusQuadrant, &MinusQuadrant, &MinusQuadrant };
+		const BigType* const Y[] = { &Tables.One, &Tables.PiOverTwo[0], &Tables.PiOverTwo[1], &Tables.PiOverTwo[2] };
+		SinCosReduced(SumOfProducts(X, Y), OutSin, OutCos);
+		ApplyQuadrant(int64(Quadrant), OutSin, OutCos);
+	}
+
+	// Same as SinCos, but reduces the angle in degrees first, which is exact, so e.g. the cosine of 90 degrees is exactly 0
+	template<ttmath::uint Exp, ttmath::uint Man>
+	void SinCosDeg(const ttmath::Big<Exp, Man>& Angle, ttmath::Big<Exp, Man>& OutSin, ttmath::Big<Exp, Man>& OutCos)
+	{
+		using BigType = ttmath::Big<Exp, Man>;
+		const TTrigoTables<Exp, Man>& Tables = TTrigoTables<Exp, Man>::Get();
+
+		const double Quadrant = std::floor(Angle.ToDouble() / 90.0 + 0.5);
+		if (!(std::fabs(Quadrant) < MaxReductionQuotient))
+		{
+			const BigType Radians = Angle * Tables.DegToRad;
+			OutSin = ttmath::Sin(Radians);
+			OutCos = ttmath::Cos(Radians);
+			return;
+		}
+
+		const BigType MinusQuadrant(-Quadrant);
+		const BigType* const X[] = { &Angle, &MinusQuadrant };
+		const BigType* const Y[] = { &Tables.One, &Tables.Ninety };
+		SinCosReduced(SumOfProducts(X, Y) * Tables.DegToRad, OutSin, OutCos);
+		ApplyQuadrant(int64(Quadrant), OutSin, OutCos);
+	}
+
+	// atan(x) = atan(Step) + atan((x - Step) / (1 + x * Step)), and atan(x) = pi/2 - atan(1/x) above 1
+	template<ttmath::uint Exp, ttmath::uint Man>
+	ttmath::Big<Exp, Man> ATan(const ttmath::Big<Exp, Man>& Value)
+	{
+		using BigType = ttmath::Big<Exp, Man>;
+		using TablesType = TTrigoTables<Exp, Man>;
+		const TablesType& Tables = TablesType::Get();
+
+		if (Value.IsNan() || Value.IsZero()) return Value;
+
+		BigType Absolute = Value;
+		Absolute.Abs();
+		const bool IsInverted = Absolute > Tables.One;
+		if (IsInverted) Absolute = Tables.One / Absolute;
+
+		const int32 Index = FMath::Min(int32(Absolute.ToDouble() * TablesType::TableSize + 0.5), TablesType::NumEntries - 1);
+		const BigType* const X[] = { &Absolute, &Tables.One };
+		const BigType* const Y[] = { &Tables.Steps[Index], &Tables.One };
+		const BigType Reduced = (Absolute - Tables.Steps[Index]) / SumOfProducts(X, Y);
+
+		BigType Result = EvaluatePolynomial(Reduced * Reduced, Tables.ATanCoefficients, Tables.NumATanTerms);
+		Result.Mul(Reduced);
+		Result.Add(Tables.ATan[Index]);
+
+		if (IsInverted)
+		{
+			Result.ChangeSign();
+			const BigType* const PiX[] = { &Tables.PiOverTwo[0], &Tables.PiOverTwo[1], &Result };
+			const BigType* const PiY[] = { &Tables.One, &Tables.One, &Tables.One };
+			Result = SumOfProducts(PiX, PiY);
+		}
+		if (Value.IsSign()) Result.ChangeSign();
+		return Result;
+	}
+
+	// Multi-doubles
+
+	template<int N>
+	void SinCos(const ddmath::MultiDouble<N>& Angle, ddmath::MultiDouble<N>& OutSin, ddmath::MultiDouble<N>& OutCos)
+	{
+		ddmath::SinCos(Angle, OutSin, OutCos);
+	}
+
+	// Same reduction as the ttmath SinCosDeg: below MaxReductionQuotient, 90 * Quadrant is exact as a multi-double, so is its difference with the angle
+	template<int N>
+	void SinCosDeg(const ddmath::MultiDouble<N>& Angle, ddmath::MultiDouble<N>& OutSin, ddmath::MultiDouble<N>& OutCos)
+	{
+		const ddmath::MultiDouble<N> DegToRad = ddmath::DivDouble(ddmath::PiConstant<N>(), 180.0);
+		const double Quadrant = std::floor(Angle.ToDouble() / 90.0 + 0.5);
+		if (!(std::fabs(Quadrant) < MaxReductionQuotient))
+		{
+			ddmath::SinCos(Angle * DegToRad, OutSin, OutCos);
+			return;
+		}
+
+		const ddmath::MultiDouble<N> Reduced = Angle - ddmath::MulDouble(ddmath::MultiDouble<N>(90.0), Quadrant);
+		ddmath::SinCos(DegToRad * Reduced, OutSin, OutCos);
+		ApplyQuadrant(int64(Quadrant), OutSin, OutCos);
+	}
+
+	template<int N>
+	ddmath::MultiDouble<N> ATan(const ddmath::MultiDouble<N>& Value)
+	{
+		return ddmath::ATan(Value);
+	}
+
+#if SPACEKIT_HAS_FLOAT128
+	// Binary128 numbers: sincosq and atanq when libquadmath is linked. Otherwise the angle converts exactly to ExactBigType, and goes through the kernels above
+
+	inline void SinCos(const f128math::Float128& Angle, f128math::Float128& OutSin, f128math::Float128& OutCos)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		f128math::NativeType Sin, Cos;
+		sincosq(Angle.ToNative(), &Sin, &Cos);
+		OutSin.SetNative(Sin);
+		OutCos.SetNative(Cos);
+#else
+		f128math::ExactBigType Sin, Cos;
+		SinCos(Angle.ToBig<f128math::ExactBigType>(), Sin, Cos);
+		OutSin = f128math::Float128::FromBig(Sin);
+		OutCos = f128math::Float128::FromBig(Cos);
+#endif
+	}
+
+	inline void SinCosDeg(const f128math::Float128& Angle, f128math::Float128& OutSin, f128math::Float128& OutCos)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		const double Quadrant = std::floor(Angle.ToDouble() / 90.0 + 0.5);
+		const f128math::NativeType Reduced = Angle.ToNative() - f128math::NativeType(90.0 * Quadrant);
+		constexpr auto DegToRad = RealFloatConstants::TConstants<f128math::Float128>::DegToRad();
+		SinCos(f128math::Float128::FromNative(Reduced * f128math::Float128::FromWords(DegToRad.Words[0], DegToRad.Words[1]).ToNative()), OutSin, OutCos);
+		ApplyQuadrant(int64(Quadrant), OutSin, OutCos);
+#else
+		f128math::ExactBigType Sin, Cos;
+		SinCosDeg(Angle.ToBig<f128math::ExactBigType>(), Sin, Cos);
+		OutSin = f128math::Float128::FromBig(Sin);
+		OutCos = f128math::Float128::FromBig(Cos);
+#endif
+	}
+
+	inline f128math::Float128 ATan(const f128math::Float128& Value)
+	{
+#if SPACEKIT_WITH_QUADMATH
+		return f128math::Float128::FromNative(atanq(Value.ToNative()));
+#else
+		return f128math::Float128::FromBig(ATan(Value.ToBig<f128math::ExactBigType>()));
+#endif
+	}
+#endif
+}
@@ -0,0 +1,286 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/RealFloat.h"
+#include "SpaceKitPrecision/Public/RealHybridGeneric.h"
+
+#include "CoreMinimal.h"
+#include "Core/Public/Serialization/StructuredArchive.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "RealHybrid.generated.h"
+
+/**
+ * Type for a real number that is a double while it can be, and a FRealFloat once it needs more precision. See THybridFloat.
+ * It's meant for values that mostly fit in a double, like velocities or masses: their math then runs in hardware, and only the values that need it pay for FRealFloat.
+ * It replaces FRealFloat properties as is: it converts implicitly to FRealFloat, FRealFloat values can be assigned to it, and properties saved as FRealFloat load into it.
+ */
+USTRUCT(BlueprintType)
+struct SPACEKITPRECISION_API FRealHybrid
+{
+	GENERATED_BODY()
+
+	using HybridType = THybridFloat<FRealFloat>;
+
+	// Stored as bytes, for the same reasons as FRealFloat, and trivially copyable like it, as is FVectorHybrid. See FRealFloat::InternalValue
+protected:
+	UPROPERTY()
+	uint8 InternalValue[sizeof(HybridType)];
+
+public:
+
+	FORCEINLINE HybridType& GetValue()
+	{
+		return *reinterpret_cast<HybridType*>(InternalValue);
+	}
+
+	FORCEINLINE const HybridType& GetValue() const
+	{
+		return *reinterpret_cast<const HybridType*>(InternalValue);
+	}
+
+	// Writes only the active member, over zeroed bytes. UE4 serializes InternalValue and compares it with the defaults byte by byte,
+	// so the rest of the union and the padding after the flag must not keep whatever was there
+	FORCEINLINE void SetValue(const HybridType& InValue)
+	{
+		FMemory::Memzero(InternalValue, sizeof(InternalValue));
+		HybridType& Value = GetValue();
+		if (InValue.bIsBig)
+		{
+			Value.Big = InValue.Big;
+		}
+		else
+		{
+			Value.Small = InValue.Small;
+		}
+		Value.bIsBig = InValue.bIsBig;
+	}
+
+public:
+
+	FRealHybrid()
+	{
+		SetValue(HybridType());
+	}
+
+	FRealHybrid(const FRealHybrid& InValue) = default;
+
+	FRealHybrid(FRealHybrid&& InValue) = default;
+
+	explicit FRealHybrid(const HybridType& InValue)
+	{
+		SetValue(InValue);
+	}
+
+	explicit FRealHybrid(double InValue)
+	{
+		SetValue(HybridType(InValue));
+	}
+
+	explicit FRealHybrid(int32 InValue)
+	{
+		SetValue(HybridType(double(InValue)));
+	}
+
+	// The value is a double if it fits in one exactly
+	explicit FRealHybrid(const FRealFloat& InValue)
+	{
+		SetValue(HybridType::FromBig(InValue));
+	}
+
+	explicit FRealHybrid(const FString& InValue)
+		: FRealHybrid(FRealFloat(InValue))
+	{
+	}
+
+	FRealHybrid& operator=(const FRealHybrid& Other) = default;
+
+	FRealHybrid& operator=(FRealHybrid&& Other) = default;
+
+	// So FRealFloat values can be assigned to former FRealFloat properties
+	FRealHybrid& operator=(const FRealFloat& Other)
+	{
+		SetValue(HybridType::FromBig(Other));
+		return *this;
+	}
+
+	// So the number can be passed where a FRealFloat is expected. Math mixing both types runs on FRealFloat
+	operator FRealFloat() const
+	{
+		return GetValue().ToBig();
+	}
+
+	// Whether the number has been promoted to a FRealFloat
+	bool IsBig() const
+	{
+		return GetValue().IsBig();
+	}
+
+	double ToDouble() const
+	{
+		return GetValue().ToDouble();
+	}
+
+	float ToFloat() const
+	{
+		return float(ToDouble());
+	}
+
+	FString ToString() const
+	{
+		return GetValue().ToBig().ToString();
+	}
+
+	bool ExportTextItem(FString& ValueStr, FRealHybrid const& DefaultValue, UObject* Parent, int32 PortFlags, UObject* ExportRootScope) const;
+	bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
+
+	// Loads the properties that were saved as FRealFloat
+	bool SerializeFromMismatchedTag(const struct FPropertyTag& Tag, FStructuredArchive::FSlot Slot);
+
+	static FRealHybrid GetMaxValue()
+	{
+		return FRealHybrid(FRealFloat::GetMaxValue());
+	}
+
+	static FRealHybrid GetMinValue()
+	{
+		return FRealHybrid(FRealFloat::GetMinValue());
+	}
+};
+
+static_assert(sizeof(FRealHybrid) == sizeof(FRealHybrid::HybridType), "FRealHybrid must not add any overhead to its storage");
+
+template<>
+struct TIsPODType<FRealHybrid>
+{
+	enum { Value = true };
+};
+
+template<>
+struct TStructOpsTypeTraits<FRealHybrid> : public TStructOpsTypeTraitsBase2<FRealHybrid>
+{
+	enum
+	{
+		WithExportTextItem = true,
+		WithImportTextItem = true,
+		WithStructuredSerializeFromMismatchedTag = true,
+		WithNoDestructor = true,
+	};
+};
+
+
+inline FRealHybrid operator+(const FRealHybrid& x, const FRealHybrid& y)
+{
+	return FRealHybrid(x.GetValue() + y.GetValue());
+}
+
+inline FRealHybrid& operator+=(FRealHybrid& x, const FRealHybrid& y)
+{
+	x.SetValue(x.GetValue() + y.GetValue());
+	return x;
+}
+
+inline FRealHybrid operator-(const FRealHybrid& x, const FRealHybrid& y)
+{
+	return FRealHybrid(x.GetValue() - y.GetValue());
+}
+
+inline FRealHybrid& operator-=(FRealHybrid& x, const FRealHybrid& y)
+{
+	x.SetValue(x.GetValue() - y.GetValue());
+	return x;
+}
+
+inline FRealHybrid operator-(const FRealHybrid& x)
+{
+	return FRealHybrid(-x.GetValue());
+}
+
+inline FRealHybrid operator*(const FRealHybrid& x, const FRealHybrid& y)
+{
+	return FRealHybrid(x.GetValue() * y.GetValue());
+}
+
+inline FRealHybrid& operator*=(FRealHybrid& x, const FRealHybrid& y)
+{
+	x.SetValue(x.GetValue() * y.GetValue());
+	return x;
+}
+
+inline FRealHybrid operator/(const FRealHybrid& x, const FRealHybrid& y)
+{
+	return FRealHybrid(x.GetValue() / y.GetValue());
+}
+
+inline FRealHybrid& operator/=(FRealHybrid& x, const FRealHybrid& y)
+{
+	x.SetValue(x.GetValue() / y.GetValue());
+	return x;
+}
+
+inline bool operator<(const FRealHybrid& x, const FRealHybrid& y)
+{
+	return x.GetValue() < y.GetValue();
+}
+
+inline bool operator<=(const FRealHybrid& x, const FRealHybrid& y)
+{
+	return x.GetValue() <= y.GetValue();
+}
+
+inline bool operator>=(const FRealHybrid& x, const FRealHybrid& y)
+{
+	return x.GetValue() >= y.GetValue();
+}
+
+inline bool operator>(const FRealHybrid& x, const FRealHybrid& y)
+{
+	return x.GetValue() > y.GetValue();
+}
+
+inline bool operator==(const FRealHybrid& x, const FRealHybrid& y)
+{
+	return x.GetValue() == y.GetValue();
+}
+
+inline bool operator!=(const FRealHybrid& x, const FRealHybrid& y)
+{
+	return x.GetValue() != y.GetValue();
+}
+
+/**
+ * Blueprints functions for RealHybrid. Its math is the RealFloat one, through the conversions
+ */
+UCLASS(BlueprintType, Abstract)
+class SPACEKITPRECISION_API URealHybridMath : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintPure, category = "RealHybrid", meta = (DisplayName = "RealHybrid to RealFloat", CompactNodeTitle = "->", BlueprintAutocast))
+	static FRealFloat ConvRealHybridToRealFloat(const FRealHybrid& InVal);
+
+	UFUNCTION(BlueprintPure, category = "RealHybrid", meta = (DisplayName = "RealFloat to RealHybrid", CompactNodeTitle = "->", BlueprintAutocast))
+	static FRealHybrid ConvRealFloatToRealHybrid(const FRealFloat& InVal);
+
+	UFUNCTION(BlueprintPure, category = "RealHybrid", meta = (DisplayName = "RealHybrid to String", CompactNodeTitle = "->", BlueprintAutocast))
+	static FString ConvRealHybridToString(const FRealHybrid& InVal);
+
+	UFUNCTION(BlueprintPure, category = "RealHybrid", meta = (DisplayName = "RealHybrid + RealHybrid", CompactNodeTitle = "+"))
+	static FRealHybrid HybridPlusHybrid(const FRealHybrid& First, const FRealHybrid& Second);
+
+	UFUNCTION(BlueprintPure, category = "RealHybrid", meta = (DisplayName = "RealHybrid - RealHybrid", CompactNodeTitle = "-"))
+	static FRealHybrid HybridMinusHybrid(const FRealHybrid& First, const FRealHybrid& Second);
+
+	UFUNCTION(BlueprintPure, category = "RealHybrid", meta = (DisplayName = "RealHybrid * RealHybrid", CompactNodeTitle = "*"))
+	static FRealHybrid HybridMultHybrid(const FRealHybrid& First, const FRealHybrid& Second);
+
+	UFUNCTION(BlueprintPure, category = "RealHybrid", meta = (DisplayName = "RealHybrid / RealHybrid", CompactNodeTitle = "/"))
+	static FRealHybrid HybridDivHybrid(const FRealHybrid& First, const FRealHybrid& Second);
+
+	// Whether the number has been promoted to a RealFloat
+	UFUNCTION(BlueprintPure, category = "RealHybrid")
+	static bool IsBig(const FRealHybrid& InVal);
+};
@@ -0,0 +1,342 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/PrecisionSettings.h"
+#include "SpaceKitPrecision/Public/MultiDouble.h"
+
+#include "Core/Public/HAL/Platform.h"
+#include "CoreMinimal.h"
+
+#include <cmath>
+#include <type_traits>
+
+// The rounding errors below are only exact with IEEE semantics, that UE4's /fp:fast doesn't keep on MSVC, see MultiDouble.h
+#if defined(_MSC_VER)
+#pragma float_control(precise, on, push)
+#endif
+
+// A real number stored either as a double, or as a BigType number (e.g. FRealFloat) once it needs more precision.
+// Operations on two doubles run in hardware. Error-free transformations compute their rounding error too, and if it's within
+// HYBRID_FLOAT_MAX_RELATIVE_ERROR (see PrecisionSettings.h), the result stays a double. Else the operation is done again on BigType numbers,
+// and the result is promoted to BigType.
+// Results of BigType operations, as values set from outside, are demoted back to doubles when a double is within the same tolerance of them (see FromBig).
+// BigType must be trivially copyable, constructible from a double exactly, and have ToDouble(), the arithmetic and the comparison operators.
+template<typename BigType>
+struct THybridFloat
+{
+	// Relative error under which the result of an operation on doubles stays a double. See PrecisionSettings.h
+	static constexpr double MaxRelativeError = HYBRID_FLOAT_MAX_RELATIVE_ERROR;
+
+	static_assert(std::is_trivially_copyable<BigType>::value, "BigType shares its storage with a double, so it can't need to be constructed or copied");
+
+	// Products and quotients whose magnitude is below 2^-969 can have a rounding error that isn't a double itself, so theirs isn't computed exactly
+	static constexpr double MinExactProduct = 2.0041683600089728e-292;
+
+	// Relative error of the conversion of a number in the range of normal doubles to a double, whether it's rounded or truncated
+	static constexpr double ConversionError = 2.2204460492503131e-16;
+
+	// Only one of them is set, as told by bIsBig
+	union
+	{
+		BigType Big;
+		double Small;
+	};
+	bool bIsBig;
+
+	THybridFloat()
+		: Small(0), bIsBig(false)
+	{
+	}
+
+	explicit THybridFloat(double InValue)
+		: Small(InValue), bIsBig(false)
+	{
+	}
+
+	// A big number, that stays big
+	static THybridFloat MakeBig(const BigType& InValue)
+	{
+		THybridFloat Result;
+		Result.Big = InValue;
+		Result.bIsBig = true;
+		return Result;
+	}
+
+	// A big number, demoted to a double if that's within MaxRelativeError of it. Above ConversionError, any double in the normal range is, which is cheap to check.
+	// Else it has to be exact, which costs a conversion and a comparison
+	static THybridFloat FromBig(const BigType& InValue)
+	{
+		const double Value = InValue.ToDouble();
+		const bool bWithinTolerance = MaxRelativeError >= ConversionError && FMath::Abs(Value) >= MIN_dbl && FMath::Abs(Value) <= MAX_dbl;
+		if (bWithinTolerance || (std::isfinite(Value) && BigType(Value) == InValue))
+		{
+			return THybridFloat(Value);
+		}
+		return MakeBig(InValue);
+	}
+
+	bool IsBig() const
+	{
+		return bIsBig;
+	}
+
+	// The value as a big number, exact
+	BigType ToBig() const
+	{
+		return bIsBig ? Big : BigType(Small);
+	}
+
+	double ToDouble() const
+	{
+		return bIsBig ? Big.ToDouble() : Small;
+	}
+
+	// Whether Error, the rounding error of Result, is small enough for Result to stay a double. Overflows never are
+	static FORCEINLINE bool IsAccurate(double Result, double Error)
+	{
+		return Error == 0 || (FMath::Abs(Error) <= MaxRelativeError * FMath::Abs(Result) && std::isfinite(Result));
+	}
+
+	// ddmath::TwoProd, that also splits operands above 2^996 without hardware fused multiply-adds. Its halves would overflow, so these products take the slow std::fma
+	static FORCEINLINE double TwoProd(double x, double y, double& OutError)
+	{
+		const double Product = ddmath::TwoProd(x, y, OutError);
+#if !DDMATH_HARDWARE_FMA
+		if (!std::isfinite(OutError) && std::isfinite(Product))
+		{
+			OutError = std::fma(x, y, -Product);
+		}
+#endif
+		return Product;
+	}
+
+	// Sets this number to x + y, if both are doubles and the sum is accurate. The rounding error of a sum is exactly a double
+	FORCEINLINE bool TryAdd(double x, double y)
+	{
+		double Error;
+		const double Sum = ddmath::TwoSum(x, y, Error);
+		if (IsAccurate(Sum, Error))
+		{
+			Small = Sum;
+			bIsBig = false;
+			return true;
+		}
+		return false;
+	}
+
+	// Sets this number to x * y, if the product is accurate. The rounding error of a product is exactly a double
+	FORCEINLINE bool TryMultiply(double x, double y)
+	{
+		double Error;
+		const double Product = TwoProd(x, y, Error);
+		if (!(FMath::Abs(Product) >= MinExactProduct) && x != 0 && y != 0)
+		{
+			return false;
+		}
+		if (IsAccurate(Product, Error))
+		{
+			Small = Product;
+			bIsBig = false;
+			return true;
+		}
+		return false;
+	}
+
+	// Sets this number to x / y, if the quotient is accurate. The remainder x - q * y is exactly a double, so is q's rounding error times y
+	FORCEINLINE bool TryDivide(double x, double y)
+	{
+		const double Quotient = x / y;
+		if (!(FMath::Abs(Quotient) >= MinExactProduct) && x != 0)
+		{
+			return false;
+		}
+		// q * y is within a rounding of x, so x - q * y and the remainder are exact. An infinite or NaN quotient has an infinite or NaN remainder, so is promoted
+		double ProductError;
+		const double Product = TwoProd(Quotient, y, ProductError);
+		if (IsAccurate(Quotient, ((x - Product) - ProductError) / y))
+		{
+			Small = Quotient;
+			bIsBig = false;
+			return true;
+		}
+		return false;
+	}
+
+	// Sets this number to the square root of x, if it's accurate. The remainder x - s * s is exactly a double, so is s's rounding error times 2s
+	FORCEINLINE bool TrySqrt(double x)
+	{
+		const double Root = std::sqrt(x);
+		if (!(Root >= MinExactProduct) && x != 0)
+		{
+			return false;
+		}
+		double SquareError;
+		const double Square = TwoProd(Root, Root, SquareError);
+		if (IsAccurate(Root, x == 0 ? 0 : ((x - Square) - SquareError) / (2 * Root)))
+		{
+			Small = Root;
+			bIsBig = false;
+			return true;
+		}
+		return false;
+	}
+};
+
+template<typename BigType>
+FORCEINLINE THybridFloat<BigType> operator+(const THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	THybridFloat<BigType> Result;
+	if (x.bIsBig || y.bIsBig || !Result.TryAdd(x.Small, y.Small))
+	{
+		Result = THybridFloat<BigType>::FromBig(x.ToBig() + y.ToBig());
+	}
+	return Result;
+}
+
+template<typename BigType>
+FORCEINLINE THybridFloat<BigType> operator-(const THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	THybridFloat<BigType> Result;
+	if (x.bIsBig || y.bIsBig || !Result.TryAdd(x.Small, -y.Small))
+	{
+		Result = THybridFloat<BigType>::FromBig(x.ToBig() - y.ToBig());
+	}
+	return Result;
+}
+
+template<typename BigType>
+FORCEINLINE THybridFloat<BigType> operator*(const THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	THybridFloat<BigType> Result;
+	if (x.bIsBig || y.bIsBig || !Result.TryMultiply(x.Small, y.Small))
+	{
+		Result = THybridFloat<BigType>::FromBig(x.ToBig() * y.ToBig());
+	}
+	return Result;
+}
+
+template<typename BigType>
+FORCEINLINE THybridFloat<BigType> operator/(const THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	THybridFloat<BigType> Result;
+	if (x.bIsBig || y.bIsBig || !Result.TryDivide(x.Small, y.Small))
+	{
+		Result = THybridFloat<BigType>::FromBig(x.ToBig() / y.ToBig());
+	}
+	return Result;
+}
+
+template<typename BigType>
+FORCEINLINE THybridFloat<BigType> operator-(const THybridFloat<BigType>& x)
+{
+	return x.bIsBig ? THybridFloat<BigType>::MakeBig(-x.Big) : THybridFloat<BigType>(-x.Small);
+}
+
+template<typename BigType>
+FORCEINLINE THybridFloat<BigType>& operator+=(THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	if (x.bIsBig)
+	{
+		x = THybridFloat<BigType>::FromBig(x.Big + y.ToBig());
+	}
+	else if (y.bIsBig || !x.TryAdd(x.Small, y.Small))
+	{
+		x = THybridFloat<BigType>::FromBig(BigType(x.Small) + y.ToBig());
+	}
+	return x;
+}
+
+template<typename BigType>
+FORCEINLINE THybridFloat<BigType>& operator-=(THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	if (x.bIsBig)
+	{
+		x = THybridFloat<BigType>::FromBig(x.Big - y.ToBig());
+	}
+	else if (y.bIsBig || !x.TryAdd(x.Small, -y.Small))
+	{
+		x = THybridFloat<BigType>::FromBig(BigType(x.Small) - y.ToBig());
+	}
+	return x;
+}
+
+template<typename BigType>
+FORCEINLINE THybridFloat<BigType>& operator*=(THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	if (x.bIsBig)
+	{
+		x = THybridFloat<BigType>::FromBig(x.Big * y.ToBig());
+	}
+	else if (y.bIsBig || !x.TryMultiply(x.Small, y.Small))
+	{
+		x = THybridFloat<BigType>::FromBig(BigType(x.Small) * y.ToBig());
+	}
+	return x;
+}
+
+template<typename BigType>
+FORCEINLINE THybridFloat<BigType>& operator/=(THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	if (x.bIsBig)
+	{
+		x = THybridFloat<BigType>::FromBig(x.Big / y.ToBig());
+	}
+	else if (y.bIsBig || !x.TryDivide(x.Small, y.Small))
+	{
+		x = THybridFloat<BigType>::FromBig(BigType(x.Small) / y.ToBig());
+	}
+	return x;
+}
+
+template<typename BigType>
+FORCEINLINE bool operator<(const THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	return x.bIsBig || y.bIsBig ? x.ToBig() < y.ToBig() : x.Small < y.Small;
+}
+
+template<typename BigType>
+FORCEINLINE bool operator<=(const THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	return x.bIsBig || y.bIsBig ? x.ToBig() <= y.ToBig() : x.Small <= y.Small;
+}
+
+template<typename BigType>
+FORCEINLINE bool operator>(const THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	return y < x;
+}
+
+template<typename BigType>
+FORCEINLINE bool operator>=(const THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	return y <= x;
+}
+
+template<typename BigType>
+FORCEINLINE bool operator==(const THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	return x.bIsBig || y.bIsBig ? x.ToBig() == y.ToBig() : x.Small == y.Small;
+}
+
+template<typename BigType>
+FORCEINLINE bool operator!=(const THybridFloat<BigType>& x, const THybridFloat<BigType>& y)
+{
+	return !(x == y);
+}
+
+// Square root, on doubles while it's accurate
+template<typename BigType, typename BigSqrtType>
+THybridFloat<BigType> HybridSqrt(const THybridFloat<BigType>& x, BigSqrtType BigSqrt)
+{
+	THybridFloat<BigType> Result;
+	if (x.bIsBig || !Result.TrySqrt(x.Small))
+	{
+		Result = THybridFloat<BigType>::FromBig(BigSqrt(x.ToBig()));
+	}
+	return Result;
+}
+
+#if defined(_MSC_VER)
+#pragma float_control(pop)
+#endif
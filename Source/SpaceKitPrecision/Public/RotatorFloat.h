@@ -35,7 +35,7 @@ public:
     {
     }
 
-    FRotatorFloat(FRealFloat InYaw, FRealFloat InPitch, FRealFloat InRoll)
+    FRotatorFloat(const FRealFloat& InYaw, const FRealFloat& InPitch, const FRealFloat& InRoll)
         : Yaw(InYaw), Pitch(InPitch), Roll(InRoll)
     {
     }
@@ -58,7 +58,10 @@ public:
 
     FRotatorFloat& operator+=(const FRotatorFloat& Other)
     {
-        return *this = *this + Other;
+        Yaw += Other.Yaw;
+        Pitch += Other.Pitch;
+        Roll += Other.Roll;
+        return *this;
     }
 
     FRotatorFloat operator-(const FRotatorFloat& Other) const
@@ -68,7 +71,10 @@ public:
 
     FRotatorFloat& operator-=(const FRotatorFloat& Other)
     {
-        return *this = *this - Other;
+        Yaw -= Other.Yaw;
+        Pitch -= Other.Pitch;
+        Roll -= Other.Roll;
+        return *this;
     }
 
     FRotatorFloat operator*(const FRotatorFloat& Other) const
@@ -78,17 +84,23 @@ public:
 
     FRotatorFloat& operator*=(const FRotatorFloat& Other)
     {
-        return *this = *this * Other;
+        Yaw *= Other.Yaw;
+        Pitch *= Other.Pitch;
+        Roll *= Other.Roll;
+        return *this;
     }
 
-    FRotatorFloat operator*(FRealFloat Other) const
+    FRotatorFloat operator*(const FRealFloat& Other) const
     {
         return FRotatorFloat(Yaw * Other, Pitch * Other, Roll * Other);
     }
 
-    FRotatorFloat& operator*=(FRealFloat Other)
+    FRotatorFloat& operator*=(const FRealFloat& Other)
     {
-        return *this = *this * Other;
+        Yaw *= Other;
+        Pitch *= Other;
+        Roll *= Other;
+        return *this;
     }
 
     FRotatorFloat operator/(const FRotatorFloat& Other) const
@@ -98,17 +110,33 @@ public:
 
     FRotatorFloat& operator/=(const FRotatorFloat& Other)
     {
-        return *this = *this / Other;
+        Yaw /= Other.Yaw;
+        Pitch /= Other.Pitch;
+        Roll /= Other.Roll;
+        return *this;
     }
 
-    FRotatorFloat operator/(FRealFloat Other) const
+    FRotatorFloat operator/(const FRealFloat& Other) const
+    {
+        return *this / FRealFloatReciprocal(Other);
+    }
+
+    FRotatorFloat& operator/=(const FRealFloat& Other)
+    {
+        return *this /= FRealFloatReciprocal(Other);
+    }
+
+    FRotatorFloat operator/(const FRealFloatReciprocal& Other) const
     {
         return FRotatorFloat(Yaw / Other, Pitch / Other, Roll / Other);
     }
 
-    FRotatorFloat& operator/=(FRealFloat Other)
+    FRotatorFloat& operator/=(const FRealFloatReciprocal& Other)
     {
-        return *this = *this / Other;
+        Yaw /= Other;
+        Pitch /= Other;
+        Roll /= Other;
+        return *this;
     }
 
     FRotatorFloat operator-() const
@@ -121,7 +149,7 @@ public:
         return FRotator(Pitch.ToFloat(), Yaw.ToFloat(), Roll.ToFloat());
     }
 
-    bool Equals(const FRotatorFloat& Other, FRealFloat Tolerance = FRealFloat(1.0e-8)) const
+    bool Equals(const FRotatorFloat& Other, const FRealFloat& Tolerance = FRealFloat(1.0e-8)) const
     {
         return (*this - Other).GetAbsSum() <= Tolerance;
     }
@@ -163,6 +191,12 @@ public:
     }
 };
 
+template<>
+struct TIsPODType<FRotatorFloat>
+{
+    enum { Value = true };
+};
+
 /**
  * Blueprints math library for RotatorFloat
  */
@@ -0,0 +1,49 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+// Single place where ttmath is configured and included. Every SpaceKit header must include ttmath through this one,
+// as ttmath's limb kernels are templates, and mixing configurations between translation units would break the ODR.
+
+// Whether ttmath uses its x86_64 assembly kernels (add/sub/mul/div of limbs). Can be overridden in the Build.cs.
+// They are GCC-style inline assembly, so they are only available with GCC and Clang, e.g. on Linux dedicated servers.
+// MSVC would need ttmathuint_x86_64_msvc.asm to be assembled and linked, which UE4 doesn't do, so it defaults to the portable kernels.
+// The x86_64 kernels only use base x86_64 instructions (adc, sbb, mul, div), so there is no need for a runtime CPU check.
+#ifndef SPACEKIT_TTMATH_ASM
+#if defined(__GNUC__) && defined(__x86_64__)
+#define SPACEKIT_TTMATH_ASM 1
+#else
+#define SPACEKIT_TTMATH_ASM 0
+#endif
+#endif
+
+#if !SPACEKIT_TTMATH_ASM
+#define TTMATH_NOASM
+
+// The portable kernels split words in halves to multiply and divide them. When the compiler has 128-bit products and divisions, use them instead.
+// Can be overridden in the Build.cs too
+#ifndef SPACEKIT_TTMATH_NATIVE_WORDS
+#define SPACEKIT_TTMATH_NATIVE_WORDS 1
+#endif
+
+#if SPACEKIT_TTMATH_NATIVE_WORDS && (defined(__SIZEOF_INT128__) || (defined(_MSC_VER) && defined(_M_X64)))
+#define TTMATH_NOASM_NATIVE_WORDS
+#endif
+#endif
+
+// Include ttmath
+#pragma warning(push)
+#pragma warning(disable: 5051)
+#include "SpaceKitPrecision/Private/ttmath/ttmath.h"
+#pragma warning(pop)
+
+// Name of the limb kernels ttmath was compiled with, for logs and benchmarks
+#if !defined(TTMATH_NOASM) && defined(TTMATH_PLATFORM64)
+#define SPACEKIT_TTMATH_KERNELS TEXT("x86_64 assembly")
+#elif !defined(TTMATH_NOASM)
+#define SPACEKIT_TTMATH_KERNELS TEXT("x86 assembly")
+#elif defined(TTMATH_NOASM_NATIVE_WORDS)
+#define SPACEKIT_TTMATH_KERNELS TEXT("portable, with native 128-bit words")
+#else
+#define SPACEKIT_TTMATH_KERNELS TEXT("portable")
+#endif
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "SpaceKitPrecision/Public/RealFixed.h"
+#include "SpaceKitPrecision/Public/VectorFixedGeneric.h"
 #include "VectorFloat.h"
 
 #include "VectorFixed.generated.h"
@@ -34,7 +35,7 @@ public:
     {
     }
 
-    FVectorFixed(FRealFixed InX, FRealFixed InY, FRealFixed InZ)
+    FVectorFixed(const FRealFixed& InX, const FRealFixed& InY, const FRealFixed& InZ)
         : X(InX), Y(InY), Z(InZ)
     {
     }
@@ -44,6 +45,21 @@ public:
     {
     }
 
+    // Converts a vector of any precision to this one's. See real_fixed's conversion constructor
+    template<int MantissaSize, int Exponent>
+    explicit FVectorFixed(const TVectorFixed<MantissaSize, Exponent>& InVec)
+        : X(InVec.X), Y(InVec.Y), Z(InVec.Z)
+    {
+    }
+
+    // Converts this vector to a vector of any precision
+    template<int MantissaSize, int Exponent>
+    explicit operator TVectorFixed<MantissaSize, Exponent>() const
+    {
+        using RealType = TRealFixed<MantissaSize, Exponent>;
+        return TVectorFixed<MantissaSize, Exponent>(RealType(X), RealType(Y), RealType(Z));
+    }
+
     // Vector math
 public:
 	
@@ -54,7 +70,10 @@ public:
 
     FVectorFixed& operator+=(const FVectorFixed& Other)
     {
-        return *this = *this + Other;
+        X += Other.X;
+        Y += Other.Y;
+        Z += Other.Z;
+        return *this;
     }
 
     FVectorFixed operator-(const FVectorFixed& Other) const
@@ -64,7 +83,10 @@ public:
 
     FVectorFixed& operator-=(const FVectorFixed& Other)
     {
-        return *this = *this - Other;
+        X -= Other.X;
+        Y -= Other.Y;
+        Z -= Other.Z;
+        return *this;
     }
 
     FVectorFixed operator*(const FVectorFixed& Other) const
@@ -74,17 +96,23 @@ public:
 
     FVectorFixed& operator*=(const FVectorFixed& Other)
     {
-        return *this = *this * Other;
+        X *= Other.X;
+        Y *= Other.Y;
+        Z *= Other.Z;
+        return *this;
     }
 
-    FVectorFixed operator*(FRealFixed Other) const
+    FVectorFixed operator*(const FRealFixed& Other) const
     {
         return FVectorFixed(X * Other, Y * Other, Z * Other);
     }
 
-    FVectorFixed& operator*=(FRealFixed Other)
+    FVectorFixed& operator*=(const FRealFixed& Other)
     {
-        return *this = *this * Other;
+        X *= Other;
+        Y *= Other;
+        Z *= Other;
+        return *this;
     }
 
     FVectorFixed operator/(const FVectorFixed& Other) const
@@ -94,17 +122,33 @@ public:
 
     FVectorFixed& operator/=(const FVectorFixed& Other)
     {
-        return *this = *this / Other;
+        X /= Other.X;
+        Y /= Other.Y;
+        Z /= Other.Z;
+        return *this;
     }
 
-    FVectorFixed operator/(FRealFixed Other) const
+    FVectorFixed operator/(const FRealFixed& Other) const
+    {
+        return *this / FRealFixedReciprocal(Other);
+    }
+
+    FVectorFixed& operator/=(const FRealFixed& Other)
+    {
+        return *this /= FRealFixedReciprocal(Other);
+    }
+
+    FVectorFixed operator/(const FRealFixedReciprocal& Other) const
     {
         return FVectorFixed(X / Other, Y / Other, Z / Other);
     }
 
-    FVectorFixed& operator/=(FRealFixed Other)
+    FVectorFixed& operator/=(const FRealFixedReciprocal& Other)
     {
-        return *this = *this / Other;
+        X /= Other;
+        Y /= Other;
+        Z /= Other;
+        return *this;
     }
 
     FVectorFixed operator-() const
@@ -117,6 +161,19 @@ public:
         return FVector(X.ToFloat(), Y.ToFloat(), Z.ToFloat());
     }
 
+    // Converts many vectors at once, e.g. to hand positions over to the engine every frame.
+    // Each coordinate only takes a few integer operations on its mantissa (see real_fixed::ToFloat)
+    static void ToFVectors(const TArray<FVectorFixed>& InVectors, TArray<FVector>& OutVectors)
+    {
+        OutVectors.SetNumUninitialized(InVectors.Num());
+        const FVectorFixed* const Source = InVectors.GetData();
+        FVector* const Destination = OutVectors.GetData();
+        for (int32 Index = 0; Index < InVectors.Num(); Index++)
+        {
+            Destination[Index] = Source[Index].ToFVector();
+        }
+    }
+
     static FRealFixed DotProduct(const FVectorFixed& Vec, const FVectorFixed& Other)
     {
         return Vec.X * Other.X + Vec.Y * Other.Y + Vec.Z * Other.Z;
@@ -137,7 +194,7 @@ public:
         return CrossProduct(*this, Other);
     }
 
-    bool Equals(const FVectorFixed& Other, FRealFixed Tolerance = FRealFixed(1.0e-8)) const
+    bool Equals(const FVectorFixed& Other, const FRealFixed& Tolerance = FRealFixed(1.0e-8)) const
     {
         return (*this - Other).GetAbsSum() <= Tolerance;
     }
@@ -159,11 +216,11 @@ public:
 
     FRealFixed Size() const
     {
-        const auto SizeSq = SizeSquared();
-        return URealFixedMath::Sqrt(SizeSq);
+        // Doesn't overflow, even when SizeSquared would
+        return FRealFixed(Hypot(X.GetValue(), Y.GetValue(), Z.GetValue()));
     }
 
-    FVectorFixed GetNormal(FRealFixed Tolerance = FRealFixed(1.0e-8)) const
+    FVectorFixed GetNormal(const FRealFixed& Tolerance = FRealFixed(1.0e-8)) const
     {
         const FRealFixed ThisSize = Size();
         if (ThisSize < Tolerance) return Identity;
@@ -191,6 +248,12 @@ public:
     }
 };
 
+template<>
+struct TIsPODType<FVectorFixed>
+{
+    enum { Value = true };
+};
+
 /**
  * Blueprints math library for VectorFixed
  */
@@ -253,4 +316,12 @@ public:
     UFUNCTION(BlueprintPure, category = "VectorFixed", meta = (DisplayName = "VecFixed CrossProduct", CompactNodeTitle = "^"))
     static FVectorFixed ProjectOnTo(const FVectorFixed& A, const FVectorFixed& B);
 
+    // Angle, around the Z axis, of the direction from From to To, in radians, in [-pi, pi]. Stays in the fixed point domain
+    UFUNCTION(BlueprintPure, category = "VectorFixed", meta = (DisplayName = "VecFixed bearing (Radians)"))
+    static FRealFixed BearingRad(const FVectorFixed& From, const FVectorFixed& To);
+
+    // Angle, above the XY plane, of the direction from From to To, in radians, in [-pi/2, pi/2]. Stays in the fixed point domain
+    UFUNCTION(BlueprintPure, category = "VectorFixed", meta = (DisplayName = "VecFixed elevation (Radians)"))
+    static FRealFixed ElevationRad(const FVectorFixed& From, const FVectorFixed& To);
+
 };
@@ -0,0 +1,212 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/RealFixedGeneric.h"
+
+#include "CoreMinimal.h"
+
+
+// Similar to an FVector, but using fixed-point reals of a given precision. See real_fixed for MantissaSize and Exponent.
+// It's the C++ counterpart of FVectorFixed, for when vectors don't all need the same precision. FVectorFixed stays the Blueprint-facing type.
+// Conversions between precisions are explicit, as they can round.
+template<int MantissaSize, int Exponent>
+struct TVectorFixed
+{
+	using RealType = real_fixed<MantissaSize, Exponent>;
+	using ReciprocalType = real_fixed_reciprocal<MantissaSize, Exponent>;
+
+	RealType X;
+	RealType Y;
+	RealType Z;
+
+	TVectorFixed()
+		: X(RealType::FromMantissa(typename RealType::ttIntMantissaType(0)))
+		, Y(X)
+		, Z(X)
+	{
+	}
+
+	TVectorFixed(const RealType& InX, const RealType& InY, const RealType& InZ)
+		: X(InX), Y(InY), Z(InZ)
+	{
+	}
+
+	explicit TVectorFixed(const FVector& InVec)
+		: X(InVec.X), Y(InVec.Y), Z(InVec.Z)
+	{
+	}
+
+	// Converts a vector of another precision, component by component. See real_fixed's conversion constructor
+	template<int OtherMantissaSize, int OtherExponent>
+	explicit TVectorFixed(const TVectorFixed<OtherMantissaSize, OtherExponent>& Other)
+		: X(RealType(Other.X)), Y(RealType(Other.Y)), Z(RealType(Other.Z))
+	{
+	}
+
+	// Vector math
+public:
+
+	TVectorFixed operator+(const TVectorFixed& Other) const
+	{
+		return TVectorFixed(X + Other.X, Y + Other.Y, Z + Other.Z);
+	}
+
+	TVectorFixed& operator+=(const TVectorFixed& Other)
+	{
+		X += Other.X;
+		Y += Other.Y;
+		Z += Other.Z;
+		return *this;
+	}
+
+	TVectorFixed operator-(const TVectorFixed& Other) const
+	{
+		return TVectorFixed(X - Other.X, Y - Other.Y, Z - Other.Z);
+	}
+
+	TVectorFixed& operator-=(const TVectorFixed& Other)
+	{
+		X -= Other.X;
+		Y -= Other.Y;
+		Z -= Other.Z;
+		return *this;
+	}
+
+	TVectorFixed operator*(const TVectorFixed& Other) const
+	{
+		return TVectorFixed(X * Other.X, Y * Other.Y, Z * Other.Z);
+	}
+
+	TVectorFixed& operator*=(const TVectorFixed& Other)
+	{
+		X *= Other.X;
+		Y *= Other.Y;
+		Z *= Other.Z;
+		return *this;
+	}
+
+	TVectorFixed operator*(const RealType& Other) const
+	{
+		return TVectorFixed(X * Other, Y * Other, Z * Other);
+	}
+
+	TVectorFixed& operator*=(const RealType& Other)
+	{
+		X *= Other;
+		Y *= Other;
+		Z *= Other;
+		return *this;
+	}
+
+	TVectorFixed operator/(const TVectorFixed& Other) const
+	{
+		return TVectorFixed(X / Other.X, Y / Other.Y, Z / Other.Z);
+	}
+
+	TVectorFixed& operator/=(const TVectorFixed& Other)
+	{
+		X /= Other.X;
+		Y /= Other.Y;
+		Z /= Other.Z;
+		return *this;
+	}
+
+	TVectorFixed operator/(const RealType& Other) const
+	{
+		return *this / ReciprocalType(Other);
+	}
+
+	TVectorFixed& operator/=(const RealType& Other)
+	{
+		return *this /= ReciprocalType(Other);
+	}
+
+	TVectorFixed operator/(const ReciprocalType& Other) const
+	{
+		return TVectorFixed(X / Other, Y / Other, Z / Other);
+	}
+
+	TVectorFixed& operator/=(const ReciprocalType& Other)
+	{
+		X /= Other;
+		Y /= Other;
+		Z /= Other;
+		return *this;
+	}
+
+	TVectorFixed operator-() const
+	{
+		return TVectorFixed(-X, -Y, -Z);
+	}
+
+	// Exact comparisons. Use Equals to compare with a tolerance
+	bool operator==(const TVectorFixed& Other) const
+	{
+		return X == Other.X && Y == Other.Y && Z == Other.Z;
+	}
+
+	bool operator!=(const TVectorFixed& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	FVector ToFVector() const
+	{
+		return FVector(X.ToFloat(), Y.ToFloat(), Z.ToFloat());
+	}
+
+	static RealType DotProduct(const TVectorFixed& Vec, const TVectorFixed& Other)
+	{
+		return Vec.X * Other.X + Vec.Y * Other.Y + Vec.Z * Other.Z;
+	}
+
+	RealType operator|(const TVectorFixed& Other) const
+	{
+		return DotProduct(*this, Other);
+	}
+
+	static TVectorFixed CrossProduct(const TVectorFixed& Vec, const TVectorFixed& Other)
+	{
+		return TVectorFixed(Vec.Y * Other.Z - Vec.Z * Other.Y, Vec.Z * Other.X - Vec.X * Other.Z, Vec.X * Other.Y - Vec.Y * Other.X);
+	}
+
+	TVectorFixed operator^(const TVectorFixed& Other) const
+	{
+		return CrossProduct(*this, Other);
+	}
+
+	bool Equals(const TVectorFixed& Other, const RealType& Tolerance) const
+	{
+		return (*this - Other).GetAbsSum() <= Tolerance;
+	}
+
+	RealType SizeSquared() const
+	{
+		return DotProduct(*this, *this);
+	}
+
+	RealType Size() const
+	{
+		return Hypot(X, Y, Z);
+	}
+
+	// Returns the zero vector if this vector is smaller than Tolerance
+	TVectorFixed GetNormal(const RealType& Tolerance) const
+	{
+		const RealType ThisSize = Size();
+		if (ThisSize < Tolerance) return TVectorFixed();
+		return *this / ThisSize;
+	}
+
+	RealType GetAbsSum() const
+	{
+		const auto AbsReal = [](const RealType& Value) { return Value.mantissa.IsSign() ? -Value : Value; };
+		return AbsReal(X) + AbsReal(Y) + AbsReal(Z);
+	}
+
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("(X=%s,Y=%s,Z=%s)"), *X.ToString(), *Y.ToString(), *Z.ToString());
+	}
+};
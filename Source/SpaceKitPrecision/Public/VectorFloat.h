@@ -34,7 +34,7 @@ public:
     {
     }
 
-    FVectorFloat(FRealFloat InX, FRealFloat InY, FRealFloat InZ)
+    FVectorFloat(const FRealFloat& InX, const FRealFloat& InY, const FRealFloat& InZ)
         : X(InX), Y(InY), Z(InZ)
     {
     }
@@ -59,7 +59,10 @@ public:
 
     FVectorFloat& operator+=(const FVectorFloat& Other)
     {
-        return *this = *this + Other;
+        X += Other.X;
+        Y += Other.Y;
+        Z += Other.Z;
+        return *this;
     }
 
     FVectorFloat operator-(const FVectorFloat& Other) const
@@ -69,7 +72,10 @@ public:
 
     FVectorFloat& operator-=(const FVectorFloat& Other)
     {
-        return *this = *this - Other;
+        X -= Other.X;
+        Y -= Other.Y;
+        Z -= Other.Z;
+        return *this;
     }
 
     FVectorFloat operator*(const FVectorFloat& Other) const
@@ -79,17 +85,23 @@ public:
 
     FVectorFloat& operator*=(const FVectorFloat& Other)
     {
-        return *this = *this * Other;
+        X *= Other.X;
+        Y *= Other.Y;
+        Z *= Other.Z;
+        return *this;
     }
 
-    FVectorFloat operator*(FRealFloat Other) const
+    FVectorFloat operator*(const FRealFloat& Other) const
     {
         return FVectorFloat(X * Other, Y * Other, Z * Other);
     }
 
-    FVectorFloat& operator*=(FRealFloat Other)
+    FVectorFloat& operator*=(const FRealFloat& Other)
     {
-        return *this = *this * Other;
+        X *= Other;
+        Y *= Other;
+        Z *= Other;
+        return *this;
     }
 
     FVectorFloat operator/(const FVectorFloat& Other) const
@@ -99,17 +111,33 @@ public:
 
     FVectorFloat& operator/=(const FVectorFloat& Other)
     {
-        return *this = *this / Other;
+        X /= Other.X;
+        Y /= Other.Y;
+        Z /= Other.Z;
+        return *this;
     }
 
-    FVectorFloat operator/(FRealFloat Other) const
+    FVectorFloat operator/(const FRealFloat& Other) const
+    {
+        return *this / FRealFloatReciprocal(Other);
+    }
+
+    FVectorFloat& operator/=(const FRealFloat& Other)
+    {
+        return *this /= FRealFloatReciprocal(Other);
+    }
+
+    FVectorFloat operator/(const FRealFloatReciprocal& Other) const
     {
         return FVectorFloat(X / Other, Y / Other, Z / Other);
     }
 
-    FVectorFloat& operator/=(FRealFloat Other)
+    FVectorFloat& operator/=(const FRealFloatReciprocal& Other)
     {
-        return *this = *this / Other;
+        X /= Other;
+        Y /= Other;
+        Z /= Other;
+        return *this;
     }
 
     FVectorFloat operator-() const
@@ -122,9 +150,10 @@ public:
         return FVector(X.ToFloat(), Y.ToFloat(), Z.ToFloat());
     }
 
+    // Rounded only once, see URealFloatMath::SumOfProducts
     static FRealFloat DotProduct(const FVectorFloat& Vec, const FVectorFloat& Other)
     {
-        return Vec.X * Other.X + Vec.Y * Other.Y + Vec.Z * Other.Z;
+        return URealFloatMath::SumOfProducts(Vec.X, Other.X, Vec.Y, Other.Y, Vec.Z, Other.Z);
     }
 
     FRealFloat operator|(const FVectorFloat& Other) const
@@ -132,9 +161,14 @@ public:
         return DotProduct(*this, Other);
     }
 
+    // Each component is rounded only once, see URealFloatMath::SumOfProducts
     static FVectorFloat CrossProduct(const FVectorFloat& Vec, const FVectorFloat& Other)
     {
-        return FVectorFloat(Vec.Y * Other.Z - Vec.Z * Other.Y, Vec.Z * Other.X - Vec.X * Other.Z, Vec.X * Other.Y - Vec.Y * Other.X);
+        return FVectorFloat(
+            URealFloatMath::SumOfProducts(Vec.Y, Other.Z, -Vec.Z, Other.Y),
+            URealFloatMath::SumOfProducts(Vec.Z, Other.X, -Vec.X, Other.Z),
+            URealFloatMath::SumOfProducts(Vec.X, Other.Y, -Vec.Y, Other.X)
+        );
     }
 
     FVectorFloat operator^(const FVectorFloat& Other) const
@@ -142,7 +176,7 @@ public:
         return CrossProduct(*this, Other);
     }
 
-    bool Equals(const FVectorFloat& Other, FRealFloat Tolerance = FRealFloat(1.0e-8)) const
+    bool Equals(const FVectorFloat& Other, const FRealFloat& Tolerance = FRealFloat(1.0e-8)) const
     {
         return (*this - Other).GetAbsSum() <= Tolerance;
     }
@@ -168,11 +202,11 @@ public:
         return URealFloatMath::Sqrt(SizeSq);
     }
 
-    FVectorFloat GetNormal(FRealFloat Tolerance = FRealFloat(1.0e-8)) const
+    FVectorFloat GetNormal(const FRealFloat& Tolerance = FRealFloat(1.0e-8)) const
     {
-        const FRealFloat ThisSize = Size();
-        if (ThisSize < Tolerance) return Identity;
-        return *this / ThisSize;
+        const FRealFloat ThisSizeSquared = SizeSquared();
+        if (ThisSizeSquared < Tolerance * Tolerance) return Identity;
+        return *this * URealFloatMath::InvSqrt(ThisSizeSquared);
     }
 
     FRealFloat GetAbsSum() const
@@ -196,8 +230,14 @@ public:
     }
 };
 
+template<>
+struct TIsPODType<FVectorFloat>
+{
+    enum { Value = true };
+};
+
 
-inline FVectorFloat operator*(FRealFloat Other, const FVectorFloat& Vec)
+inline FVectorFloat operator*(const FRealFloat& Other, const FVectorFloat& Vec)
 {
     return FVectorFloat(Vec.X * Other, Vec.Y * Other, Vec.Z * Other);
 }
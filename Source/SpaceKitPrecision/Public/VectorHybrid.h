@@ -0,0 +1,231 @@
+// Copyright 2020 Baptiste Hutteau Licensed under the Apache License, Version 2.0
+
+#pragma once
+
+#include "SpaceKitPrecision/Public/RealHybrid.h"
+#include "SpaceKitPrecision/Public/VectorFloat.h"
+
+#include "VectorHybrid.generated.h"
+
+
+/*
+ * Similar to a FVectorFloat, but using FRealHybrid components: each one is a double until it needs more precision.
+ * It replaces FVectorFloat properties as is, see FRealHybrid.
+ */
+USTRUCT(BlueprintType)
+struct SPACEKITPRECISION_API FVectorHybrid
+{
+	GENERATED_BODY()
+
+public:
+
+	UPROPERTY()
+	FRealHybrid X;
+
+	UPROPERTY()
+	FRealHybrid Y;
+
+	UPROPERTY()
+	FRealHybrid Z;
+
+	static FVectorHybrid Identity;
+
+	FVectorHybrid()
+	{
+	}
+
+	FVectorHybrid(const FRealHybrid& InX, const FRealHybrid& InY, const FRealHybrid& InZ)
+		: X(InX), Y(InY), Z(InZ)
+	{
+	}
+
+	FVectorHybrid(double InX, double InY, double InZ)
+		: X(InX), Y(InY), Z(InZ)
+	{
+	}
+
+	explicit FVectorHybrid(const FVector& InVec)
+		: X(double(InVec.X)), Y(double(InVec.Y)), Z(double(InVec.Z))
+	{
+	}
+
+	// The components are doubles if they fit in one exactly
+	explicit FVectorHybrid(const FVectorFloat& InVec)
+		: X(InVec.X), Y(InVec.Y), Z(InVec.Z)
+	{
+	}
+
+	// So FVectorFloat values can be assigned to former FVectorFloat properties
+	FVectorHybrid& operator=(const FVectorFloat& Other)
+	{
+		X = Other.X;
+		Y = Other.Y;
+		Z = Other.Z;
+		return *this;
+	}
+
+	// So the vector can be passed where a FVectorFloat is expected
+	operator FVectorFloat() const
+	{
+		return FVectorFloat(X, Y, Z);
+	}
+
+// Vector math
+public:
+
+	FVectorHybrid operator+(const FVectorHybrid& Other) const
+	{
+		return FVectorHybrid(X + Other.X, Y + Other.Y, Z + Other.Z);
+	}
+
+	FVectorHybrid& operator+=(const FVectorHybrid& Other)
+	{
+		X += Other.X;
+		Y += Other.Y;
+		Z += Other.Z;
+		return *this;
+	}
+
+	FVectorHybrid operator-(const FVectorHybrid& Other) const
+	{
+		return FVectorHybrid(X - Other.X, Y - Other.Y, Z - Other.Z);
+	}
+
+	FVectorHybrid& operator-=(const FVectorHybrid& Other)
+	{
+		X -= Other.X;
+		Y -= Other.Y;
+		Z -= Other.Z;
+		return *this;
+	}
+
+	FVectorHybrid operator*(const FRealHybrid& Other) const
+	{
+		return FVectorHybrid(X * Other, Y * Other, Z * Other);
+	}
+
+	FVectorHybrid& operator*=(const FRealHybrid& Other)
+	{
+		X *= Other;
+		Y *= Other;
+		Z *= Other;
+		return *this;
+	}
+
+	FVectorHybrid operator/(const FRealHybrid& Other) const
+	{
+		return FVectorHybrid(X / Other, Y / Other, Z / Other);
+	}
+
+	FVectorHybrid& operator/=(const FRealHybrid& Other)
+	{
+		X /= Other;
+		Y /= Other;
+		Z /= Other;
+		return *this;
+	}
+
+	FVectorHybrid operator-() const
+	{
+		return FVectorHybrid(-X, -Y, -Z);
+	}
+
+	bool operator==(const FVectorHybrid& Other) const
+	{
+		return X == Other.X && Y == Other.Y && Z == Other.Z;
+	}
+
+	bool operator!=(const FVectorHybrid& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	// Whether any component has been promoted to a FRealFloat
+	bool IsBig() const
+	{
+		return X.IsBig() || Y.IsBig() || Z.IsBig();
+	}
+
+	FVector ToFVector() const
+	{
+		return FVector(X.ToFloat(), Y.ToFloat(), Z.ToFloat());
+	}
+
+	FString ToString() const
+	{
+		return FString::Printf(TEXT("(X=%s,Y=%s,Z=%s)"), *X.ToString(), *Y.ToString(), *Z.ToString());
+	}
+
+	FRealHybrid& GetAxis(EAxis::Type Axis)
+	{
+		return Axis == EAxis::X ? X : Axis == EAxis::Y ? Y : Z;
+	}
+
+	const FRealHybrid& GetAxis(EAxis::Type Axis) const
+	{
+		return Axis == EAxis::X ? X : Axis == EAxis::Y ? Y : Z;
+	}
+
+	// Loads the properties that were saved as FVectorFloat
+	bool SerializeFromMismatchedTag(const struct FPropertyTag& Tag, FStructuredArchive::FSlot Slot);
+};
+
+template<>
+struct TIsPODType<FVectorHybrid>
+{
+	enum { Value = true };
+};
+
+template<>
+struct TStructOpsTypeTraits<FVectorHybrid> : public TStructOpsTypeTraitsBase2<FVectorHybrid>
+{
+	enum
+	{
+		WithStructuredSerializeFromMismatchedTag = true,
+	};
+};
+
+
+inline FVectorHybrid operator*(const FRealHybrid& Other, const FVectorHybrid& Vec)
+{
+	return FVectorHybrid(Vec.X * Other, Vec.Y * Other, Vec.Z * Other);
+}
+
+
+/**
+ * Blueprints functions for VectorHybrid. Its math is the VectorFloat one, through the conversions
+ */
+UCLASS(BlueprintType, Abstract)
+class SPACEKITPRECISION_API UVectorHybridMath : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	UFUNCTION(BlueprintPure, category = "VectorHybrid", meta = (DisplayName = "VectorHybrid to VectorFloat", CompactNodeTitle = "->", BlueprintAutocast))
+	static FVectorFloat ConvVectorHybridToVectorFloat(const FVectorHybrid& InVec);
+
+	UFUNCTION(BlueprintPure, category = "VectorHybrid", meta = (DisplayName = "VectorFloat to VectorHybrid", CompactNodeTitle = "->", BlueprintAutocast))
+	static FVectorHybrid ConvVectorFloatToVectorHybrid(const FVectorFloat& InVec);
+
+	UFUNCTION(BlueprintPure, category = "VectorHybrid", meta = (DisplayName = "VectorHybrid to FVector", CompactNodeTitle = "->", BlueprintAutocast))
+	static FVector ConvVectorHybridToFVector(const FVectorHybrid& InVec);
+
+	UFUNCTION(BlueprintPure, category = "VectorHybrid", meta = (DisplayName = "Make VectorHybrid", CompactNodeTitle = "Make"))
+	static FVectorHybrid MakeVectorHybrid(const FRealHybrid& X, const FRealHybrid& Y, const FRealHybrid& Z);
+
+	UFUNCTION(BlueprintPure, category = "VectorHybrid", meta = (DisplayName = "Break VectorHybrid", CompactNodeTitle = "Break"))
+	static void BreakVectorHybrid(const FVectorHybrid& Vec, FRealHybrid& X, FRealHybrid& Y, FRealHybrid& Z);
+
+	UFUNCTION(BlueprintPure, category = "VectorHybrid", meta = (DisplayName = "VecHybrid + VecHybrid", CompactNodeTitle = "+"))
+	static FVectorHybrid VecPlusVec(const FVectorHybrid& First, const FVectorHybrid& Second);
+
+	UFUNCTION(BlueprintPure, category = "VectorHybrid", meta = (DisplayName = "VecHybrid - VecHybrid", CompactNodeTitle = "-"))
+	static FVectorHybrid VecMinusVec(const FVectorHybrid& First, const FVectorHybrid& Second);
+
+	UFUNCTION(BlueprintPure, category = "VectorHybrid", meta = (DisplayName = "VecHybrid * RealHybrid", CompactNodeTitle = "*"))
+	static FVectorHybrid VecMultReal(const FVectorHybrid& First, const FRealHybrid& Second);
+
+	UFUNCTION(BlueprintPure, category = "VectorHybrid", meta = (DisplayName = "VecHybrid / RealHybrid", CompactNodeTitle = "/"))
+	static FVectorHybrid VecDivReal(const FVectorHybrid& First, const FRealHybrid& Second);
+};
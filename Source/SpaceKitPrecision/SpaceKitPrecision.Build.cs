@@ -12,5 +12,18 @@ public class SpaceKitPrecision : ModuleRules
 		PrivatePCHHeaderFile = "SpaceKitPrecision.h";
 
 		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "Boost" });
+
+		// libquadmath gives the __float128 storage of FRealFloat (USE_FLOAT128_BIG in PrecisionSettings.h) its transcendental functions.
+		// It ships with GCC, not with every clang toolchain, so it's opt-in: without it, the storage falls back to the ttmath kernels
+		bool bUseQuadmath = false;
+		if (bUseQuadmath && Target.Platform == UnrealTargetPlatform.Linux)
+		{
+			PublicDefinitions.Add("SPACEKIT_WITH_QUADMATH=1");
+			PublicSystemLibraries.Add("quadmath");
+		}
+		else
+		{
+			PublicDefinitions.Add("SPACEKIT_WITH_QUADMATH=0");
+		}
 	}
 }
@@ -6,7 +6,9 @@
 
 #include "SpaceKitPrecision/Public/RealFixed.h"
 #include "SpaceKitPrecision/Public/RealFloat.h"
+#include "SpaceKitPrecision/Public/RealHybrid.h"
 #include "SpaceKitPrecision/Public/VectorFixed.h"
+#include "SpaceKitPrecision/Public/VectorHybrid.h"
 
 #include "Engine/Public/Engine.h"
 #include "PropertyEditor/Public/PropertyEditorModule.h"
@@ -39,6 +41,10 @@ void FSpaceKitPrecisionEditorModule::RegisterCustomPropertiesLayout()
 		"RealFloat",
 		FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FRealStructCustomization<FRealFloat>::MakeInstance)
 	);
+	PropertyModule.RegisterCustomPropertyTypeLayout(
+		"RealHybrid",
+		FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FRealStructCustomization<FRealHybrid>::MakeInstance)
+	);
 	PropertyModule.RegisterCustomPropertyTypeLayout(
 		"VectorFixed",
 		FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FVectorGenericStructCustomization<FVectorFixed, FRealFixed>::MakeInstanceDefaults)
@@ -47,6 +53,10 @@ void FSpaceKitPrecisionEditorModule::RegisterCustomPropertiesLayout()
 		"VectorFloat",
 		FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FVectorGenericStructCustomization<FVectorFloat, FRealFloat>::MakeInstanceDefaults)
 	);
+	PropertyModule.RegisterCustomPropertyTypeLayout(
+		"VectorHybrid",
+		FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FVectorGenericStructCustomization<FVectorHybrid, FRealHybrid>::MakeInstanceDefaults)
+	);
 	PropertyModule.RegisterCustomPropertyTypeLayout(
 		"RotatorFloat",
 		FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FVectorGenericStructCustomization<FRotatorFloat, FRealFloat>::MakeInstance,
@@ -75,6 +85,10 @@ class FSpaceKitPrecisionGraphPanelPinFactory : public FGraphPanelPinFactory
 				{
 					return SNew(SRealGraphPin<FRealFloat>, InPin);
 				}
+				if (PinStructType->IsChildOf(FRealHybrid::StaticStruct()))
+				{
+					return SNew(SRealGraphPin<FRealHybrid>, InPin);
+				}
 			}
 		}
 